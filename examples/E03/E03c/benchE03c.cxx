@@ -0,0 +1,127 @@
+//------------------------------------------------
+// The Virtual Monte Carlo examples
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file benchE03c.cxx
+/// \brief The Geant4 VMC step manager accessors microbenchmark
+///
+/// The E03c calorimeter geometry (replicated layers with several media)
+/// is built and a short run is performed with recording of the Geant4
+/// steps; the recorded steps are then replayed through the Geant4 VMC
+/// step manager with the selected accessors and the time per accessor
+/// call (in ns) is printed.
+///
+/// Usage:
+/// benchE03c [-g4g geomRootToGeant4|geomRoot] [-n nofEvents]
+///           [-r nofRepetitions] [-m maxNofSteps] [-a "accessor1 ..."]
+///
+/// The geometry option selects the Geant4 native navigation
+/// (geomRootToGeant4, default) or the TGeo navigation via g4root (geomRoot).
+/// The program has to be run from the E03 directory (with g4config.in).
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "Ex03PrimaryGenerator.h"
+#include "Ex03cMCApplication.h"
+
+#include "TG4RunConfiguration.h"
+#include "TGeant4.h"
+
+#include <TString.h>
+
+#include <iostream>
+
+namespace
+{
+void PrintUsage()
+{
+  std::cout << "Usage:" << std::endl
+            << "benchE03c [-g4g geomRootToGeant4|geomRoot] [-n nofEvents]"
+            << std::endl
+            << "          [-r nofRepetitions] [-m maxNofSteps]"
+            << " [-a \"accessor1 ...\"]" << std::endl;
+}
+} // namespace
+
+/// Application main program
+int main(int argc, char** argv)
+{
+  TString g4Geometry = "geomRootToGeant4";
+  Int_t nofEvents = 5;
+  Int_t nofRepetitions = 10;
+  Int_t maxNofSteps = 100000;
+  TString accessors;
+
+  for (Int_t i = 1; i < argc; ++i) {
+    TString option = argv[i];
+    if (option == "-h" || option == "--help") {
+      PrintUsage();
+      return 0;
+    }
+    if (i + 1 >= argc) {
+      std::cerr << "Missing value for option " << option << std::endl;
+      PrintUsage();
+      return 1;
+    }
+    TString value = argv[++i];
+    if (option == "-g4g")
+      g4Geometry = value;
+    else if (option == "-n")
+      nofEvents = value.Atoi();
+    else if (option == "-r")
+      nofRepetitions = value.Atoi();
+    else if (option == "-m")
+      maxNofSteps = value.Atoi();
+    else if (option == "-a")
+      accessors = value;
+    else {
+      std::cerr << "Unsupported option " << option << std::endl;
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  if (g4Geometry != "geomRootToGeant4" && g4Geometry != "geomRoot") {
+    std::cerr << "Unsupported geometry option " << g4Geometry << std::endl;
+    return 1;
+  }
+
+  // Create MC application
+  Ex03cMCApplication* appl = new Ex03cMCApplication(
+    "ExampleE03", "The exampleE03 MC application", false, false);
+  appl->GetPrimaryGenerator()->SetNofPrimaries(20);
+
+  // RunConfiguration for Geant4 (sequential mode)
+  TG4RunConfiguration* runConfiguration = new TG4RunConfiguration(
+    g4Geometry, "FTFP_BERT", "stepLimiter", false, false);
+
+  // TGeant4
+  TGeant4* geant4 = new TGeant4(
+    "TGeant4", "The Geant4 Monte Carlo", runConfiguration, argc, argv);
+
+  // Customise Geant4 setting and activate the steps recording
+  geant4->ProcessGeantMacro("g4config.in");
+  geant4->ProcessGeantCommand("/mcTracking/stepReplay/setRecord true");
+  geant4->ProcessGeantCommand(
+    Form("/mcTracking/stepReplay/setMaxNofSteps %d", maxNofSteps));
+  geant4->ProcessGeantCommand(
+    Form("/mcTracking/stepReplay/setNofRepetitions %d", nofRepetitions));
+  if (accessors.Length()) {
+    geant4->ProcessGeantCommand(
+      "/mcTracking/stepReplay/setAccessors " + accessors);
+  }
+
+  appl->InitMC("");
+  appl->RunMC(nofEvents);
+
+  // Replay the recorded steps
+  std::cout << "### Navigation: " << g4Geometry << std::endl;
+  geant4->ProcessGeantCommand("/mcTracking/stepReplay/replay");
+
+  delete appl;
+}
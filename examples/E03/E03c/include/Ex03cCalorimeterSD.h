@@ -54,6 +54,7 @@ class Ex03cCalorimeterSD : public TNamed
 
   // set methods
   void SetVerboseLevel(Int_t level);
+  void SetCheckPaths(Bool_t checkPaths);
 
   // get methods
   Ex03CalorHit* GetHit(Int_t i) const;
@@ -61,6 +62,7 @@ class Ex03cCalorimeterSD : public TNamed
  private:
   // methods
   void ResetHits();
+  void CheckPath() const;
 
   // data members
   TVirtualMC* fMC;                      ///< The VMC implementation
@@ -69,6 +71,7 @@ class Ex03cCalorimeterSD : public TNamed
   Int_t fAbsorberVolId;                 ///< The absorber volume Id
   Int_t fGapVolId;                      ///< The gap volume Id
   Int_t fVerboseLevel;                  ///< Verbosity level
+  Bool_t fCheckPaths;                   ///< Option to check volume paths
 
   ClassDef(Ex03cCalorimeterSD, 1) // Ex03cCalorimeterSD
 };
@@ -80,4 +83,11 @@ inline void Ex03cCalorimeterSD::SetVerboseLevel(Int_t level)
   fVerboseLevel = level;
 }
 
+/// Set the option to check the volume path in each processed step
+/// \param checkPaths The new option value
+inline void Ex03cCalorimeterSD::SetCheckPaths(Bool_t checkPaths)
+{
+  fCheckPaths = checkPaths;
+}
+
 #endif // EX02_CALORIMETER_SD_H
@@ -28,6 +28,8 @@
 #include <TTree.h>
 #include <TVirtualMC.h>
 
+#include <cstdlib>
+
 /// \cond CLASSIMP
 ClassImp(Ex03cCalorimeterSD)
   /// \endcond
@@ -43,7 +45,8 @@ Ex03cCalorimeterSD::Ex03cCalorimeterSD(
     fCalCollection(0),
     fAbsorberVolId(0),
     fGapVolId(0),
-    fVerboseLevel(1)
+    fVerboseLevel(1),
+    fCheckPaths(false)
 {
   /// Standard constructor.
   /// Create hits collection and an empty hit for each layer
@@ -66,7 +69,8 @@ Ex03cCalorimeterSD::Ex03cCalorimeterSD(
     fCalCollection(0),
     fAbsorberVolId(origin.fAbsorberVolId),
     fGapVolId(origin.fGapVolId),
-    fVerboseLevel(origin.fVerboseLevel)
+    fVerboseLevel(origin.fVerboseLevel),
+    fCheckPaths(origin.fCheckPaths)
 {
   /// Copy constructor (for clonig on worker thread in MT mode).
   /// Create hits collection and an empty hit for each layer
@@ -87,7 +91,8 @@ Ex03cCalorimeterSD::Ex03cCalorimeterSD()
     fCalCollection(0),
     fAbsorberVolId(0),
     fGapVolId(0),
-    fVerboseLevel(1)
+    fVerboseLevel(1),
+    fCheckPaths(false)
 {
   /// Default constructor
 }
@@ -123,6 +128,34 @@ void Ex03cCalorimeterSD::ResetHits()
     GetHit(i)->Reset();
 }
 
+//_____________________________________________________________________________
+void Ex03cCalorimeterSD::CheckPath() const
+{
+  /// Check that the current volume path is consistent with the volume names
+  /// and copy numbers returned for each level, and so with the path
+  /// defined in the input geometry; stop the program if it is not.
+
+  TString path = fMC->CurrentVolPath();
+
+  // Compose the expected path from the current volume and its mothers
+  Int_t nofLevels = path.CountChar('/');
+  TString expectedPath;
+  for (Int_t off = nofLevels - 1; off >= 0; --off) {
+    Int_t copyNo;
+    fMC->CurrentVolOffID(off, copyNo);
+    expectedPath += "/";
+    expectedPath += fMC->CurrentVolOffName(off);
+    expectedPath += "_";
+    expectedPath += copyNo;
+  }
+
+  if (path != expectedPath) {
+    std::cerr << "Volume path " << path << " does not match the expected path "
+              << expectedPath << endl;
+    exit(1);
+  }
+}
+
 //
 // public methods
 //
@@ -159,6 +192,8 @@ Bool_t Ex03cCalorimeterSD::ProcessHits()
 
   if (id != fAbsorberVolId && id != fGapVolId) return false;
 
+  if (fCheckPaths) CheckPath();
+
   fMC->CurrentVolOffID(2, copyNo);
   // cout << "Got copyNo "<< copyNo << " " << fMC->CurrentVolPath() << endl;
 
@@ -0,0 +1,304 @@
+#!/bin/bash
+#------------------------------------------------
+# The Virtual Monte Carlo examples
+# Copyright (C) 2007 - 2024 Ivana Hrivnacova
+# All rights reserved.
+#
+# For the licensing terms see geant4_vmc/LICENSE.
+# Contact: root-vmc@cern.ch
+#-------------------------------------------------
+
+#
+# Run performance benchmarks with Geant4 from the examples built executables
+# and record the results in a CSV file; optionally compare the results with
+# a stored baseline and report regressions beyond a given threshold.
+#
+# The benchmark workloads are the test macros of E03c (calorimeter),
+# A01 (spectrometer), TR, Gflash and E06 (optical) run with the Geant4 native
+# navigation (geomRootToGeant4) and with the TGeo navigation via g4root
+# (geomRoot). The Geant4 random engine is initialised with fixed seeds
+# (--seeds option); ROOT gRandom, used in the primary generators, starts
+# from its default seed.
+#
+# For each workload the following quantities are recorded:
+# events, steps, initialization time [s] (the wall time outside the runs),
+# run time [s], events/s, steps/s and peak RSS [kB].
+# With --repeat=N the workload is run N times and the fastest run is recorded.
+#
+# Usage:
+# benchmark_suite.sh [--examples="E03 A01 ..."] [--navigation="native g4root"]
+#                    [--builddir=dir] [--seeds="s1 s2"] [--repeat=N]
+#                    [--output=file] [--compare=baseline] [--threshold=percent]
+#                    [--compare-only]
+#
+# Examples:
+# benchmark_suite.sh --output=baseline.csv
+# benchmark_suite.sh --compare=baseline.csv --threshold=5
+#
+# By I. Hrivnacova, IJCLab Orsay
+
+CURDIR=`pwd`
+OUTDIR=$CURDIR/logs/benchmark
+EXEDIR=""
+BUILDDIR=""
+SEEDS="12345 67890"
+REPEAT="1"
+OUTPUT=$OUTDIR/results.csv
+BASELINE=""
+THRESHOLD="10"
+COMPAREONLY="0"
+
+# When running on Mac with SIP enabled, the DYLD_LIBRARY_PATH must be defined
+# via another env variable
+RUN_ENV=""
+if [[ ${ROOT_LD_LIBRARY_PATH} ]]
+then
+  RUN_ENV="env DYLD_LIBRARY_PATH=${ROOT_LD_LIBRARY_PATH} "
+fi
+
+# The default list of examples (all benchmarked)
+ALL_EXAMPLES="E03 A01 TR Gflash E06"
+EXAMPLES="$ALL_EXAMPLES"
+
+# The default list of navigation options
+NAVIGATION="native g4root"
+
+# The results file header
+HEADER="example,navigation,events,steps,init_time_s,run_time_s,events_per_s,steps_per_s,peak_rss_kb"
+
+function print_help()
+{
+  echo "Usage:"
+  echo "benchmark_suite.sh [--examples=\"E03 A01 ...\"] [--navigation=\"native g4root\"]"
+  echo "                   [--builddir=dir] [--seeds=\"s1 s2\"] [--repeat=N]"
+  echo "                   [--output=file] [--compare=baseline] [--threshold=percent]"
+  echo "                   [--compare-only] [--help|-h]"
+}
+
+# Function arguments:
+# {1} : command to be timed
+# The wall time [s] and peak RSS [kB] are printed on the error output
+# in the format "benchmark: wall=... rss=..."
+function run_timed()
+{
+  if [ "`uname`" = "Darwin" ]; then
+    /usr/bin/time -l "${@}"
+  else
+    /usr/bin/time -f "benchmark: wall=%e rss=%M" "${@}"
+  fi
+}
+
+# Function arguments:
+# {1} : log file
+# Prints: events steps init_time run_time peak_rss
+function parse_log()
+{
+  awk '
+    /^Time of this run:/ {
+      if (match($0, /Real=[0-9.eE+-]+/)) {
+        runtime += substr($0, RSTART + 5, RLENGTH - 5)
+      }
+    }
+    /^Number of events processed: / { events += $5 }
+    /^Number of steps processed: /  { steps += $5 }
+    /^benchmark: wall=/ {
+      split($2, w, "="); wall = w[2]
+      split($3, r, "="); rss = r[2]
+    }
+    # BSD time output (Mac)
+    / real / && $2 == "real" { wall = $1 }
+    /maximum resident set size/ { rss = $1 / 1024 }
+    END {
+      init = wall - runtime
+      if (init < 0) init = 0
+      printf("%d %d %.3f %.3f %d\n", events, steps, init, runtime, rss)
+    }' ${1}
+}
+
+# Function arguments:
+# {1} : example
+# {2} : navigation (native, g4root)
+function run_benchmark()
+{
+  EXAMPLE=${1}
+  NAV=${2}
+
+  # The executable, test macro and its working directory
+  EXE_NAME="g4vmc_test"$EXAMPLE
+  EXE_DIR=$EXAMPLE
+  MACRO="test_$EXAMPLE.C(\"\")"
+  case $EXAMPLE in
+    "E03"    ) EXE_NAME="g4vmc_testE03c"
+               EXE_DIR="E03/E03c"
+               MACRO="test_E03_1.C(\"\", kFALSE)" ;;
+    "A01"    ) MACRO="test_A01_1.C(\"\", kFALSE)" ;;
+    "E06"    ) MACRO="test_E06.C(\"\", kFALSE)" ;;
+  esac
+
+  if [ "x${BUILDDIR}" != "x" ]; then
+    EXE=${BUILDDIR}/examples/$EXE_DIR/$EXE_NAME
+  else
+    EXE=$EXE_NAME
+  fi
+
+  case $NAV in
+    "native" ) GEOMETRY="geomRootToGeant4" ;;
+    "g4root" ) GEOMETRY="geomRoot" ;;
+    *        ) echo "Unsupported navigation $NAV chosen."
+               return 1 ;;
+  esac
+
+  # Geant4 macro with the example configuration, the fixed seeds
+  # and the run summary printing
+  OUT=$OUTDIR/$EXAMPLE
+  if [ ! -d $OUT ]; then
+    mkdir -p $OUT
+  fi
+  G4MACRO=$OUT/benchmark.in
+  echo "/control/execute g4config.in"        > $G4MACRO
+  echo "/mcVerbose/runAction 1"             >> $G4MACRO
+  echo "/mcControl/useRootRandom false"     >> $G4MACRO
+  echo "/random/setSeeds $SEEDS"            >> $G4MACRO
+
+  echo -n "... Benchmark $EXAMPLE with $NAV navigation"
+
+  BEST=""
+  for (( i=1; i<=$REPEAT; i++ ))
+  do
+    LOG=$OUT/benchmark_${NAV}_$i.out
+    run_timed $RUN_ENV $EXE -g4g $GEOMETRY -g4m $G4MACRO -g4vm "" -rm "$MACRO" >& $LOG
+    if [ "$?" -ne "0" ]; then
+      echo " ... failed (see $LOG)"
+      return 1
+    fi
+    RESULT=`parse_log $LOG`
+    # keep the fastest run
+    if [ "x$BEST" = "x" ]; then
+      BEST=$RESULT
+    else
+      BEST=`echo "$BEST $RESULT" | awk '{ if ($9 < $4) print $6, $7, $8, $9, $10; else print $1, $2, $3, $4, $5 }'`
+    fi
+  done
+
+  echo "$EXAMPLE $NAV $BEST" | awk '{
+    rate_events = ($6 > 0) ? $3 / $6 : 0
+    rate_steps = ($6 > 0) ? $4 / $6 : 0
+    printf("%s,%s,%d,%d,%.3f,%.3f,%.3f,%.1f,%d\n",
+           $1, $2, $3, $4, $5, $6, rate_events, rate_steps, $7)
+  }' >> $OUTPUT
+  echo " ... done"
+
+  # clean-up generated files
+  rm -f Example*.root
+  return 0
+}
+
+# Function arguments:
+# {1} : baseline file
+# {2} : results file
+# {3} : threshold in percent
+# Returns 1 if a regression was found
+function compare_results()
+{
+  echo "... Comparing $2 with baseline $1 (threshold ${3}%)"
+  awk -F, -v threshold=$3 '
+    # Function arguments: metric name, baseline, current value,
+    # sign (1 if higher is better, -1 if lower is better)
+    function check(key, name, base, curr, sign,    change) {
+      if (base <= 0) return
+      change = (curr - base) / base * 100
+      status = "ok"
+      if (-sign * change > threshold) {
+        status = "REGRESSION"
+        regressions++
+      }
+      printf("  %-20s %-14s %14.3f %14.3f %+8.1f%%  %s\n",
+             key, name, base, curr, change, status)
+    }
+    FNR == 1 { next }
+    FNR == NR { base[$1 "/" $2] = $0; next }
+    {
+      key = $1 "/" $2
+      if (! (key in base)) {
+        printf("  %-20s not in baseline\n", key)
+        next
+      }
+      split(base[key], b, ",")
+      check(key, "events/s", b[7], $7, 1)
+      check(key, "steps/s", b[8], $8, 1)
+      check(key, "init time [s]", b[5], $5, -1)
+      check(key, "peak RSS [kB]", b[9], $9, -1)
+    }
+    END {
+      if (regressions > 0) {
+        printf("... %d regression(s) beyond %s%% found\n",
+               regressions, threshold)
+        exit 1
+      }
+      printf("... No regression beyond %s%% found\n", threshold)
+    }' $1 $2
+}
+
+# Process script arguments
+for arg in "${@}"
+do
+  #echo "got: $arg"
+  case $arg in
+     --examples=*    ) EXAMPLES=${arg#--examples=} ;;
+     --navigation=*  ) NAVIGATION=${arg#--navigation=} ;;
+     --builddir=*    ) BUILDDIR=${arg#--builddir=} ;;
+     --seeds=*       ) SEEDS=${arg#--seeds=} ;;
+     --repeat=*      ) REPEAT=${arg#--repeat=} ;;
+     --output=*      ) OUTPUT=${arg#--output=} ;;
+     --compare=*     ) BASELINE=${arg#--compare=} ;;
+     --threshold=*   ) THRESHOLD=${arg#--threshold=} ;;
+    "--compare-only" ) COMPAREONLY="1" ;;
+    "--help" | "-h"  ) print_help
+                       exit 0
+                       ;;
+    * ) echo "Unsupported option $arg chosen."
+        print_help
+        exit 1
+        ;;
+  esac
+done
+
+# Make the output file path absolute as the benchmarks run in the examples
+# directories
+case $OUTPUT in
+  /* ) ;;
+  *  ) OUTPUT=$CURDIR/$OUTPUT ;;
+esac
+
+if [ "$COMPAREONLY" = "0" ]; then
+  # Set path to shared libraries if --builddir is provided via the option
+  if [ "x${BUILDDIR}" != "x" ]; then
+    LIBS_FROM_BUILDDIR=$(find ${BUILDDIR} -iname "*.so" -exec dirname {} \; | tr '\r\n' ':')
+    export LD_LIBRARY_PATH=${LD_LIBRARY_PATH}:${LIBS_FROM_BUILDDIR}
+  fi
+
+  mkdir -p `dirname $OUTPUT`
+  echo $HEADER > $OUTPUT
+
+  FAILED="0"
+  for EXAMPLE in $EXAMPLES
+  do
+    cd $CURDIR/$EXAMPLE
+    for NAV in $NAVIGATION
+    do
+      run_benchmark $EXAMPLE $NAV
+      if [ "$?" -ne "0" ]; then FAILED=`expr $FAILED + 1`; fi
+    done
+  done
+  cd $CURDIR
+
+  echo "... Results saved in $OUTPUT"
+  if [ "$FAILED" -ne "0" ]; then
+    echo "... $FAILED benchmark(s) failed"
+  fi
+fi
+
+if [ "x${BASELINE}" != "x" ]; then
+  compare_results $BASELINE $OUTPUT $THRESHOLD
+  exit $?
+fi
@@ -0,0 +1,209 @@
+#!/bin/bash
+#------------------------------------------------
+# The Virtual Monte Carlo examples
+# Copyright (C) 2007 - 2024 Ivana Hrivnacova
+# All rights reserved.
+#
+# For the licensing terms see geant4_vmc/LICENSE.
+# Contact: root-vmc@cern.ch
+#-------------------------------------------------
+
+#
+# Run the multi-threading scaling sweep for a selected example with Geant4:
+# the example is run with 1, 2, 4 ... N threads with a fixed total number
+# of events and the Geant4 VMC MT profiler activated (/mcControl/profileMT).
+#
+# For each number of threads the following quantities are recorded in a CSV
+# file: the run time [s], speed-up and efficiency with respect to the run
+# with the first number of threads, events/s, the mean and maximum thread
+# event time [s] (the sum of event times per thread), the total time spent
+# in waiting for the Geant4 VMC mutexes [s] and the total time of the worker
+# initialization and merging phases [s].
+# The profile per locking site and per phase is printed on the screen.
+#
+# The number of threads is passed via G4FORCENUMBEROFTHREADS environment
+# variable and the examples are run from Root (with load_g4.C macros and
+# g4Config.C or g4tgeoConfig.C configuration macros), as the test programs
+# are built in sequential mode.
+#
+# Usage:
+# mt_scaling.sh [--example=E03|A01|TR|Gflash|E06] [--threads="1 2 4 8"]
+#               [--events=N] [--navigation=native|g4root] [--output=file]
+#
+# By I. Hrivnacova, IJCLab Orsay
+
+CURDIR=`pwd`
+OUTDIR=$CURDIR/logs/mt_scaling
+EXAMPLE="E03"
+THREADS="1 2 4 8"
+EVENTS="64"
+NAVIGATION="native"
+OUTPUT=""
+
+# When running on Mac with SIP enabled, the DYLD_LIBRARY_PATH must be defined
+# via another env variable
+RUN_ENV=""
+if [[ ${ROOT_LD_LIBRARY_PATH} ]]
+then
+  RUN_ENV="env DYLD_LIBRARY_PATH=${ROOT_LD_LIBRARY_PATH} "
+fi
+
+function print_help()
+{
+  echo "Usage:"
+  echo "mt_scaling.sh [--example=E03|A01|TR|Gflash|E06] [--threads=\"1 2 4 8\"]"
+  echo "              [--events=N] [--navigation=native|g4root] [--output=file]"
+  echo "              [--help|-h]"
+}
+
+# Function arguments:
+# {1} : the MC application class name
+# {2} : the macro file name
+function write_macro()
+{
+  cat > ${2} << EOF
+// Generated by mt_scaling.sh
+void run_mt_scaling(const TString& configMacro, Int_t nofEvents)
+{
+  ${1}* appl
+    = new ${1}("ExampleMTScaling", "The MT scaling application");
+
+  appl->InitMC(configMacro);
+
+  // Activate the MT profiler and the run summary printing
+  ((TGeant4*)gMC)->ProcessGeantCommand("/mcControl/profileMT true");
+  ((TGeant4*)gMC)->ProcessGeantCommand("/mcVerbose/runAction 1");
+
+  appl->RunMC(nofEvents);
+
+  delete appl;
+}
+EOF
+}
+
+# Function arguments:
+# {1} : number of threads
+# {2} : log file
+# Prints: threads run_time events event_time_mean event_time_max lock_wait
+#         worker_init merge
+function parse_log()
+{
+  awk -v threads=${1} '
+    /^Time of this run:/ {
+      if (match($0, /Real=[0-9.eE+-]+/)) {
+        runtime = substr($0, RSTART + 5, RLENGTH - 5)
+      }
+    }
+    /^Number of events processed: / { events = $5 }
+    /^MTProfile thread / {
+      nthreads++
+      sum += $7
+      if ($7 > max) max = $7
+    }
+    /^MTProfile lock /  { lockwait += $7 }
+    /^MTProfile phase / {
+      if ($3 == "cloneRootNavigator" || $3 == "lateInitializeOnWorker" ||
+          $3 == "beginRunOnWorker") init += $7
+      if ($3 == "merge" || $3 == "finishRunOnWorker") merge += $7
+    }
+    END {
+      mean = (nthreads > 0) ? sum / nthreads : 0
+      printf("%d %.3f %d %.3f %.3f %.6f %.3f %.3f\n",
+             threads, runtime, events, mean, max, lockwait, init, merge)
+    }' ${2}
+}
+
+# Process script arguments
+for arg in "${@}"
+do
+  #echo "got: $arg"
+  case $arg in
+     --example=*     ) EXAMPLE=${arg#--example=} ;;
+     --threads=*     ) THREADS=${arg#--threads=} ;;
+     --events=*      ) EVENTS=${arg#--events=} ;;
+     --navigation=*  ) NAVIGATION=${arg#--navigation=} ;;
+     --output=*      ) OUTPUT=${arg#--output=} ;;
+    "--help" | "-h"  ) print_help
+                       exit 0
+                       ;;
+    * ) echo "Unsupported option $arg chosen."
+        print_help
+        exit 1
+        ;;
+  esac
+done
+
+# The example specific settings
+LOAD_MACRO="load_g4.C"
+case $EXAMPLE in
+  "E03"    ) APPCLASS="Ex03cMCApplication"
+             LOAD_MACRO="load_g4c.C" ;;
+  "A01"    ) APPCLASS="A01MCApplication" ;;
+  "E06"    ) APPCLASS="Ex06MCApplication" ;;
+  "TR"     ) APPCLASS="VMC::TR::MCApplication" ;;
+  "Gflash" ) APPCLASS="VMC::Gflash::MCApplication" ;;
+  *        ) echo "Unsupported example $EXAMPLE chosen."
+             exit 1 ;;
+esac
+
+case $NAVIGATION in
+  "native" ) CONFIG_MACRO="g4Config.C" ;;
+  "g4root" ) CONFIG_MACRO="g4tgeoConfig.C" ;;
+  *        ) echo "Unsupported navigation $NAVIGATION chosen."
+             exit 1 ;;
+esac
+
+OUT=$OUTDIR/$EXAMPLE
+if [ ! -d $OUT ]; then
+  mkdir -p $OUT
+fi
+if [ "x${OUTPUT}" = "x" ]; then
+  OUTPUT=$OUT/scaling_${NAVIGATION}.csv
+fi
+case $OUTPUT in
+  /* ) ;;
+  *  ) OUTPUT=$CURDIR/$OUTPUT ;;
+esac
+
+MACRO=$OUT/run_mt_scaling.C
+write_macro $APPCLASS $MACRO
+
+echo "threads,run_time_s,speedup,efficiency,events_per_s,event_time_mean_s,event_time_max_s,lock_wait_s,worker_init_s,merge_s" > $OUTPUT
+
+cd $CURDIR/$EXAMPLE
+REFTIME=""
+REFTHREADS=""
+for NTHREADS in $THREADS
+do
+  LOG=$OUT/run_${NAVIGATION}_${NTHREADS}.out
+  echo "... Running $EXAMPLE with $NTHREADS thread(s), $EVENTS events"
+  env G4FORCENUMBEROFTHREADS=$NTHREADS $RUN_ENV root.exe -q -b $LOAD_MACRO \
+    $MACRO\(\"$CONFIG_MACRO\",$EVENTS\) >& $LOG
+  if [ "$?" -ne "0" ]; then
+    echo "    failed (see $LOG)"
+    continue
+  fi
+
+  # print the profile per locking site and phase
+  grep "^MTProfile lock \|^MTProfile phase " $LOG | sed "s/^MTProfile/   /"
+
+  RESULT=`parse_log $NTHREADS $LOG`
+  if [ "x$REFTIME" = "x" ]; then
+    REFTIME=`echo $RESULT | awk '{ print $2 }'`
+    REFTHREADS=$NTHREADS
+  fi
+  echo "$RESULT" | awk -v reftime=$REFTIME -v refthreads=$REFTHREADS '{
+    speedup = ($2 > 0) ? reftime / $2 : 0
+    efficiency = speedup * refthreads / $1
+    rate = ($2 > 0) ? $3 / $2 : 0
+    printf("%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.6f,%.3f,%.3f\n",
+           $1, $2, speedup, efficiency, rate, $4, $5, $6, $7, $8)
+  }' >> $OUTPUT
+
+  # clean-up generated files
+  rm -f Example*.root
+done
+cd $CURDIR
+
+echo "... Results saved in $OUTPUT"
+column -s, -t $OUTPUT 2> /dev/null || cat $OUTPUT
@@ -132,6 +132,7 @@ class TG4RootDetectorConstruction : public G4VUserDetectorConstruction
   TGeoVolume* GetVolume(const G4LogicalVolume* g4vol) const;
   G4VPhysicalVolume* GetG4VPhysicalVolume(const TGeoNode* node) const;
   TGeoNode* GetNode(const G4VPhysicalVolume* g4vol) const;
+  size_t GetMapsMemorySize() const;
   /// Return the sensitive detector hook
   TVirtualUserPostDetConstruction* GetSDInit() const { return fSDInit; }
   /// Return the flag Construct() called
@@ -490,3 +490,16 @@ TGeoNode* TG4RootDetectorConstruction::GetNode(
   if (it != fPVolumeMap.end()) return it->second;
   return NULL;
 }
+
+//______________________________________________________________________________
+size_t TG4RootDetectorConstruction::GetMapsMemorySize() const
+{
+  /// Return the estimated memory (in bytes) allocated by the maps between
+  /// ROOT and Geant4 objects (the map nodes holding a pair of pointers
+  /// with the next pointer and the buckets array).
+  auto mapSize = [](const auto& map) {
+    return map.size() * 3 * sizeof(void*) + map.bucket_count() * sizeof(void*);
+  };
+  return mapSize(fG4MaterialMap) + mapSize(fG4VolumeMap) +
+         mapSize(fVolumeMap) + mapSize(fG4PVolumeMap) + mapSize(fPVolumeMap);
+}
@@ -361,11 +361,14 @@ G4VPhysicalVolume* TG4RootNavigator::LocateGlobalPointAndSetup(
   // Flag if geometry state was recovered.
   Bool_t isGeoStateRestored = kFALSE;
   // Try recstore geometry for those G4Tracks which are treated as primaries
-  // since they might have been transferred to GEANT4 from another engine
-  if (fG4TrackingManager && fRestoreGeoStateFunction &&
-      fG4TrackingManager->GetTrack()->GetParentID() == 0) {
-    Int_t currG4TrackId = fG4TrackingManager->GetTrack()->GetTrackID();
-    isGeoStateRestored = fRestoreGeoStateFunction(currG4TrackId);
+  // since they might have been transferred to GEANT4 from another engine;
+  // the state can be restored only at the track start, so the function
+  // is not called in the following steps
+  if (fG4TrackingManager && fRestoreGeoStateFunction) {
+    G4Track* track = fG4TrackingManager->GetTrack();
+    if (track->GetParentID() == 0 && track->GetCurrentStepNumber() == 0) {
+      isGeoStateRestored = fRestoreGeoStateFunction(track->GetTrackID());
+    }
   }
 
 #ifdef G4ROOT_DEBUG
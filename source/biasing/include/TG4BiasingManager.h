@@ -25,6 +25,12 @@
 /// and particles to which biasing will be applied.
 /// The manager does not contribute to creating regions, as the biasing
 /// operator is attached directly to logical volumes.
+///
+/// The particles to be biased are selected via the setParticles command;
+/// if no particles are selected (or "all" is set), the biasing is applied
+/// to all particles supported by the biasing operation (proton, neutron,
+/// pi+, pi-). The same selection is used to wrap the particles inelastic
+/// processes in the "biasing" extra physics.
 
 /// \author I. Hrivnacova; IPN Orsay
 
@@ -40,11 +46,18 @@ class TG4BiasingManager : public TG4ModelConfigurationManager
   // methods
   void CreateBiasingOperator();
 
+  // get methods
+  std::vector<G4String> GetParticles() const;
+
  private:
   /// Not implemented
   TG4BiasingManager(const TG4BiasingManager& right);
   /// Not implemented
   TG4BiasingManager& operator=(const TG4BiasingManager& right);
+
+  // static data members
+  /// The default particles to be biased
+  static const G4String fgkDefaultParticles;
 };
 
 #endif // TG4_BIASING_MANAGER_H
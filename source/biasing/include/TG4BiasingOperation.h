@@ -17,17 +17,33 @@
 
 #include "G4VBiasingOperation.hh"
 
+#include <map>
+
 class G4HadronInelasticProcess;
+class G4HadronicInteraction;
+class G4ParticleDefinition;
+class G4VCrossSectionDataSet;
 
 class TG4BiasingOperation : public G4VBiasingOperation
 {
   // The biasing operation implemented in this class is indeed a "trick" to
   // use FTFP+INCLXX instead of FTFP+BERT for determining the final-state of
-  // proton, neutron, pion+, pion- inelastic interactions happening in one
-  // particular logical volume, Tracking_region, where the biasing is applied.
+  // the inelastic interactions of the selected particles (proton, neutron,
+  // pion+, pion-) happening in the logical volumes where the biasing is
+  // applied.
+  // The hadronic models are created once per thread and shared by the
+  // inelastic processes of all selected particles; the processes are
+  // created only for the particles added via AddParticle().
+  // (The Geant4 hadronic models keep the per-interaction state and so
+  // they cannot be shared between threads.)
  public:
   TG4BiasingOperation(G4String name);
   virtual ~TG4BiasingOperation();
+
+  static G4bool IsApplicable(const G4ParticleDefinition* particle);
+
+  G4bool AddParticle(const G4ParticleDefinition* particle);
+
   virtual G4VParticleChange* ApplyFinalStateBiasing(
     const G4BiasingProcessInterface*, const G4Track*, const G4Step*, G4bool&);
   // Unused :
@@ -48,10 +64,16 @@ class TG4BiasingOperation : public G4VBiasingOperation
   }
 
  private:
-  G4HadronInelasticProcess* fProtonInelasticProcess;
-  G4HadronInelasticProcess* fNeutronInelasticProcess;
-  G4HadronInelasticProcess* fPionPlusInelasticProcess;
-  G4HadronInelasticProcess* fPionMinusInelasticProcess;
+  G4VCrossSectionDataSet* CreateCrossSection(
+    const G4ParticleDefinition* particle) const;
+
+  // The models shared by all processes
+  G4HadronicInteraction* fHighEnergyModel;
+  G4HadronicInteraction* fInclxxModel;
+  G4HadronicInteraction* fBertiniModel;
+
+  // The inelastic processes per particle
+  std::map<const G4ParticleDefinition*, G4HadronInelasticProcess*> fProcesses;
 };
 
 #endif
@@ -16,6 +16,7 @@
 /// \author Alberto Ribon, CERN
 
 #include "G4VBiasingOperator.hh"
+#include <set>
 #include <vector>
 
 class G4ParticleDefinition;
@@ -23,16 +24,19 @@ class TG4BiasingOperation;
 
 class TG4BiasingOperator : public G4VBiasingOperator
 {
-  // When a proton, or neutron, or pion+ or pion- inelastic process occurs
+  // When an inelastic process of one of the selected particles occurs
   // (naturally, without any biasing) in the logical volume(s) where this
   // biasing operator has been attached to, this class uses the biasing "trick"
   // of calling FTFP+INCLXX instead of FTFP+BERT for determining the
   // final-state. Note that the weights of the produced secondaries are left to
   // their default values, 1.0.
+  // The biased processes are collected at the start of run, so that
+  // the proposal requires only a lookup of the calling process.
  public:
   TG4BiasingOperator();
   virtual ~TG4BiasingOperator() {}
   void AddParticle(G4String particleName);
+  virtual void StartRun();
   virtual G4VBiasingOperation* ProposeFinalStateBiasingOperation(
     const G4Track* track,
     const G4BiasingProcessInterface* callingProcess) final;
@@ -50,6 +54,7 @@ class TG4BiasingOperator : public G4VBiasingOperator
 
  private:
   std::vector<const G4ParticleDefinition*> fParticlesToBias;
+  std::set<const G4BiasingProcessInterface*> fBiasedProcesses;
   TG4BiasingOperation* fBiasingOperation;
 };
 
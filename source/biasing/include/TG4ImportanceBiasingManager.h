@@ -0,0 +1,141 @@
+#ifndef TG4_IMPORTANCE_BIASING_MANAGER_H
+#define TG4_IMPORTANCE_BIASING_MANAGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ImportanceBiasingManager.h
+/// \brief Definition of the TG4ImportanceBiasingManager class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4ImportanceBiasingMessenger.h"
+#include "TG4Verbose.h"
+
+#include <globals.hh>
+
+#include <map>
+#include <vector>
+
+class G4LogicalVolume;
+
+/// \ingroup physics_list
+/// \brief The geometry importance biasing manager.
+///
+/// The importances can be defined per volume or per tracking medium via
+/// the /mcPhysics/importance commands, or per tracking medium via
+/// TVirtualMC::Gstpar(itmed, "IMPORTANCE", value). The volume importance
+/// has a priority over the medium importance; the volumes without
+/// importance defined have the importance 1.
+///
+/// The importance biasing operator (see TG4ImportanceBiasingOperator)
+/// is created in each thread and attached to all logical volumes.
+/// It requires the "biasing" extra physics, which wraps the selected
+/// particles with the non-physics biasing process.
+///
+/// The track weight is available via TVirtualMC::TrackWeight() and the
+/// importance of the current volume via TG4StepManager::VolumeImportance().
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4ImportanceBiasingManager : public TG4Verbose
+{
+ public:
+  TG4ImportanceBiasingManager();
+  virtual ~TG4ImportanceBiasingManager();
+
+  // methods
+  void CreateImportanceOperator();
+
+  // set methods
+  void SetVolumeImportance(const G4String& volumeName, G4double importance);
+  void SetMediumImportance(const G4String& mediumName, G4double importance);
+  void SetMediumImportance(G4int mediumId, G4double importance);
+  void SetParticles(const G4String& particles);
+  void SetMaxSplitting(G4int maxSplitting);
+
+  // get methods
+  G4bool IsActive() const;
+  std::vector<G4String> GetParticles() const;
+
+ private:
+  /// Not implemented
+  TG4ImportanceBiasingManager(const TG4ImportanceBiasingManager& right);
+  /// Not implemented
+  TG4ImportanceBiasingManager& operator=(
+    const TG4ImportanceBiasingManager& right);
+
+  // methods
+  G4bool GetImportance(G4LogicalVolume* lv, G4double& importance) const;
+
+  // static data members
+  /// The default particles
+  static const G4String fgkDefaultParticles;
+  /// The default maximum splitting
+  static const G4int fgkDefaultMaxSplitting;
+
+  // data members
+  /// Messenger
+  TG4ImportanceBiasingMessenger fMessenger;
+  /// The importances per volume name
+  std::map<G4String, G4double> fVolumeImportances;
+  /// The importances per medium name
+  std::map<G4String, G4double> fMediumImportances;
+  /// The importances per medium Id
+  std::map<G4int, G4double> fMediumIdImportances;
+  /// The particles names
+  G4String fParticles;
+  /// The maximum number of track copies per split
+  G4int fMaxSplitting;
+};
+
+// inline functions
+
+inline void TG4ImportanceBiasingManager::SetVolumeImportance(
+  const G4String& volumeName, G4double importance)
+{
+  /// Set the importance to the volume with the given name
+  fVolumeImportances[volumeName] = importance;
+}
+
+inline void TG4ImportanceBiasingManager::SetMediumImportance(
+  const G4String& mediumName, G4double importance)
+{
+  /// Set the importance to the tracking medium with the given name
+  fMediumImportances[mediumName] = importance;
+}
+
+inline void TG4ImportanceBiasingManager::SetMediumImportance(
+  G4int mediumId, G4double importance)
+{
+  /// Set the importance to the tracking medium with the given Id
+  fMediumIdImportances[mediumId] = importance;
+}
+
+inline void TG4ImportanceBiasingManager::SetParticles(
+  const G4String& particles)
+{
+  /// Set the names of the particles to which the biasing is applied
+  fParticles = particles;
+}
+
+inline void TG4ImportanceBiasingManager::SetMaxSplitting(G4int maxSplitting)
+{
+  /// Set the maximum number of track copies per split
+  fMaxSplitting = maxSplitting;
+}
+
+inline G4bool TG4ImportanceBiasingManager::IsActive() const
+{
+  /// Return true if any importance is defined
+  return !fVolumeImportances.empty() || !fMediumImportances.empty() ||
+         !fMediumIdImportances.empty();
+}
+
+#endif // TG4_IMPORTANCE_BIASING_MANAGER_H
@@ -0,0 +1,84 @@
+#ifndef TG4_IMPORTANCE_BIASING_MESSENGER_H
+#define TG4_IMPORTANCE_BIASING_MESSENGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ImportanceBiasingMessenger.h
+/// \brief Definition of the TG4ImportanceBiasingMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class TG4ImportanceBiasingManager;
+
+class G4UIdirectory;
+class G4UIcommand;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+
+/// \ingroup physics_list
+/// \brief Messenger class that defines commands for the geometry importance
+///        biasing
+///
+/// Implements commands:
+/// - /mcPhysics/importance/setVolumeImportance volumeName importance
+/// - /mcPhysics/importance/setMediumImportance mediumName importance
+/// - /mcPhysics/importance/setParticles particleNames
+/// - /mcPhysics/importance/setMaxSplitting value
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4ImportanceBiasingMessenger : public G4UImessenger
+{
+ public:
+  TG4ImportanceBiasingMessenger(TG4ImportanceBiasingManager* manager);
+  virtual ~TG4ImportanceBiasingMessenger();
+
+  // methods
+  virtual void SetNewValue(G4UIcommand* command, G4String string);
+
+ private:
+  /// Not implemented
+  TG4ImportanceBiasingMessenger();
+  /// Not implemented
+  TG4ImportanceBiasingMessenger(const TG4ImportanceBiasingMessenger& right);
+  /// Not implemented
+  TG4ImportanceBiasingMessenger& operator=(
+    const TG4ImportanceBiasingMessenger& right);
+
+  // methods
+  G4UIcommand* CreateSetImportanceCmd(
+    const G4String& commandName, const G4String& objectName);
+
+  //
+  // data members
+
+  /// associated class
+  TG4ImportanceBiasingManager* fManager;
+
+  /// command directory
+  G4UIdirectory* fDirectory;
+
+  /// setVolumeImportance command
+  G4UIcommand* fSetVolumeImportanceCmd;
+
+  /// setMediumImportance command
+  G4UIcommand* fSetMediumImportanceCmd;
+
+  /// setParticles command
+  G4UIcmdWithAString* fSetParticlesCmd;
+
+  /// setMaxSplitting command
+  G4UIcmdWithAnInteger* fSetMaxSplittingCmd;
+};
+
+#endif // TG4_IMPORTANCE_BIASING_MESSENGER_H
@@ -0,0 +1,92 @@
+#ifndef TG4_IMPORTANCE_BIASING_OPERATION_H
+#define TG4_IMPORTANCE_BIASING_OPERATION_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ImportanceBiasingOperation.h
+/// \brief Definition of the TG4ImportanceBiasingOperation class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4ParticleChange.hh>
+#include <G4VBiasingOperation.hh>
+
+#include <unordered_map>
+
+class G4LogicalVolume;
+
+/// \ingroup physics_list
+/// \brief The geometry importance splitting and Russian roulette
+///
+/// The operation is applied when a track crosses the boundary between
+/// two volumes with different importances.
+/// If the importance ratio (post/pre) r is greater than 1, the track is
+/// split in n copies, where n is int(r) or int(r)+1 chosen randomly so that
+/// the mean number of copies is r; if r is less than 1, the track survives
+/// with the probability r (Russian roulette). In both cases the weight
+/// of the surviving tracks is divided by r. The tracks entering a volume
+/// with zero importance are killed. The number of copies is limited by
+/// the maximum splitting.
+///
+/// The volumes without importance defined have the importance 1.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4ImportanceBiasingOperation : public G4VBiasingOperation
+{
+ public:
+  TG4ImportanceBiasingOperation(const G4String& name, G4int maxSplitting);
+  virtual ~TG4ImportanceBiasingOperation();
+
+  // methods
+  virtual G4double DistanceToApplyOperation(
+    const G4Track* track, G4double previousStepSize,
+    G4ForceCondition* condition);
+  virtual G4VParticleChange* GenerateBiasingFinalState(
+    const G4Track* track, const G4Step* step);
+
+  /// Not used
+  virtual const G4VBiasingInteractionLaw* ProvideOccurenceBiasingInteractionLaw(
+    const G4BiasingProcessInterface*, G4ForceCondition&)
+  {
+    return 0;
+  }
+  /// Not used
+  virtual G4VParticleChange* ApplyFinalStateBiasing(
+    const G4BiasingProcessInterface*, const G4Track*, const G4Step*, G4bool&)
+  {
+    return 0;
+  }
+
+  // set methods
+  void SetImportance(const G4LogicalVolume* lv, G4double importance);
+
+  // get methods
+  G4double GetImportance(const G4LogicalVolume* lv) const;
+
+ private:
+  /// Not implemented
+  TG4ImportanceBiasingOperation();
+  /// Not implemented
+  TG4ImportanceBiasingOperation(const TG4ImportanceBiasingOperation& right);
+  /// Not implemented
+  TG4ImportanceBiasingOperation& operator=(
+    const TG4ImportanceBiasingOperation& right);
+
+  // data members
+  /// The particle change
+  G4ParticleChange fParticleChange;
+  /// The importances per logical volume
+  std::unordered_map<const G4LogicalVolume*, G4double> fImportances;
+  /// The maximum number of copies per split
+  G4int fMaxSplitting;
+};
+
+#endif // TG4_IMPORTANCE_BIASING_OPERATION_H
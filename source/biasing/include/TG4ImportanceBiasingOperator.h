@@ -0,0 +1,88 @@
+#ifndef TG4_IMPORTANCE_BIASING_OPERATOR_H
+#define TG4_IMPORTANCE_BIASING_OPERATOR_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ImportanceBiasingOperator.h
+/// \brief Definition of the TG4ImportanceBiasingOperator class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4VBiasingOperator.hh>
+
+#include <set>
+#include <unordered_map>
+
+class TG4ImportanceBiasingOperation;
+
+class G4LogicalVolume;
+class G4ParticleDefinition;
+
+/// \ingroup physics_list
+/// \brief The biasing operator for the geometry importance biasing
+///
+/// The operator proposes the importance splitting and Russian roulette
+/// operation (see TG4ImportanceBiasingOperation) for the selected particles.
+/// It is attached to all logical volumes, so that the boundary crossing
+/// is handled everywhere.
+///
+/// As only one operator can be attached to a logical volume, the occurence
+/// and final state biasing are delegated to the operator set via
+/// SetDelegateOperator() for the given volume.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4ImportanceBiasingOperator : public G4VBiasingOperator
+{
+ public:
+  TG4ImportanceBiasingOperator(G4int maxSplitting);
+  virtual ~TG4ImportanceBiasingOperator();
+
+  // static methods
+  static G4double GetImportance(const G4LogicalVolume* lv);
+
+  // methods
+  G4bool AddParticle(const G4String& particleName);
+
+  // set methods
+  void SetImportance(const G4LogicalVolume* lv, G4double importance);
+  void SetDelegateOperator(
+    const G4LogicalVolume* lv, G4VBiasingOperator* biasingOperator);
+
+ private:
+  /// Not implemented
+  TG4ImportanceBiasingOperator();
+  /// Not implemented
+  TG4ImportanceBiasingOperator(const TG4ImportanceBiasingOperator& right);
+  /// Not implemented
+  TG4ImportanceBiasingOperator& operator=(
+    const TG4ImportanceBiasingOperator& right);
+
+  // methods
+  virtual G4VBiasingOperation* ProposeNonPhysicsBiasingOperation(
+    const G4Track* track, const G4BiasingProcessInterface* callingProcess);
+  virtual G4VBiasingOperation* ProposeOccurenceBiasingOperation(
+    const G4Track* track, const G4BiasingProcessInterface* callingProcess);
+  virtual G4VBiasingOperation* ProposeFinalStateBiasingOperation(
+    const G4Track* track, const G4BiasingProcessInterface* callingProcess);
+
+  G4VBiasingOperator* GetDelegateOperator(const G4Track* track) const;
+
+  // data members
+  /// The splitting and Russian roulette operation
+  TG4ImportanceBiasingOperation* fOperation;
+  /// The particles to which the importance biasing is applied
+  std::set<const G4ParticleDefinition*> fParticles;
+  /// The operators to which the physics biasing is delegated per volume
+  std::unordered_map<const G4LogicalVolume*, G4VBiasingOperator*>
+    fDelegateOperators;
+};
+
+#endif // TG4_IMPORTANCE_BIASING_OPERATOR_H
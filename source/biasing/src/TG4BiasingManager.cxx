@@ -14,6 +14,8 @@
 
 #include "TG4BiasingManager.h"
 #include "TG4BiasingOperator.h"
+#include "TG4ImportanceBiasingOperator.h"
+#include "TG4MTProfiler.h"
 #include "TG4ModelConfiguration.h"
 
 #include <G4AnalysisUtilities.hh>
@@ -29,6 +31,10 @@ G4Mutex createBiasingOperatorMutex = G4MUTEX_INITIALIZER;
 } // namespace
 #endif
 
+// static data members
+const G4String TG4BiasingManager::fgkDefaultParticles =
+  "proton neutron pi+ pi-";
+
 //_____________________________________________________________________________
 TG4BiasingManager::TG4BiasingManager(
   const G4String& name, const G4String& availableModels)
@@ -73,7 +79,8 @@ void TG4BiasingManager::CreateBiasingOperator()
   SetRegionsNames();
 
 #ifdef G4MULTITHREADED
-  G4AutoLock lm(&createBiasingOperatorMutex);
+  G4AutoLock lm(&createBiasingOperatorMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "BiasingManager::CreateBiasingOperator");
 #endif
 
   // Get biasing "model" configuration
@@ -81,11 +88,7 @@ void TG4BiasingManager::CreateBiasingOperator()
   TG4ModelConfiguration* modelConfiguration = GetVector().at(0);
 
   // Get particles as a vector
-  std::vector<G4String> particlesVector;
-  if (modelConfiguration->GetParticles().size()) {
-    // use analysis utility to tokenize regions
-    G4Analysis::Tokenize(modelConfiguration->GetParticles(), particlesVector);
-  }
+  std::vector<G4String> particlesVector = GetParticles();
 
   // Create biasingOperator
   TG4BiasingOperator* biasingOperator = new TG4BiasingOperator();
@@ -115,8 +118,16 @@ void TG4BiasingManager::CreateBiasingOperator()
       continue;
     }
 
-    // Attach biasing operator to the logical volume
-    biasingOperator->AttachTo(lv);
+    // Attach biasing operator to the logical volume,
+    // or delegate to it from the importance biasing operator
+    auto importanceOperator = dynamic_cast<TG4ImportanceBiasingOperator*>(
+      G4VBiasingOperator::GetBiasingOperator(lv));
+    if (importanceOperator) {
+      importanceOperator->SetDelegateOperator(lv, biasingOperator);
+    }
+    else {
+      biasingOperator->AttachTo(lv);
+    }
 
     if (VerboseLevel() > 1) {
       G4cout << "Biasing operator attached to lv " << lv->GetName() << G4endl;
@@ -126,3 +137,22 @@ void TG4BiasingManager::CreateBiasingOperator()
   lm.unlock();
 #endif
 }
+
+//_____________________________________________________________________________
+std::vector<G4String> TG4BiasingManager::GetParticles() const
+{
+  /// Return the names of the particles selected for biasing;
+  /// the default particles are returned if no particles are selected
+
+  G4String particles = fgkDefaultParticles;
+  if (GetVector().size() && GetVector().at(0)->GetParticles().size() &&
+      GetVector().at(0)->GetParticles() != "all") {
+    particles = GetVector().at(0)->GetParticles();
+  }
+
+  // use analysis utility to tokenize particles
+  std::vector<G4String> particlesVector;
+  G4Analysis::Tokenize(particles, particlesVector);
+
+  return particlesVector;
+}
@@ -36,25 +36,22 @@
 #include "G4HadronicParameters.hh"
 #include "G4INCLXXInterface.hh"
 #include "G4LundStringFragmentation.hh"
+#include "G4Neutron.hh"
 #include "G4NeutronInelasticXS.hh"
+#include "G4PionMinus.hh"
+#include "G4PionPlus.hh"
+#include "G4Proton.hh"
 #include "G4TheoFSGenerator.hh"
 #include "G4VParticleChange.hh"
 #include "G4CrossSectionDataStore.hh"
 
 TG4BiasingOperation::TG4BiasingOperation(G4String name)
-  : G4VBiasingOperation(name)
+  : G4VBiasingOperation(name),
+    fHighEnergyModel(0),
+    fInclxxModel(0),
+    fBertiniModel(0),
+    fProcesses()
 {
-
-  // Create the inelastic processes for  p , n , pi+ , pi-
-  fProtonInelasticProcess =
-    new G4HadronInelasticProcess("protonInelastic", G4Proton::Definition());
-  fNeutronInelasticProcess =
-    new G4HadronInelasticProcess("neutronInelastic", G4Neutron::Definition());
-  fPionPlusInelasticProcess =
-    new G4HadronInelasticProcess("pi+Inelastic", G4PionPlus::Definition());
-  fPionMinusInelasticProcess =
-    new G4HadronInelasticProcess("pi-Inelastic", G4PionMinus::Definition());
-
   // Set the energy ranges
   const G4double maxBERT = 41.0 * CLHEP::MeV;
   const G4double minINCLXX = 40.0 * CLHEP::MeV;
@@ -67,6 +64,7 @@ TG4BiasingOperation::TG4BiasingOperation(G4String name)
   // Notice that it is better to create the models here from scratch,
   // instead of reusing the existing ones, because we might pick up the
   // existing ones associated to the wrong particles...
+  // The models are registered in all processes created in AddParticle().
   // --- FTFP model ---
   G4FTFModel* theStringModel = new G4FTFModel;
   G4LundStringFragmentation* theLund = new G4LundStringFragmentation;
@@ -79,88 +77,87 @@ TG4BiasingOperation::TG4BiasingOperation(G4String name)
   theHighEnergyModel->SetTransport(thePrecoInterface);
   theHighEnergyModel->SetMinEnergy(minFTFP);
   theHighEnergyModel->SetMaxEnergy(maxFTFP);
+  fHighEnergyModel = theHighEnergyModel;
   // Bertini : create a new model to be used below INCLXX limit
-  G4CascadeInterface* theBertiniModel = new G4CascadeInterface();
-  theBertiniModel->SetMinEnergy(0.0);
-  theBertiniModel->SetMaxEnergy(maxBERT);
+  fBertiniModel = new G4CascadeInterface();
+  fBertiniModel->SetMinEnergy(0.0);
+  fBertiniModel->SetMaxEnergy(maxBERT);
   // --- INCLXX model ---
-  G4INCLXXInterface* theInclxxModel = new G4INCLXXInterface();
-  theInclxxModel->SetMinEnergy(minINCLXX);
-  theInclxxModel->SetMaxEnergy(maxINCLXX);
+  fInclxxModel = new G4INCLXXInterface();
+  fInclxxModel->SetMinEnergy(minINCLXX);
+  fInclxxModel->SetMaxEnergy(maxINCLXX);
+}
 
-  // Register the models
-  fProtonInelasticProcess->RegisterMe(theHighEnergyModel);
-  fProtonInelasticProcess->RegisterMe(theInclxxModel);
-  fProtonInelasticProcess->RegisterMe(theBertiniModel);
-  fNeutronInelasticProcess->RegisterMe(theHighEnergyModel);
-  fNeutronInelasticProcess->RegisterMe(theInclxxModel);
-  fNeutronInelasticProcess->RegisterMe(theBertiniModel);
-  fPionPlusInelasticProcess->RegisterMe(theHighEnergyModel);
-  fPionPlusInelasticProcess->RegisterMe(theInclxxModel);
-  fPionPlusInelasticProcess->RegisterMe(theBertiniModel);
-  fPionMinusInelasticProcess->RegisterMe(theHighEnergyModel);
-  fPionMinusInelasticProcess->RegisterMe(theInclxxModel);
-  fPionMinusInelasticProcess->RegisterMe(theBertiniModel);
-
-  // Register the cross sections: this is mandatory starting from G4 10.6
+TG4BiasingOperation::~TG4BiasingOperation() {}
+
+G4bool TG4BiasingOperation::IsApplicable(const G4ParticleDefinition* particle)
+{
+  // Return true if the final-state replacement is applicable to the given
+  // particle: the INCLXX model covers only nucleons and pions in its
+  // energy range (40 MeV - 12 GeV)
+
+  return particle == G4Proton::Definition() ||
+         particle == G4Neutron::Definition() ||
+         particle == G4PionPlus::Definition() ||
+         particle == G4PionMinus::Definition();
+}
+
+G4VCrossSectionDataSet* TG4BiasingOperation::CreateCrossSection(
+  const G4ParticleDefinition* particle) const
+{
+  // Create the inelastic cross section for the given particle.
+  // Registering the cross sections is mandatory starting from G4 10.6
   // because the default Gheisha inelastic cross sections have been removed.
-  // It is convenient to use the Gheisha inelastic cross sections here
-  // because they do not require any special initialization.
-  G4VCrossSectionDataSet* theProtonXSdata =
-    new G4BGGNucleonInelasticXS(G4Proton::Definition());
-  theProtonXSdata->BuildPhysicsTable(*(G4Proton::Definition()));
-  fProtonInelasticProcess->AddDataSet(theProtonXSdata);
-  G4VCrossSectionDataSet* theNeutronXSdata = new G4NeutronInelasticXS;
-  theNeutronXSdata->BuildPhysicsTable(*(G4Neutron::Definition()));
-  fNeutronInelasticProcess->AddDataSet(theNeutronXSdata);
-  G4VCrossSectionDataSet* thePionPlusXSdata =
-    new G4BGGPionInelasticXS(G4PionPlus::Definition());
-  thePionPlusXSdata->BuildPhysicsTable(*(G4PionPlus::Definition()));
-  fPionPlusInelasticProcess->AddDataSet(thePionPlusXSdata);
-  G4VCrossSectionDataSet* thePionMinusXSdata =
-    new G4BGGPionInelasticXS(G4PionMinus::Definition());
-  thePionMinusXSdata->BuildPhysicsTable(*(G4PionMinus::Definition()));
-  fPionMinusInelasticProcess->AddDataSet(thePionMinusXSdata);
+  // The cross sections data are kept in the static tables of the cross
+  // section classes, which are built once and shared by all threads.
+
+  if (particle == G4Neutron::Definition()) {
+    return new G4NeutronInelasticXS;
+  }
+  if (particle == G4Proton::Definition()) {
+    return new G4BGGNucleonInelasticXS(particle);
+  }
+  return new G4BGGPionInelasticXS(particle);
 }
 
-TG4BiasingOperation::~TG4BiasingOperation() {}
+G4bool TG4BiasingOperation::AddParticle(const G4ParticleDefinition* particle)
+{
+  // Create the inelastic process with the FTFP+INCLXX models
+  // for the given particle
+
+  if (!IsApplicable(particle)) return false;
+  if (fProcesses.find(particle) != fProcesses.end()) return true;
+
+  G4HadronInelasticProcess* process = new G4HadronInelasticProcess(
+    particle->GetParticleName() + "Inelastic", particle);
+
+  // Register the models
+  process->RegisterMe(fHighEnergyModel);
+  process->RegisterMe(fInclxxModel);
+  process->RegisterMe(fBertiniModel);
+
+  // Register the cross sections
+  G4VCrossSectionDataSet* xsData = CreateCrossSection(particle);
+  xsData->BuildPhysicsTable(*particle);
+  process->AddDataSet(xsData);
+
+  fProcesses[particle] = process;
+  return true;
+}
 
 G4VParticleChange* TG4BiasingOperation::ApplyFinalStateBiasing(
   const G4BiasingProcessInterface*, const G4Track* track, const G4Step* step,
   G4bool&)
 {
-  if (track->GetParticleDefinition() == G4Proton::Definition()) {
-     auto particle = track->GetDynamicParticle();
-     auto material = track->GetMaterial();
-     fProtonInelasticProcess->GetCrossSectionDataStore( )
-       ->ComputeCrossSection(particle, material);
-    return fProtonInelasticProcess->PostStepDoIt(*track, *step);
-  }
-  else if (track->GetParticleDefinition() == G4Neutron::Definition()) {
-     auto particle = track->GetDynamicParticle();
-     auto material = track->GetMaterial();
-     fNeutronInelasticProcess->GetCrossSectionDataStore( )
-       ->ComputeCrossSection(particle, material);
-    return fNeutronInelasticProcess->PostStepDoIt(*track, *step);
-  }
-  else if (track->GetParticleDefinition() == G4PionPlus::Definition()) {
-     auto particle = track->GetDynamicParticle();
-     auto material = track->GetMaterial();
-     fPionPlusInelasticProcess->GetCrossSectionDataStore( )
-       ->ComputeCrossSection(particle, material);
-    return fPionPlusInelasticProcess->PostStepDoIt(*track, *step);
-  }
-  else if (track->GetParticleDefinition() == G4PionMinus::Definition()) {
-     auto particle = track->GetDynamicParticle();
-     auto material = track->GetMaterial();
-     fPionMinusInelasticProcess->GetCrossSectionDataStore( )
-       ->ComputeCrossSection(particle, material);
-    return fPionMinusInelasticProcess->PostStepDoIt(*track, *step);
-  }
-  else {
+  auto it = fProcesses.find(track->GetParticleDefinition());
+  if (it == fProcesses.end()) {
     G4cerr << "ERROR in TG4BiasingOperation::ApplyFinalStateBiasing : "
               "unexpected particle = "
            << track->GetParticleDefinition()->GetParticleName() << G4endl;
     return 0;
   }
+
+  it->second->GetCrossSectionDataStore()->ComputeCrossSection(
+    track->GetDynamicParticle(), track->GetMaterial());
+  return it->second->PostStepDoIt(*track, *step);
 }
@@ -16,10 +16,17 @@
 #include "TG4BiasingOperation.h"
 
 #include "G4BiasingProcessInterface.hh"
+#include "G4HadronicProcessType.hh"
 #include "G4ParticleDefinition.hh"
 #include "G4ParticleTable.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
 
-TG4BiasingOperator::TG4BiasingOperator() : G4VBiasingOperator("BiasingOperator")
+TG4BiasingOperator::TG4BiasingOperator()
+  : G4VBiasingOperator("BiasingOperator"),
+    fParticlesToBias(),
+    fBiasedProcesses(),
+    fBiasingOperation(0)
 {
   fBiasingOperation = new TG4BiasingOperation("BiasingOperation");
 }
@@ -35,39 +42,49 @@ void TG4BiasingOperator::AddParticle(G4String particleName)
       "TG4BiasingOperator::AddParticle(...)", "BiasError", JustWarning, ed);
     return;
   }
+  if (!fBiasingOperation->AddParticle(particle)) {
+    G4ExceptionDescription ed;
+    ed << "Biasing is not applicable to particle `" << particleName << "' !"
+       << G4endl;
+    G4Exception(
+      "TG4BiasingOperator::AddParticle(...)", "BiasError", JustWarning, ed);
+    return;
+  }
   fParticlesToBias.push_back(particle);
 }
 
-G4VBiasingOperation* TG4BiasingOperator::ProposeFinalStateBiasingOperation(
-  const G4Track*, const G4BiasingProcessInterface* callingProcess)
+void TG4BiasingOperator::StartRun()
 {
+  // Collect the biasing wrappers of the inelastic processes
+  // of the selected particles
 
-  // G4cout << "In TG4BiasingOperator::ProposeFinalStateTG4BiasingOperation "
-  //        << " calling process: " << callingProcess
-  //        << " wrapper process: " << callingProcess->GetWrappedProcess();
-  // if ( callingProcess->GetWrappedProcess() ) {
-  //   G4cout << " wrapper process name: " <<
-  //   callingProcess->GetWrappedProcess()->GetProcessName();
-  // }
-  // G4cout << G4endl;
+  fBiasedProcesses.clear();
+  for (auto particle : fParticlesToBias) {
+    G4ProcessManager* processManager = particle->GetProcessManager();
+    if (!processManager) continue;
 
-  // Apply the biasing operation only for inelastic processes of:
-  // proton, neutron, pion+ and pion-
-  if (callingProcess && callingProcess->GetWrappedProcess() &&
-      (callingProcess->GetWrappedProcess()->GetProcessName() ==
-          "protonInelastic" ||
-        callingProcess->GetWrappedProcess()->GetProcessName() ==
-          "neutronInelastic" ||
-        callingProcess->GetWrappedProcess()->GetProcessName() ==
-          "pi+Inelastic" ||
-        callingProcess->GetWrappedProcess()->GetProcessName() ==
-          "pi-Inelastic")) {
-    // G4cout << "In TG4BiasingOperator: Returning " << fBiasingOperation <<
-    // G4endl;
-    return fBiasingOperation;
+    G4ProcessVector* processVector = processManager->GetProcessList();
+    for (std::size_t i = 0; i < processVector->length(); ++i) {
+      auto biasingProcess =
+        dynamic_cast<G4BiasingProcessInterface*>((*processVector)[i]);
+      if (!biasingProcess) continue;
+
+      auto wrappedProcess = biasingProcess->GetWrappedProcess();
+      if (wrappedProcess && wrappedProcess->GetProcessType() == fHadronic &&
+          wrappedProcess->GetProcessSubType() == fHadronInelastic) {
+        fBiasedProcesses.insert(biasingProcess);
+      }
+    }
   }
-  else {
-    // G4cout << "In TG4BiasingOperator: Returning 0 " << G4endl;
-    return 0;
+}
+
+G4VBiasingOperation* TG4BiasingOperator::ProposeFinalStateBiasingOperation(
+  const G4Track*, const G4BiasingProcessInterface* callingProcess)
+{
+  // Apply the biasing operation only for the inelastic processes
+  // of the selected particles
+  if (fBiasedProcesses.find(callingProcess) != fBiasedProcesses.end()) {
+    return fBiasingOperation;
   }
+  return 0;
 }
@@ -0,0 +1,159 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ImportanceBiasingManager.cxx
+/// \brief Implementation of the TG4ImportanceBiasingManager class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4ImportanceBiasingManager.h"
+#include "TG4GeometryServices.h"
+#include "TG4ImportanceBiasingOperator.h"
+#include "TG4MTProfiler.h"
+#include "TG4Medium.h"
+#include "TG4MediumMap.h"
+
+#include <G4AnalysisUtilities.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+
+#ifdef G4MULTITHREADED
+namespace
+{
+// Mutex to lock creating importance operator
+G4Mutex createImportanceOperatorMutex = G4MUTEX_INITIALIZER;
+} // namespace
+#endif
+
+// static data members
+const G4String TG4ImportanceBiasingManager::fgkDefaultParticles =
+  "neutron gamma";
+const G4int TG4ImportanceBiasingManager::fgkDefaultMaxSplitting = 100;
+
+//_____________________________________________________________________________
+TG4ImportanceBiasingManager::TG4ImportanceBiasingManager()
+  : TG4Verbose("importanceBiasing"),
+    fMessenger(this),
+    fVolumeImportances(),
+    fMediumImportances(),
+    fMediumIdImportances(),
+    fParticles(fgkDefaultParticles),
+    fMaxSplitting(fgkDefaultMaxSplitting)
+{
+  /// Default constructor
+}
+
+//_____________________________________________________________________________
+TG4ImportanceBiasingManager::~TG4ImportanceBiasingManager()
+{
+  /// Destructor
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+G4bool TG4ImportanceBiasingManager::GetImportance(
+  G4LogicalVolume* lv, G4double& importance) const
+{
+  /// Get the importance defined for the given logical volume via its name
+  /// or its tracking medium; return false if no importance is defined
+
+  auto itv = fVolumeImportances.find(lv->GetName());
+  if (itv != fVolumeImportances.end()) {
+    importance = itv->second;
+    return true;
+  }
+
+  TG4Medium* medium =
+    TG4GeometryServices::Instance()->GetMediumMap()->GetMedium(lv, false);
+  if (!medium) return false;
+
+  auto itid = fMediumIdImportances.find(medium->GetID());
+  if (itid != fMediumIdImportances.end()) {
+    importance = itid->second;
+    return true;
+  }
+
+  auto itm = fMediumImportances.find(medium->GetName());
+  if (itm != fMediumImportances.end()) {
+    importance = itm->second;
+    return true;
+  }
+
+  return false;
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4ImportanceBiasingManager::CreateImportanceOperator()
+{
+  /// Create the importance biasing operator and attach it to all
+  /// logical volumes
+
+  if (!IsActive()) return;
+
+  if (VerboseLevel() > 1) {
+    G4cout << "TG4ImportanceBiasingManager::CreateImportanceOperator"
+           << G4endl;
+  }
+
+#ifdef G4MULTITHREADED
+  G4AutoLock lm(&createImportanceOperatorMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "ImportanceBiasingManager::CreateImportanceOperator");
+#endif
+
+  auto importanceOperator = new TG4ImportanceBiasingOperator(fMaxSplitting);
+
+  for (const auto& particleName : GetParticles()) {
+    importanceOperator->AddParticle(particleName);
+  }
+
+  G4int nofImportances = 0;
+  G4LogicalVolumeStore* lvStore = G4LogicalVolumeStore::GetInstance();
+  for (auto lv : *lvStore) {
+    G4double importance;
+    if (GetImportance(lv, importance)) {
+      importanceOperator->SetImportance(lv, importance);
+      ++nofImportances;
+
+      if (VerboseLevel() > 2) {
+        G4cout << "Importance " << importance << " set to lv "
+               << lv->GetName() << G4endl;
+      }
+    }
+    importanceOperator->AttachTo(lv);
+  }
+
+  if (VerboseLevel() > 0) {
+    G4cout << "Importance biasing operator attached to " << lvStore->size()
+           << " volumes, importance defined in " << nofImportances
+           << " volumes" << G4endl;
+  }
+
+#ifdef G4MULTITHREADED
+  lm.unlock();
+#endif
+}
+
+//_____________________________________________________________________________
+std::vector<G4String> TG4ImportanceBiasingManager::GetParticles() const
+{
+  /// Return the names of the particles to which the biasing is applied
+
+  // use analysis utility to tokenize particles
+  std::vector<G4String> particlesVector;
+  G4Analysis::Tokenize(fParticles, particlesVector);
+
+  return particlesVector;
+}
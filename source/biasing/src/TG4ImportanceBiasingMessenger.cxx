@@ -0,0 +1,133 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ImportanceBiasingMessenger.cxx
+/// \brief Implementation of the TG4ImportanceBiasingMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4ImportanceBiasingMessenger.h"
+#include "TG4ImportanceBiasingManager.h"
+
+#include <G4AnalysisUtilities.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIcommand.hh>
+#include <G4UIdirectory.hh>
+#include <G4UIparameter.hh>
+
+//______________________________________________________________________________
+TG4ImportanceBiasingMessenger::TG4ImportanceBiasingMessenger(
+  TG4ImportanceBiasingManager* manager)
+  : G4UImessenger(),
+    fManager(manager),
+    fDirectory(0),
+    fSetVolumeImportanceCmd(0),
+    fSetMediumImportanceCmd(0),
+    fSetParticlesCmd(0),
+    fSetMaxSplittingCmd(0)
+{
+  /// Standard constructor
+
+  fDirectory = new G4UIdirectory("/mcPhysics/importance/");
+  fDirectory->SetGuidance("Geometry importance biasing commands.");
+
+  fSetVolumeImportanceCmd = CreateSetImportanceCmd(
+    "/mcPhysics/importance/setVolumeImportance", "volume");
+  fSetMediumImportanceCmd = CreateSetImportanceCmd(
+    "/mcPhysics/importance/setMediumImportance", "medium");
+
+  fSetParticlesCmd =
+    new G4UIcmdWithAString("/mcPhysics/importance/setParticles", this);
+  fSetParticlesCmd->SetGuidance(
+    "Set the particles to which the importance biasing is applied.");
+  fSetParticlesCmd->SetParameterName("Particles", false);
+  fSetParticlesCmd->AvailableForStates(G4State_PreInit);
+  fSetParticlesCmd->SetToBeBroadcasted(false);
+
+  fSetMaxSplittingCmd =
+    new G4UIcmdWithAnInteger("/mcPhysics/importance/setMaxSplitting", this);
+  fSetMaxSplittingCmd->SetGuidance(
+    "Set the maximum number of track copies created in one split.");
+  fSetMaxSplittingCmd->SetParameterName("MaxSplitting", false);
+  fSetMaxSplittingCmd->SetRange("MaxSplitting > 0");
+  fSetMaxSplittingCmd->AvailableForStates(G4State_PreInit);
+  fSetMaxSplittingCmd->SetToBeBroadcasted(false);
+}
+
+//______________________________________________________________________________
+TG4ImportanceBiasingMessenger::~TG4ImportanceBiasingMessenger()
+{
+  /// Destructor
+
+  delete fDirectory;
+  delete fSetVolumeImportanceCmd;
+  delete fSetMediumImportanceCmd;
+  delete fSetParticlesCmd;
+  delete fSetMaxSplittingCmd;
+}
+
+//
+// private methods
+//
+
+//______________________________________________________________________________
+G4UIcommand* TG4ImportanceBiasingMessenger::CreateSetImportanceCmd(
+  const G4String& commandName, const G4String& objectName)
+{
+  /// Create the command for setting the importance to a volume or medium
+
+  auto name = new G4UIparameter((objectName + "Name").c_str(), 's', false);
+  name->SetGuidance(("The " + objectName + " name.").c_str());
+
+  auto importance = new G4UIparameter("importance", 'd', false);
+  importance->SetGuidance("The importance value (0 = kill).");
+  importance->SetParameterRange("importance >= 0");
+
+  auto command = new G4UIcommand(commandName, this);
+  command->SetGuidance(("Set the importance to the " + objectName).c_str());
+  command->SetParameter(name);
+  command->SetParameter(importance);
+  command->AvailableForStates(G4State_PreInit);
+  command->SetToBeBroadcasted(false);
+
+  return command;
+}
+
+//
+// public methods
+//
+
+//______________________________________________________________________________
+void TG4ImportanceBiasingMessenger::SetNewValue(
+  G4UIcommand* command, G4String newValue)
+{
+  /// Apply command to the associated object.
+
+  if (command == fSetVolumeImportanceCmd ||
+      command == fSetMediumImportanceCmd) {
+    // tokenize parameters in a vector
+    std::vector<G4String> parameters;
+    G4Analysis::Tokenize(newValue, parameters);
+
+    G4double importance = G4UIcommand::ConvertToDouble(parameters[1]);
+    if (command == fSetVolumeImportanceCmd) {
+      fManager->SetVolumeImportance(parameters[0], importance);
+    }
+    else {
+      fManager->SetMediumImportance(parameters[0], importance);
+    }
+  }
+  else if (command == fSetParticlesCmd) {
+    fManager->SetParticles(newValue);
+  }
+  else if (command == fSetMaxSplittingCmd) {
+    fManager->SetMaxSplitting(fSetMaxSplittingCmd->GetNewIntValue(newValue));
+  }
+}
@@ -0,0 +1,143 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ImportanceBiasingOperation.cxx
+/// \brief Implementation of the TG4ImportanceBiasingOperation class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4ImportanceBiasingOperation.h"
+
+#include <G4LogicalVolume.hh>
+#include <G4Step.hh>
+#include <G4Track.hh>
+#include <G4VPhysicalVolume.hh>
+#include <Randomize.hh>
+
+#include <algorithm>
+
+//_____________________________________________________________________________
+TG4ImportanceBiasingOperation::TG4ImportanceBiasingOperation(
+  const G4String& name, G4int maxSplitting)
+  : G4VBiasingOperation(name),
+    fParticleChange(),
+    fImportances(),
+    fMaxSplitting(maxSplitting)
+{
+  /// Standard constructor
+}
+
+//_____________________________________________________________________________
+TG4ImportanceBiasingOperation::~TG4ImportanceBiasingOperation()
+{
+  /// Destructor
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+G4double TG4ImportanceBiasingOperation::DistanceToApplyOperation(
+  const G4Track* /*track*/, G4double /*previousStepSize*/,
+  G4ForceCondition* condition)
+{
+  /// Force the operation at each step; the final state is changed
+  /// only at the volume boundaries
+
+  *condition = Forced;
+  return DBL_MAX;
+}
+
+//_____________________________________________________________________________
+G4VParticleChange* TG4ImportanceBiasingOperation::GenerateBiasingFinalState(
+  const G4Track* track, const G4Step* step)
+{
+  /// Split or play Russian roulette with the track entering a volume
+  /// with a different importance; the first step of a track, starting
+  /// on a boundary, is not considered
+
+  fParticleChange.Initialize(*track);
+
+  G4StepPoint* postStepPoint = step->GetPostStepPoint();
+  if (postStepPoint->GetStepStatus() != fGeomBoundary ||
+      !postStepPoint->GetPhysicalVolume() ||
+      track->GetCurrentStepNumber() == 1) {
+    return &fParticleChange;
+  }
+
+  G4double preImportance = GetImportance(
+    step->GetPreStepPoint()->GetPhysicalVolume()->GetLogicalVolume());
+  G4double postImportance =
+    GetImportance(postStepPoint->GetPhysicalVolume()->GetLogicalVolume());
+
+  if (postImportance == preImportance || preImportance <= 0.) {
+    return &fParticleChange;
+  }
+
+  if (postImportance <= 0.) {
+    fParticleChange.ProposeTrackStatus(fStopAndKill);
+    return &fParticleChange;
+  }
+
+  G4double ratio = postImportance / preImportance;
+  G4double weight = track->GetWeight();
+
+  if (ratio < 1.) {
+    // Russian roulette
+    if (G4UniformRand() > ratio) {
+      fParticleChange.ProposeTrackStatus(fStopAndKill);
+    }
+    else {
+      fParticleChange.ProposeWeight(weight / ratio);
+    }
+    return &fParticleChange;
+  }
+
+  // Splitting
+  ratio = std::min(ratio, G4double(fMaxSplitting));
+  G4int nofCopies = G4int(ratio);
+  if (G4UniformRand() < ratio - nofCopies) ++nofCopies;
+
+  G4double newWeight = weight / ratio;
+  fParticleChange.ProposeWeight(newWeight);
+  fParticleChange.SetSecondaryWeightByProcess(true);
+  fParticleChange.SetNumberOfSecondaries(nofCopies - 1);
+  for (G4int i = 1; i < nofCopies; ++i) {
+    // the clone keeps the track properties and starts in the entered volume
+    G4Track* clone = new G4Track(*track);
+    clone->SetWeight(newWeight);
+    clone->SetTouchableHandle(postStepPoint->GetTouchableHandle());
+    fParticleChange.AddSecondary(clone);
+  }
+
+  return &fParticleChange;
+}
+
+//_____________________________________________________________________________
+void TG4ImportanceBiasingOperation::SetImportance(
+  const G4LogicalVolume* lv, G4double importance)
+{
+  /// Set the importance to the given logical volume
+
+  fImportances[lv] = importance;
+}
+
+//_____________________________________________________________________________
+G4double TG4ImportanceBiasingOperation::GetImportance(
+  const G4LogicalVolume* lv) const
+{
+  /// Return the importance of the given logical volume
+  /// (1 if the importance was not set)
+
+  auto it = fImportances.find(lv);
+  if (it == fImportances.end()) return 1.;
+
+  return it->second;
+}
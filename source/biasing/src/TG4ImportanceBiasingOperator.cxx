@@ -0,0 +1,164 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ImportanceBiasingOperator.cxx
+/// \brief Implementation of the TG4ImportanceBiasingOperator class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4ImportanceBiasingOperator.h"
+#include "TG4Globals.h"
+#include "TG4ImportanceBiasingOperation.h"
+
+#include <G4LogicalVolume.hh>
+#include <G4ParticleDefinition.hh>
+#include <G4ParticleTable.hh>
+#include <G4Track.hh>
+#include <G4VPhysicalVolume.hh>
+
+//_____________________________________________________________________________
+TG4ImportanceBiasingOperator::TG4ImportanceBiasingOperator(G4int maxSplitting)
+  : G4VBiasingOperator("ImportanceBiasingOperator"),
+    fOperation(0),
+    fParticles(),
+    fDelegateOperators()
+{
+  /// Standard constructor
+
+  fOperation = new TG4ImportanceBiasingOperation(
+    "ImportanceBiasingOperation", maxSplitting);
+}
+
+//_____________________________________________________________________________
+TG4ImportanceBiasingOperator::~TG4ImportanceBiasingOperator()
+{
+  /// Destructor
+
+  delete fOperation;
+}
+
+//
+// static methods
+//
+
+//_____________________________________________________________________________
+G4double TG4ImportanceBiasingOperator::GetImportance(
+  const G4LogicalVolume* lv)
+{
+  /// Return the importance of the given logical volume
+  /// (1 if the importance biasing is not applied)
+
+  auto importanceOperator = dynamic_cast<TG4ImportanceBiasingOperator*>(
+    G4VBiasingOperator::GetBiasingOperator(lv));
+  if (!importanceOperator) return 1.;
+
+  return importanceOperator->fOperation->GetImportance(lv);
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+G4VBiasingOperator* TG4ImportanceBiasingOperator::GetDelegateOperator(
+  const G4Track* track) const
+{
+  /// Return the operator to which the physics biasing is delegated
+  /// in the current track volume
+
+  if (fDelegateOperators.empty()) return 0;
+
+  auto it = fDelegateOperators.find(track->GetVolume()->GetLogicalVolume());
+  if (it == fDelegateOperators.end()) return 0;
+
+  return it->second;
+}
+
+//_____________________________________________________________________________
+G4VBiasingOperation*
+TG4ImportanceBiasingOperator::ProposeNonPhysicsBiasingOperation(
+  const G4Track* track, const G4BiasingProcessInterface* /*callingProcess*/)
+{
+  /// Return the splitting and Russian roulette operation
+  /// for the selected particles
+
+  if (fParticles.find(track->GetParticleDefinition()) == fParticles.end()) {
+    return 0;
+  }
+
+  return fOperation;
+}
+
+//_____________________________________________________________________________
+G4VBiasingOperation*
+TG4ImportanceBiasingOperator::ProposeOccurenceBiasingOperation(
+  const G4Track* track, const G4BiasingProcessInterface* callingProcess)
+{
+  /// Delegate the occurence biasing to the volume operator, if defined
+
+  G4VBiasingOperator* delegateOperator = GetDelegateOperator(track);
+  if (!delegateOperator) return 0;
+
+  return delegateOperator->GetProposedOccurenceBiasingOperation(
+    track, callingProcess);
+}
+
+//_____________________________________________________________________________
+G4VBiasingOperation*
+TG4ImportanceBiasingOperator::ProposeFinalStateBiasingOperation(
+  const G4Track* track, const G4BiasingProcessInterface* callingProcess)
+{
+  /// Delegate the final state biasing to the volume operator, if defined
+
+  G4VBiasingOperator* delegateOperator = GetDelegateOperator(track);
+  if (!delegateOperator) return 0;
+
+  return delegateOperator->GetProposedFinalStateBiasingOperation(
+    track, callingProcess);
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+G4bool TG4ImportanceBiasingOperator::AddParticle(const G4String& particleName)
+{
+  /// Add the particle to which the importance biasing is applied
+
+  const G4ParticleDefinition* particle =
+    G4ParticleTable::GetParticleTable()->FindParticle(particleName);
+  if (!particle) {
+    TG4Globals::Warning("TG4ImportanceBiasingOperator", "AddParticle",
+      "Particle " + TString(particleName.data()) + " not found.");
+    return false;
+  }
+
+  fParticles.insert(particle);
+  return true;
+}
+
+//_____________________________________________________________________________
+void TG4ImportanceBiasingOperator::SetImportance(
+  const G4LogicalVolume* lv, G4double importance)
+{
+  /// Set the importance to the given logical volume
+
+  fOperation->SetImportance(lv, importance);
+}
+
+//_____________________________________________________________________________
+void TG4ImportanceBiasingOperator::SetDelegateOperator(
+  const G4LogicalVolume* lv, G4VBiasingOperator* biasingOperator)
+{
+  /// Set the operator to which the physics biasing is delegated
+  /// in the given logical volume
+
+  fDelegateOperators[lv] = biasingOperator;
+}
@@ -18,13 +18,27 @@
 #include "G4VGFlashSensitiveDetector.hh"
 #include "TG4SensitiveDetector.h"
 
+#include <G4ThreeVector.hh>
+#include <G4TouchableHandle.hh>
 #include <globals.hh>
 
+#include <map>
+#include <vector>
+
 class G4GFlashSpot;
+class G4FastTrack;
+class G4VPhysicalVolume;
 
 /// \ingroup digits_hits
 /// \brief Sensitive detector with Gflash
 ///
+/// In the default mode, each Gflash spot is passed to the user stepping.
+/// When the spots aggregation is activated, the spots are binned per
+/// (sensitive volume, copy numbers) cell in a per-thread buffer and only
+/// one aggregated deposit per cell, with the energy weighted position,
+/// is passed to the user stepping when the shower track is finished
+/// (see FlushSpots()).
+///
 /// \author I. Hrivnacova; IPN, Orsay
 
 class TG4GflashSensitiveDetector : public TG4SensitiveDetector,
@@ -38,7 +52,48 @@ class TG4GflashSensitiveDetector : public TG4SensitiveDetector,
   using TG4SensitiveDetector::ProcessHits;
   virtual G4bool ProcessHits(G4GFlashSpot* gflashSpot, G4TouchableHistory*);
 
+  // static methods
+  static void FlushSpots();
+
+  // set methods
+  void SetSpotsAggregation(G4bool value);
+
+  // get methods
+  G4bool GetSpotsAggregation() const;
+
  private:
+  /// \brief The key of the aggregation cell:
+  /// the physical volume and the copy numbers of the touchable history
+  using CellKey = std::pair<G4VPhysicalVolume*, std::vector<G4int> >;
+
+  /// \brief The cell in the spots aggregation buffer
+  struct Cell
+  {
+    /// the sensitive detector which received the spots
+    TG4GflashSensitiveDetector* fSD = nullptr;
+    /// the fast track of the shower originator
+    const G4FastTrack* fFastTrack = nullptr;
+    /// the copy of the touchable history of the first spot in the cell
+    G4TouchableHandle fTouchable;
+    /// the sum of the spots energy
+    G4double fEnergy = 0.;
+    /// the sum of the spots energy weighted positions
+    G4ThreeVector fWeightedPosition;
+  };
+
+  /// \brief The per-thread spots aggregation buffer
+  struct Buffer
+  {
+    /// the cells in the order of their creation
+    std::vector<Cell> fCells;
+    /// the map from the cell key to the index in fCells
+    std::map<CellKey, G4int> fCellIndices;
+  };
+
+  // methods
+  void AddSpot(G4GFlashSpot* gflashSpot);
+  void ProcessSpot(G4GFlashSpot* gflashSpot);
+
   /// Not implemented
   TG4GflashSensitiveDetector();
   /// Not implemented
@@ -46,6 +101,26 @@ class TG4GflashSensitiveDetector : public TG4SensitiveDetector,
   /// Not implemented
   TG4GflashSensitiveDetector& operator=(
     const TG4GflashSensitiveDetector& right);
+
+  // static data members
+  static G4ThreadLocal Buffer* fgBuffer; ///< the spots aggregation buffer
+
+  // data members
+  G4bool fSpotsAggregation; ///< the option to aggregate spots per cell
 };
 
+// inline methods
+
+inline void TG4GflashSensitiveDetector::SetSpotsAggregation(G4bool value)
+{
+  /// Set the option to aggregate spots per cell
+  fSpotsAggregation = value;
+}
+
+inline G4bool TG4GflashSensitiveDetector::GetSpotsAggregation() const
+{
+  /// Return the option to aggregate spots per cell
+  return fSpotsAggregation;
+}
+
 #endif // TG4_GFLASH_SENSITIVE_DETECTOR_H
@@ -55,6 +55,10 @@ class TG4SDConstruction : public TG4Verbose
   void SetSelectionFromTGeo(G4bool value);
   void SetSensitiveVolumeLabel(const G4String& label);
   void SetIsGflash(G4bool isGflash);
+  void SetIsGflashAggregation(G4bool isGflashAggregation);
+
+  // get methods
+  G4bool HasSelection() const;
 
  private:
   // methods
@@ -82,10 +86,19 @@ class TG4SDConstruction : public TG4Verbose
 
   /// the flag to acivate creating Gflash sensitive detectors
   G4bool fIsGflash;
+
+  /// the flag to acivate aggregating spots in Gflash sensitive detectors
+  G4bool fIsGflashAggregation;
 };
 
 // inline functions
 
+inline G4bool TG4SDConstruction::HasSelection() const
+{
+  /// Return true if the selection of sensitive volumes is defined
+  return !fSelection.empty();
+}
+
 inline const G4String& TG4SDConstruction::GetDefaultSVLabel()
 {
   /// Get the default value of the sensitive volumes label
@@ -118,4 +131,12 @@ inline void TG4SDConstruction::SetIsGflash(G4bool isGflash)
   fIsGflash = isGflash;
 }
 
+inline void TG4SDConstruction::SetIsGflashAggregation(
+  G4bool isGflashAggregation)
+{
+  /// Set the flag to acivate aggregating spots per cell
+  /// in Gflash sensitive detectors
+  fIsGflashAggregation = isGflashAggregation;
+}
+
 #endif // TG4_SD_CONSTRUCTION_H
@@ -32,6 +32,7 @@ class G4UIcmdWithoutParameter;
 /// - /mcDet/setSDSelectionFromTGeo  true|false
 /// - /mcDet/setSVLabel label
 /// - /mcDet/setGflash  true|false
+/// - /mcDet/setGflashAggregation  true|false
 /// - /mcDet/setExclusiveSDScoring true|false
 /// - /mcDet/printUserSDs
 ///
@@ -72,6 +73,9 @@ class TG4SDMessenger : public G4UImessenger
   /// setGflash command
   G4UIcmdWithABool* fSetGflashCmd;
 
+  /// setGflashAggregation command
+  G4UIcmdWithABool* fSetGflashAggregationCmd;
+
   /// setExclusiveSDScoring command
   G4UIcmdWithABool* fSetExclusiveSDScoringCmd;
 
@@ -76,6 +76,8 @@ class TG4SDServices
   Int_t NofSensitiveDetectors() const;
   TG4SensitiveDetector* GetSensitiveDetector(G4VSensitiveDetector* sd) const;
   std::set<TVirtualMCSensitiveDetector*>* GetUserSDs() const;
+  // memory
+  std::size_t GetMemorySize() const;
 
   // Daughters
   Int_t NofVolDaughters(const char* volName) const;
@@ -123,6 +123,7 @@ class TG4StepManager
   Double_t NIELEdep() const;
   Int_t StepNumber() const;
   Double_t TrackWeight() const;
+  Double_t VolumeImportance() const; // G4 specific
   void TrackPolarization(Double_t& polX, Double_t& polY, Double_t& polZ) const;
   void TrackPolarization(TVector3& pol) const;
   // static properties
@@ -147,6 +148,8 @@ class TG4StepManager
     TLorentzVector& momentum);
   TMCProcess ProdProcess(Int_t isec) const;
   Int_t StepProcesses(TArrayI& proc) const;
+  void OpticalPhotonYield(
+    Int_t& nofCerenkov, Int_t& nofScintillation) const; // G4 specific
 
  private:
   /// Not implemented
@@ -164,6 +167,7 @@ class TG4StepManager
   const G4VTouchable* GetCurrentTouchable() const;
   G4VPhysicalVolume* GetCurrentOffPhysicalVolume(
     G4int off, G4bool warn = false) const;
+  G4int GetCopyNo(const G4VTouchable* touchable, G4int depth) const;
 
   // static data members
   static G4ThreadLocal TG4StepManager* fgInstance; ///< this instance
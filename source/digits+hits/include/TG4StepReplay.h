@@ -0,0 +1,123 @@
+#ifndef TG4_STEP_REPLAY_H
+#define TG4_STEP_REPLAY_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4StepReplay.h
+/// \brief Definition of the TG4StepReplay class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4StepReplayMessenger.h"
+#include "TG4Verbose.h"
+
+#include <globals.hh>
+
+#include <vector>
+
+class G4Step;
+
+/// \ingroup digits_hits
+/// \brief The step replay microbenchmark of the TG4StepManager accessors
+///
+/// When recording is activated, the copies of the steps (with the copies
+/// of their tracks) are recorded in the stepping action up to the maximum
+/// number of steps. The replay, triggered with the
+/// /mcTracking/stepReplay/replay command, then passes the recorded steps
+/// to TG4StepManager::SetStep() and calls each selected accessor on all
+/// steps in a separate timed pass; the time per call (in ns) is reported
+/// for each accessor together with the time of SetStep() only, which
+/// is included in the other numbers.
+///
+/// The accessors which can be selected:
+/// CurrentVolID, CurrentVolOffID, CurrentVolName, CurrentVolPath,
+/// CurrentMaterial, CurrentMedium, TrackPosition, TrackMomentum,
+/// TrackStep, Edep, TrackPid, TrackCharge, IsTrackEntering.
+///
+/// The steps are recorded and replayed in the same thread, the replay is
+/// therefore available only in sequential mode.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4StepReplay : public TG4Verbose
+{
+ public:
+  TG4StepReplay();
+  ~TG4StepReplay();
+
+  // methods
+  void RecordStep(const G4Step* step);
+  void Replay();
+  void Clear();
+
+  // set methods
+  void SetIsRecording(G4bool isRecording);
+  void SetMaxNofSteps(G4int maxNofSteps);
+  void SetNofRepetitions(G4int nofRepetitions);
+  void SetAccessors(const G4String& accessors);
+
+  // get methods
+  G4bool IsRecording() const;
+
+ private:
+  /// Not implemented
+  TG4StepReplay(const TG4StepReplay& right);
+  /// Not implemented
+  TG4StepReplay& operator=(const TG4StepReplay& right);
+
+  // methods
+  G4double TimeAccessor(const G4String& accessor) const;
+
+  // static data members
+  /// The default accessors mix
+  static const G4String fgkDefaultAccessors;
+
+  // data members
+  /// Messenger
+  TG4StepReplayMessenger fMessenger;
+  /// Option to activate the steps recording
+  G4bool fIsRecording;
+  /// The maximum number of recorded steps
+  G4int fMaxNofSteps;
+  /// The number of replays of all recorded steps per accessor
+  G4int fNofRepetitions;
+  /// The selected accessors
+  std::vector<G4String> fAccessors;
+  /// The recorded steps
+  std::vector<G4Step*> fSteps;
+};
+
+// inline functions
+
+inline void TG4StepReplay::SetIsRecording(G4bool isRecording)
+{
+  /// (In)Activate the steps recording
+  fIsRecording = isRecording;
+}
+
+inline void TG4StepReplay::SetMaxNofSteps(G4int maxNofSteps)
+{
+  /// Set the maximum number of recorded steps
+  fMaxNofSteps = maxNofSteps;
+}
+
+inline void TG4StepReplay::SetNofRepetitions(G4int nofRepetitions)
+{
+  /// Set the number of replays of all recorded steps per accessor
+  fNofRepetitions = nofRepetitions;
+}
+
+inline G4bool TG4StepReplay::IsRecording() const
+{
+  /// Return true if the steps recording is activated
+  return fIsRecording;
+}
+
+#endif // TG4_STEP_REPLAY_H
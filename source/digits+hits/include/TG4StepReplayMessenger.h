@@ -0,0 +1,85 @@
+#ifndef TG4_STEP_REPLAY_MESSENGER_H
+#define TG4_STEP_REPLAY_MESSENGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4StepReplayMessenger.h
+/// \brief Definition of the TG4StepReplayMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class TG4StepReplay;
+
+class G4UIdirectory;
+class G4UIcommand;
+class G4UIcmdWithABool;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithoutParameter;
+
+/// \ingroup digits_hits
+/// \brief Messenger class that defines commands for the step replay
+///        microbenchmark
+///
+/// Implements commands:
+/// - /mcTracking/stepReplay/setRecord true|false
+/// - /mcTracking/stepReplay/setMaxNofSteps value
+/// - /mcTracking/stepReplay/setNofRepetitions value
+/// - /mcTracking/stepReplay/setAccessors accessor1 [accessor2 ...]
+/// - /mcTracking/stepReplay/replay
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4StepReplayMessenger : public G4UImessenger
+{
+ public:
+  TG4StepReplayMessenger(TG4StepReplay* stepReplay);
+  virtual ~TG4StepReplayMessenger();
+
+  // methods
+  virtual void SetNewValue(G4UIcommand* command, G4String string);
+
+ private:
+  /// Not implemented
+  TG4StepReplayMessenger();
+  /// Not implemented
+  TG4StepReplayMessenger(const TG4StepReplayMessenger& right);
+  /// Not implemented
+  TG4StepReplayMessenger& operator=(const TG4StepReplayMessenger& right);
+
+  //
+  // data members
+
+  /// associated class
+  TG4StepReplay* fStepReplay;
+
+  /// command directory
+  G4UIdirectory* fDirectory;
+
+  /// setRecord command
+  G4UIcmdWithABool* fSetRecordCmd;
+
+  /// setMaxNofSteps command
+  G4UIcmdWithAnInteger* fSetMaxNofStepsCmd;
+
+  /// setNofRepetitions command
+  G4UIcmdWithAnInteger* fSetNofRepetitionsCmd;
+
+  /// setAccessors command
+  G4UIcmdWithAString* fSetAccessorsCmd;
+
+  /// replay command
+  G4UIcmdWithoutParameter* fReplayCmd;
+};
+
+#endif // TG4_STEP_REPLAY_MESSENGER_H
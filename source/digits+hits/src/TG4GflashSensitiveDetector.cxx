@@ -15,12 +15,20 @@
 #include "TG4GflashSensitiveDetector.h"
 #include "TG4StepManager.h"
 
+#include <G4GFlashSpot.hh>
+#include <G4TouchableHistory.hh>
+#include <G4VTouchable.hh>
+#include <GFlashEnergySpot.hh>
+
 #include <TVirtualMCApplication.h>
 
+G4ThreadLocal TG4GflashSensitiveDetector::Buffer*
+  TG4GflashSensitiveDetector::fgBuffer = 0;
+
 //_____________________________________________________________________________
 TG4GflashSensitiveDetector::TG4GflashSensitiveDetector(
   G4String sdName, G4int mediumId)
-  : TG4SensitiveDetector(sdName, mediumId)
+  : TG4SensitiveDetector(sdName, mediumId), fSpotsAggregation(false)
 {
   /// Standard constructor with the specified \em name
 }
@@ -29,21 +37,102 @@ TG4GflashSensitiveDetector::TG4GflashSensitiveDetector(
 TG4GflashSensitiveDetector::~TG4GflashSensitiveDetector()
 {
   /// Destructor
+
+  delete fgBuffer;
+  fgBuffer = 0;
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+void TG4GflashSensitiveDetector::AddSpot(G4GFlashSpot* gflashSpot)
+{
+  /// Add the spot energy in the buffer cell defined by the spot touchable
+
+  if (!fgBuffer) {
+    fgBuffer = new Buffer();
+  }
+
+  // Define the cell key from the touchable history
+  G4TouchableHandle touchable = gflashSpot->GetTouchableHandle();
+  CellKey key(touchable->GetVolume(), std::vector<G4int>());
+  key.second.reserve(touchable->GetHistoryDepth() + 1);
+  for (G4int i = 0; i <= touchable->GetHistoryDepth(); ++i) {
+    key.second.push_back(touchable->GetCopyNumber(i));
+  }
+
+  // Get or create the cell
+  auto it = fgBuffer->fCellIndices.find(key);
+  if (it == fgBuffer->fCellIndices.end()) {
+    it = fgBuffer->fCellIndices.insert(
+      std::make_pair(key, G4int(fgBuffer->fCells.size()))).first;
+    Cell cell;
+    cell.fSD = this;
+    cell.fFastTrack = gflashSpot->GetOriginatorTrack();
+    // the spot touchable is updated in place by the hit maker for each spot
+    cell.fTouchable = new G4TouchableHistory(*touchable->GetHistory());
+    fgBuffer->fCells.push_back(cell);
+  }
+
+  // Accumulate the spot energy
+  Cell& cell = fgBuffer->fCells[it->second];
+  G4double energy = gflashSpot->GetEnergySpot()->GetEnergy();
+  cell.fEnergy += energy;
+  cell.fWeightedPosition += energy * gflashSpot->GetEnergySpot()->GetPosition();
+}
+
+//_____________________________________________________________________________
+void TG4GflashSensitiveDetector::ProcessSpot(G4GFlashSpot* gflashSpot)
+{
+  /// Let user sensitive detector process Gflash step
+
+  fStepManager->SetStep(gflashSpot, kGflashSpot);
+  fMCApplication->Stepping();
 }
 
 //
 // public methods
 //
 
+//_____________________________________________________________________________
+void TG4GflashSensitiveDetector::FlushSpots()
+{
+  /// Pass the aggregated spots to the user sensitive detectors
+  /// and clear the buffer.
+  /// This function must be called before the shower originator track
+  /// is finished, it is called from TG4TrackingAction::PostUserTrackingAction.
+
+  if (!fgBuffer || !fgBuffer->fCells.size()) return;
+
+  for (auto& cell : fgBuffer->fCells) {
+    if (cell.fEnergy <= 0.) continue;
+
+    GFlashEnergySpot energySpot(
+      cell.fWeightedPosition / cell.fEnergy, cell.fEnergy);
+    G4GFlashSpot gflashSpot(&energySpot, cell.fFastTrack, cell.fTouchable);
+    cell.fSD->ProcessSpot(&gflashSpot);
+  }
+
+  fgBuffer->fCells.clear();
+  fgBuffer->fCellIndices.clear();
+}
+
 //_____________________________________________________________________________
 G4bool TG4GflashSensitiveDetector::ProcessHits(
   G4GFlashSpot* gflashSpot, G4TouchableHistory*)
 {
-  /// Call user defined sensitive detector
+  /// Call user defined sensitive detector or add the spot in the
+  /// aggregation buffer if the spots aggregation is activated
 
-  // let user sensitive detector process Gflash step
-  fStepManager->SetStep(gflashSpot, kGflashSpot);
-  fMCApplication->Stepping();
+  if (fSpotsAggregation) {
+    AddSpot(gflashSpot);
+  }
+  else {
+    // let user sensitive detector process Gflash step
+    ProcessSpot(gflashSpot);
+  }
 
   return true;
 }
@@ -41,7 +41,8 @@ TG4SDConstruction::TG4SDConstruction()
     fSelectionFromTGeo(false),
     fSVLabel(fgkDefaultSVLabel),
     fSelection(),
-    fIsGflash(false)
+    fIsGflash(false),
+    fIsGflashAggregation(false)
 {
   /// Default constructor
 }
@@ -90,10 +91,14 @@ void TG4SDConstruction::CreateSD(
 
     TG4SensitiveDetector* newSD = 0;
     if (fIsGflash) {
-      newSD = new TG4GflashSensitiveDetector(sdName, mediumId);
+      TG4GflashSensitiveDetector* gflashSD =
+        new TG4GflashSensitiveDetector(sdName, mediumId);
+      gflashSD->SetSpotsAggregation(fIsGflashAggregation);
+      newSD = gflashSD;
       if (VerboseLevel() > 2) {
         G4cout << "Created TG4GflashSensitiveDetector with sdName=" << sdName
-               << " mediumId=" << mediumId << G4endl;
+               << " mediumId=" << mediumId
+               << " spotsAggregation=" << fIsGflashAggregation << G4endl;
       }
     }
     else if (userSD) {
@@ -29,6 +29,7 @@ TG4SDMessenger::TG4SDMessenger(TG4SDConstruction* sdConstruction)
     fSetSDSelectionFromTGeoCmd(0),
     fSetSVLabelCmd(0),
     fSetGflashCmd(0),
+    fSetGflashAggregationCmd(0),
     fSetExclusiveSDScoringCmd(0),
     fPrintUserSDsCmd(0)
 {
@@ -68,6 +69,16 @@ TG4SDMessenger::TG4SDMessenger(TG4SDConstruction* sdConstruction)
   fSetGflashCmd->SetParameterName("Gflash", false);
   fSetGflashCmd->AvailableForStates(G4State_PreInit);
 
+  fSetGflashAggregationCmd =
+    new G4UIcmdWithABool("/mcDet/setGflashAggregation", this);
+  guidance = "Activate aggregating Gflash spots per sensitive volume cell.\n";
+  guidance += "The spots are summed per (volume, copy numbers) cell and ";
+  guidance += "only one deposit per cell is passed to the user stepping\n";
+  guidance += "at the end of each shower.";
+  fSetGflashAggregationCmd->SetGuidance(guidance);
+  fSetGflashAggregationCmd->SetParameterName("GflashAggregation", false);
+  fSetGflashAggregationCmd->AvailableForStates(G4State_PreInit);
+
   fSetExclusiveSDScoringCmd =
     new G4UIcmdWithABool("/mcDet/setExclusiveSDScoring", this);
   guidance = "Activate scoring by user sensitive detectors only.\n";
@@ -90,6 +101,7 @@ TG4SDMessenger::~TG4SDMessenger()
   delete fSetSDSelectionFromTGeoCmd;
   delete fSetSVLabelCmd;
   delete fSetGflashCmd;
+  delete fSetGflashAggregationCmd;
   delete fSetExclusiveSDScoringCmd;
   delete fPrintUserSDsCmd;
 }
@@ -116,6 +128,10 @@ void TG4SDMessenger::SetNewValue(G4UIcommand* command, G4String newValue)
   else if (command == fSetGflashCmd) {
     fSDConstruction->SetIsGflash(fSetGflashCmd->GetNewBoolValue(newValue));
   }
+  else if (command == fSetGflashAggregationCmd) {
+    fSDConstruction->SetIsGflashAggregation(
+      fSetGflashAggregationCmd->GetNewBoolValue(newValue));
+  }
   else if (command == fSetExclusiveSDScoringCmd) {
     fSDConstruction->SetExclusiveSDScoring(
       fSetExclusiveSDScoringCmd->GetNewBoolValue(newValue));
@@ -15,6 +15,7 @@
 #include "TG4SDServices.h"
 #include "TG4GeometryServices.h"
 #include "TG4Globals.h"
+#include "TG4MemorySize.h"
 #include "TG4SensitiveDetector.h"
 
 #include <G4LogicalVolume.hh>
@@ -468,3 +469,19 @@ Int_t TG4SDServices::VolDaughterCopyNo(const char* volName, Int_t i) const
 
   return lv->GetDaughter(i)->GetCopyNo();
 }
+
+//_____________________________________________________________________________
+std::size_t TG4SDServices::GetMemorySize() const
+{
+  /// Return the estimated memory (in bytes) of the volume maps
+  /// and of the user SDs containers in the current thread
+
+  std::size_t size = TG4MemorySize::Of(fVolNameToIdMap) +
+                     TG4MemorySize::Of(fVolIdToLVMap) +
+                     TG4MemorySize::Of(fLVToVolIdMap);
+
+  if (fgUserSDs) size += TG4MemorySize::Of(*fgUserSDs);
+  if (fgUserSDMap) size += TG4MemorySize::Of(*fgUserSDMap);
+
+  return size;
+}
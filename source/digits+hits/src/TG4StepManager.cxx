@@ -16,7 +16,9 @@
 #include "TG4G3Units.h"
 #include "TG4GeometryServices.h"
 #include "TG4Globals.h"
+#include "TG4ImportanceBiasingOperator.h"
 #include "TG4Limits.h"
+#include "TG4OpticalYieldControl.h"
 #include "TG4ParticlesManager.h"
 #include "TG4PhysicsManager.h"
 #include "TG4SDServices.h"
@@ -193,6 +195,26 @@ G4VPhysicalVolume* TG4StepManager::GetCurrentOffPhysicalVolume(
   return touchable->GetVolume(off);
 }
 
+//_____________________________________________________________________________
+G4int TG4StepManager::GetCopyNo(
+  const G4VTouchable* touchable, G4int depth) const
+{
+  /// Return the copy number of the volume at the given depth of the touchable
+  /// history with the VMC offsets applied.
+  /// The replica number from the touchable history is used, as the copy
+  /// number of a parameterised or replicated volume is shared by all its
+  /// copies and it is not up to date for the levels other than the last
+  /// located one.
+
+  G4VPhysicalVolume* physVolume = touchable->GetVolume(depth);
+  G4int copyNo = touchable->GetReplicaNumber(depth) + fCopyNoOffset;
+
+  if (physVolume->IsParameterised() || physVolume->IsReplicated())
+    copyNo += fDivisionCopyNoOffset;
+
+  return copyNo;
+}
+
 //
 // public methods
 //
@@ -409,10 +431,7 @@ Int_t TG4StepManager::CurrentVolID(Int_t& copyNo) const
       "TG4StepManager", "CurrentVolID", "No current physical volume found");
     return 0;
   }
-  copyNo = physVolume->GetCopyNo() + fCopyNoOffset;
-
-  if (physVolume->IsParameterised() || physVolume->IsReplicated())
-    copyNo += fDivisionCopyNoOffset;
+  copyNo = GetCopyNo(GetCurrentTouchable(), 0);
 
   // sensitive detector ID
   return TG4SDServices::Instance()->GetVolumeID(physVolume->GetLogicalVolume());
@@ -432,10 +451,7 @@ Int_t TG4StepManager::CurrentVolOffID(Int_t off, Int_t& copyNo) const
 #endif
 
   if (mother) {
-    copyNo = mother->GetCopyNo() + fCopyNoOffset;
-
-    if (mother->IsParameterised() || mother->IsReplicated())
-      copyNo += fDivisionCopyNoOffset;
+    copyNo = GetCopyNo(GetCurrentTouchable(), off);
 
     // sensitive detector ID
     return TG4SDServices::Instance()->GetVolumeID(mother->GetLogicalVolume());
@@ -490,24 +506,18 @@ const char* TG4StepManager::CurrentVolPath()
   //
   G4int depth = touchable->GetHistoryDepth();
 
-  // Compose the path
+  // Compose the path from the top volume down to the current volume
+  // with the copy numbers consistent with CurrentVolID()
   //
   fNameBuffer = "";
-  for (G4int i = 0; i < depth; i++) {
-    G4VPhysicalVolume* physVolume = touchable->GetHistory()->GetVolume(i);
+  for (G4int i = depth; i >= 0; i--) {
+    G4VPhysicalVolume* physVolume = touchable->GetVolume(i);
     fNameBuffer += "/";
     fNameBuffer += geometryServices->UserVolumeName(physVolume->GetName());
     fNameBuffer += "_";
-    TG4Globals::AppendNumberToString(fNameBuffer, physVolume->GetCopyNo());
+    TG4Globals::AppendNumberToString(fNameBuffer, GetCopyNo(touchable, i));
   }
 
-  // Add current volume to the path
-  G4VPhysicalVolume* curPhysVolume = GetCurrentPhysicalVolume();
-  fNameBuffer += "/";
-  fNameBuffer += geometryServices->UserVolumeName(curPhysVolume->GetName());
-  fNameBuffer += "_";
-  TG4Globals::AppendNumberToString(fNameBuffer, curPhysVolume->GetCopyNo());
-
   return fNameBuffer.data();
 }
 
@@ -988,6 +998,22 @@ Double_t TG4StepManager::TrackWeight() const
   return fTrack->GetWeight();
 }
 
+//_____________________________________________________________________________
+Double_t TG4StepManager::VolumeImportance() const
+{
+  /// Return the geometry importance of the current volume
+  /// (1 if the importance biasing is not applied).
+  /// The track weight (TrackWeight()) changes when the track crosses
+  /// the volumes with different importances.
+
+#ifdef MCDEBUG
+  CheckTrack();
+#endif
+
+  return TG4ImportanceBiasingOperator::GetImportance(
+    GetCurrentPhysicalVolume()->GetLogicalVolume());
+}
+
 //_____________________________________________________________________________
 void TG4StepManager::TrackPolarization(
   Double_t& polX, Double_t& polY, Double_t& polZ) const
@@ -1421,3 +1447,31 @@ Int_t TG4StepManager::StepProcesses(TArrayI& processes) const
 
   return counter;
 }
+
+//_____________________________________________________________________________
+void TG4StepManager::OpticalPhotonYield(
+  Int_t& nofCerenkov, Int_t& nofScintillation) const
+{
+  /// Return the numbers of optical photons produced by the Cerenkov and
+  /// scintillation processes in the current step; in the media with the
+  /// photon-yield-only mode (see TG4OpticalYieldControl) these photons
+  /// are not created as secondaries
+
+  nofCerenkov = 0;
+  nofScintillation = 0;
+
+  if (fStepStatus == kVertex || fStepStatus == kGflashSpot) return;
+
+#ifdef MCDEBUG
+  CheckStep("OpticalPhotonYield");
+#endif
+
+  auto yieldControl = TG4OpticalYieldControl::Instance();
+  if (!yieldControl) return;
+
+  G4int nofCerenkovPhotons, nofScintillationPhotons;
+  yieldControl->GetNofPhotons(
+    fStep, nofCerenkovPhotons, nofScintillationPhotons);
+  nofCerenkov = nofCerenkovPhotons;
+  nofScintillation = nofScintillationPhotons;
+}
@@ -0,0 +1,265 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4StepReplay.cxx
+/// \brief Implementation of the TG4StepReplay class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4StepReplay.h"
+#include "TG4Globals.h"
+#include "TG4StepManager.h"
+
+#include <G4Step.hh>
+#include <G4Threading.hh>
+#include <G4Track.hh>
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+// The sink for the accessors results, which prevents the compiler
+// from optimizing out the timed calls
+volatile G4double resultSink = 0.;
+
+// Call the accessor on all recorded steps nofRepetitions times and
+// return the time per call in ns
+template <typename Accessor>
+G4double TimeLoop(
+  const std::vector<G4Step*>& steps, G4int nofRepetitions, Accessor accessor)
+{
+  TG4StepManager* stepManager = TG4StepManager::Instance();
+
+  auto start = std::chrono::steady_clock::now();
+  for (G4int i = 0; i < nofRepetitions; ++i) {
+    for (auto step : steps) {
+      stepManager->SetStep(step, kNormalStep);
+      accessor(stepManager);
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<G4double, std::nano>(end - start).count() /
+         (G4double(nofRepetitions) * steps.size());
+}
+} // namespace
+
+// static data members
+const G4String TG4StepReplay::fgkDefaultAccessors =
+  "CurrentVolID CurrentVolOffID CurrentVolPath CurrentMaterial "
+  "TrackPosition TrackMomentum Edep TrackPid";
+
+//_____________________________________________________________________________
+TG4StepReplay::TG4StepReplay()
+  : TG4Verbose("stepReplay"),
+    fMessenger(this),
+    fIsRecording(false),
+    fMaxNofSteps(100000),
+    fNofRepetitions(10),
+    fAccessors(),
+    fSteps()
+{
+  /// Default constructor
+
+  SetAccessors(fgkDefaultAccessors);
+}
+
+//_____________________________________________________________________________
+TG4StepReplay::~TG4StepReplay()
+{
+  /// Destructor
+
+  Clear();
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+G4double TG4StepReplay::TimeAccessor(const G4String& accessor) const
+{
+  /// Time the given accessor on the recorded steps and return the time
+  /// per call (including SetStep()) in ns, or -1 if the accessor
+  /// is not supported
+
+  if (accessor == "SetStep") {
+    return TimeLoop(fSteps, fNofRepetitions, [](TG4StepManager*) {});
+  }
+  if (accessor == "CurrentVolID") {
+    return TimeLoop(fSteps, fNofRepetitions, [](TG4StepManager* sm) {
+      Int_t copyNo;
+      resultSink = sm->CurrentVolID(copyNo) + copyNo;
+    });
+  }
+  if (accessor == "CurrentVolOffID") {
+    return TimeLoop(fSteps, fNofRepetitions, [](TG4StepManager* sm) {
+      Int_t copyNo;
+      resultSink = sm->CurrentVolOffID(1, copyNo) + copyNo;
+    });
+  }
+  if (accessor == "CurrentVolName") {
+    return TimeLoop(fSteps, fNofRepetitions, [](TG4StepManager* sm) {
+      resultSink = sm->CurrentVolName()[0];
+    });
+  }
+  if (accessor == "CurrentVolPath") {
+    return TimeLoop(fSteps, fNofRepetitions, [](TG4StepManager* sm) {
+      resultSink = sm->CurrentVolPath()[0];
+    });
+  }
+  if (accessor == "CurrentMaterial") {
+    return TimeLoop(fSteps, fNofRepetitions, [](TG4StepManager* sm) {
+      Float_t a, z, dens, radl, absl;
+      resultSink = sm->CurrentMaterial(a, z, dens, radl, absl) + dens;
+    });
+  }
+  if (accessor == "CurrentMedium") {
+    return TimeLoop(fSteps, fNofRepetitions,
+      [](TG4StepManager* sm) { resultSink = sm->CurrentMedium(); });
+  }
+  if (accessor == "TrackPosition") {
+    return TimeLoop(fSteps, fNofRepetitions, [](TG4StepManager* sm) {
+      Double_t x, y, z;
+      sm->TrackPosition(x, y, z);
+      resultSink = x + y + z;
+    });
+  }
+  if (accessor == "TrackMomentum") {
+    return TimeLoop(fSteps, fNofRepetitions, [](TG4StepManager* sm) {
+      Double_t px, py, pz, etot;
+      sm->TrackMomentum(px, py, pz, etot);
+      resultSink = px + py + pz + etot;
+    });
+  }
+  if (accessor == "TrackStep") {
+    return TimeLoop(fSteps, fNofRepetitions,
+      [](TG4StepManager* sm) { resultSink = sm->TrackStep(); });
+  }
+  if (accessor == "Edep") {
+    return TimeLoop(fSteps, fNofRepetitions,
+      [](TG4StepManager* sm) { resultSink = sm->Edep(); });
+  }
+  if (accessor == "TrackPid") {
+    return TimeLoop(fSteps, fNofRepetitions,
+      [](TG4StepManager* sm) { resultSink = sm->TrackPid(); });
+  }
+  if (accessor == "TrackCharge") {
+    return TimeLoop(fSteps, fNofRepetitions,
+      [](TG4StepManager* sm) { resultSink = sm->TrackCharge(); });
+  }
+  if (accessor == "IsTrackEntering") {
+    return TimeLoop(fSteps, fNofRepetitions,
+      [](TG4StepManager* sm) { resultSink = sm->IsTrackEntering(); });
+  }
+
+  return -1.;
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4StepReplay::RecordStep(const G4Step* step)
+{
+  /// Record a copy of the given step with a copy of its track
+  /// if the maximum number of steps has not yet been reached
+
+  if (G4int(fSteps.size()) >= fMaxNofSteps) return;
+
+  G4Track* track = new G4Track(*step->GetTrack());
+  G4Step* stepCopy = new G4Step(*step);
+  stepCopy->SetTrack(track);
+  track->SetStep(stepCopy);
+  fSteps.push_back(stepCopy);
+
+  if (VerboseLevel() > 0 && G4int(fSteps.size()) == fMaxNofSteps) {
+    G4cout << "TG4StepReplay: the maximum number of recorded steps ("
+           << fMaxNofSteps << ") reached." << G4endl;
+  }
+}
+
+//_____________________________________________________________________________
+void TG4StepReplay::Replay()
+{
+  /// Replay the recorded steps through the step manager and print
+  /// the time per call of SetStep() and of each selected accessor.
+  /// The accessor times include SetStep(), the net time is given
+  /// in the last column.
+
+  if (G4Threading::IsMultithreadedApplication()) {
+    TG4Globals::Warning("TG4StepReplay", "Replay",
+      "The step replay is available only in sequential mode.");
+    return;
+  }
+
+  if (fSteps.empty()) {
+    TG4Globals::Warning("TG4StepReplay", "Replay",
+      "No steps were recorded (see /mcTracking/stepReplay/setRecord).");
+    return;
+  }
+
+  if (!TG4StepManager::Instance()) {
+    TG4Globals::Warning("TG4StepReplay", "Replay",
+      "The step manager does not exist.");
+    return;
+  }
+
+  G4cout << "### Step replay: " << fSteps.size() << " steps, "
+         << fNofRepetitions << " repetitions" << G4endl;
+
+  G4double setStepTime = TimeAccessor("SetStep");
+  G4cout << "StepReplay SetStep nsPerCall " << std::fixed
+         << std::setprecision(2) << setStepTime << G4endl;
+
+  for (const auto& accessor : fAccessors) {
+    G4double time = TimeAccessor(accessor);
+    if (time < 0.) {
+      TG4Globals::Warning("TG4StepReplay", "Replay",
+        "Accessor " + TString(accessor.data()) + " is not supported.");
+      continue;
+    }
+    G4cout << "StepReplay " << accessor << " nsPerCall " << time << " net "
+           << time - setStepTime << G4endl;
+  }
+  G4cout.unsetf(std::ios::fixed);
+  G4cout << std::setprecision(6);
+
+  // Reset the step manager so that it does not refer to the recorded steps
+  TG4StepManager::Instance()->SetStep(static_cast<G4Track*>(0), kVertex);
+}
+
+//_____________________________________________________________________________
+void TG4StepReplay::Clear()
+{
+  /// Delete the recorded steps and their tracks
+
+  for (auto step : fSteps) {
+    delete step->GetTrack();
+    delete step;
+  }
+  fSteps.clear();
+}
+
+//_____________________________________________________________________________
+void TG4StepReplay::SetAccessors(const G4String& accessors)
+{
+  /// Set the selected accessors from the given list separated by blanks
+
+  fAccessors.clear();
+
+  std::istringstream is(accessors);
+  G4String token;
+  while (is >> token) {
+    fAccessors.push_back(token);
+  }
+}
@@ -0,0 +1,123 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4StepReplayMessenger.cxx
+/// \brief Implementation of the TG4StepReplayMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4StepReplayMessenger.h"
+#include "TG4StepReplay.h"
+
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIdirectory.hh>
+
+//______________________________________________________________________________
+TG4StepReplayMessenger::TG4StepReplayMessenger(TG4StepReplay* stepReplay)
+  : G4UImessenger(),
+    fStepReplay(stepReplay),
+    fDirectory(0),
+    fSetRecordCmd(0),
+    fSetMaxNofStepsCmd(0),
+    fSetNofRepetitionsCmd(0),
+    fSetAccessorsCmd(0),
+    fReplayCmd(0)
+{
+  /// Standard constructor
+
+  fDirectory = new G4UIdirectory("/mcTracking/stepReplay/");
+  fDirectory->SetGuidance("Step manager accessors microbenchmark commands.");
+
+  fSetRecordCmd =
+    new G4UIcmdWithABool("/mcTracking/stepReplay/setRecord", this);
+  fSetRecordCmd->SetGuidance(
+    "(In)activate recording of the steps for the step replay.");
+  fSetRecordCmd->SetParameterName("Record", false);
+  fSetRecordCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fSetMaxNofStepsCmd =
+    new G4UIcmdWithAnInteger("/mcTracking/stepReplay/setMaxNofSteps", this);
+  fSetMaxNofStepsCmd->SetGuidance(
+    "Set the maximum number of recorded steps.");
+  fSetMaxNofStepsCmd->SetParameterName("MaxNofSteps", false);
+  fSetMaxNofStepsCmd->SetRange("MaxNofSteps > 0");
+  fSetMaxNofStepsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fSetNofRepetitionsCmd = new G4UIcmdWithAnInteger(
+    "/mcTracking/stepReplay/setNofRepetitions", this);
+  fSetNofRepetitionsCmd->SetGuidance(
+    "Set the number of replays of all recorded steps per accessor.");
+  fSetNofRepetitionsCmd->SetParameterName("NofRepetitions", false);
+  fSetNofRepetitionsCmd->SetRange("NofRepetitions > 0");
+  fSetNofRepetitionsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fSetAccessorsCmd =
+    new G4UIcmdWithAString("/mcTracking/stepReplay/setAccessors", this);
+  fSetAccessorsCmd->SetGuidance(
+    "Select the step manager accessors timed in the replay.");
+  fSetAccessorsCmd->SetGuidance("Available accessors:");
+  fSetAccessorsCmd->SetGuidance(
+    "  CurrentVolID CurrentVolOffID CurrentVolName CurrentVolPath");
+  fSetAccessorsCmd->SetGuidance(
+    "  CurrentMaterial CurrentMedium TrackPosition TrackMomentum");
+  fSetAccessorsCmd->SetGuidance(
+    "  TrackStep Edep TrackPid TrackCharge IsTrackEntering");
+  fSetAccessorsCmd->SetParameterName("Accessors", false);
+  fSetAccessorsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fReplayCmd =
+    new G4UIcmdWithoutParameter("/mcTracking/stepReplay/replay", this);
+  fReplayCmd->SetGuidance(
+    "Replay the recorded steps and print the time per accessor call.");
+  fReplayCmd->AvailableForStates(G4State_Idle);
+}
+
+//______________________________________________________________________________
+TG4StepReplayMessenger::~TG4StepReplayMessenger()
+{
+  /// Destructor
+
+  delete fDirectory;
+  delete fSetRecordCmd;
+  delete fSetMaxNofStepsCmd;
+  delete fSetNofRepetitionsCmd;
+  delete fSetAccessorsCmd;
+  delete fReplayCmd;
+}
+
+//
+// public methods
+//
+
+//______________________________________________________________________________
+void TG4StepReplayMessenger::SetNewValue(
+  G4UIcommand* command, G4String newValue)
+{
+  /// Apply command to the associated object.
+
+  if (command == fSetRecordCmd) {
+    fStepReplay->SetIsRecording(fSetRecordCmd->GetNewBoolValue(newValue));
+  }
+  else if (command == fSetMaxNofStepsCmd) {
+    fStepReplay->SetMaxNofSteps(fSetMaxNofStepsCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fSetNofRepetitionsCmd) {
+    fStepReplay->SetNofRepetitions(
+      fSetNofRepetitionsCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fSetAccessorsCmd) {
+    fStepReplay->SetAccessors(newValue);
+  }
+  else if (command == fReplayCmd) {
+    fStepReplay->Replay();
+  }
+}
@@ -16,6 +16,8 @@
 /// \author I. Hrivnacova; IPN, Orsay
 
 #include "TG4EventActionMessenger.h"
+#include "TG4EventCheckpoint.h"
+#include "TG4MemoryAccounting.h"
 #include "TG4Verbose.h"
 
 #include <TStopwatch.h>
@@ -23,9 +25,11 @@
 #include <G4UserEventAction.hh>
 #include <globals.hh>
 
+class TG4SteppingAction;
 class TG4TrackingAction;
 class TG4TrackManager;
 class TG4StateManager;
+class TG4ShowerLibraryModel;
 
 class TVirtualMCApplication;
 class TVirtualMCStack;
@@ -51,11 +55,13 @@ class TG4EventAction : public G4UserEventAction, public TG4Verbose
   // set methods
   void SetMCStack(TVirtualMCStack* mcStack);
   void SetPrintMemory(G4bool printMemory);
+  void SetPrintMemoryAccounting(G4bool printMemoryAccounting);
   void SetSaveRandomStatus(G4bool saveRandomStatus);
   void SetIsInterruptibleEvent(G4bool isInterruptible);
 
   // get methods
   G4bool GetPrintMemory() const;
+  G4bool GetPrintMemoryAccounting() const;
   G4bool GetSaveRandomStatus() const;
   G4bool IsInterruptibleEvent() const;
 
@@ -69,6 +75,12 @@ class TG4EventAction : public G4UserEventAction, public TG4Verbose
   TG4EventActionMessenger fMessenger; ///< messenger
   TStopwatch fTimer;                  ///< timer
 
+  /// Memory accounting of the VMC data structures
+  TG4MemoryAccounting fMemoryAccounting;
+
+  /// Event checkpoint
+  TG4EventCheckpoint fEventCheckpoint;
+
   /// Cached pointer to thread-local VMC application
   TVirtualMCApplication* fMCApplication;
 
@@ -78,15 +90,24 @@ class TG4EventAction : public G4UserEventAction, public TG4Verbose
   /// Cached pointer to thread-local tracking action
   TG4TrackingAction* fTrackingAction;
 
+  /// Cached pointer to thread-local stepping action
+  TG4SteppingAction* fSteppingAction;
+
   /// Cached pointer to thread-local track manager
   TG4TrackManager* fTrackManager;
 
   /// Cached pointer to thread-local state manager
   TG4StateManager* fStateManager;
 
+  /// Cached pointer to the shower library model (if recording)
+  TG4ShowerLibraryModel* fShowerLibraryModel;
+
   /// Control for printing memory usage
   G4bool fPrintMemory;
 
+  /// Control for printing memory accounting of the VMC data structures
+  G4bool fPrintMemoryAccounting;
+
   /// Control for saving random engine status for each event
   G4bool fSaveRandomStatus;
 
@@ -116,6 +137,19 @@ inline G4bool TG4EventAction::GetPrintMemory() const
   return fPrintMemory;
 }
 
+inline void TG4EventAction::SetPrintMemoryAccounting(
+  G4bool printMemoryAccounting)
+{
+  /// Set option for printing memory accounting of the VMC data structures
+  fPrintMemoryAccounting = printMemoryAccounting;
+}
+
+inline G4bool TG4EventAction::GetPrintMemoryAccounting() const
+{
+  /// Return the option for printing memory accounting
+  return fPrintMemoryAccounting;
+}
+
 inline G4bool TG4EventAction::GetSaveRandomStatus() const
 {
   /// Return the option for printing memory usage
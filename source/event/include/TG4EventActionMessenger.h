@@ -27,6 +27,7 @@ class G4UIcmdWithABool;
 ///
 /// Implements command
 /// - /mcEvent/printMemory [true|false]
+/// - /mcEvent/printMemoryAccounting [true|false]
 /// - /mcEvent/saveRandom [true|false]
 ///
 /// \author I. Hrivnacova; IPN, Orsay
@@ -52,6 +53,8 @@ class TG4EventActionMessenger : public G4UImessenger
   TG4EventAction* fEventAction;           ///< associated class
   G4UIdirectory* fEventDirectory;         ///< command directory
   G4UIcmdWithABool* fPrintMemoryCmd;      ///< command: printMemory
+  /// command: printMemoryAccounting
+  G4UIcmdWithABool* fPrintMemoryAccountingCmd;
   G4UIcmdWithABool* fSaveRandomStatusCmd; ///< command: saveRandom
 };
 
@@ -0,0 +1,167 @@
+#ifndef TG4_EVENT_CHECKPOINT_H
+#define TG4_EVENT_CHECKPOINT_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4EventCheckpoint.h
+/// \brief Definition of the TG4EventCheckpoint class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4EventCheckpointMessenger.h"
+#include "TG4Verbose.h"
+
+#include <globals.hh>
+
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+class TG4TrackManager;
+class TG4VUserEventCheckpoint;
+
+class G4Event;
+class G4Track;
+struct TMCParticleStatus;
+
+/// \ingroup event
+/// \brief The checkpoint of an event in progress
+///
+/// The checkpoint is due when it was requested with Request() (eg. from
+/// a signal handler when a preemptible slot is reclaimed) or when the event
+/// processing time exceeds the limit set with
+/// /mcEvent/checkpoint/setMaxEventTime. It is then written at the start
+/// of the next track:
+/// - the pending Geant4 tracks (the current track and the tracks in the
+///   urgent and waiting stacks) with their VMC track and parent indices;
+///   the tracks which were not yet saved in the VMC stack are pushed
+///   in the stack first
+/// - the random engine status (in the file with the .rndm extension)
+/// - the user application state via TG4VUserEventCheckpoint::Save()
+///   (in the file with the .user extension)
+///
+/// The event and the run are then aborted and
+/// TVirtualMCApplication::FinishEvent() is not called.
+///
+/// The event is resumed in the next event after /mcEvent/checkpoint/resume:
+/// the user state is restored via TG4VUserEventCheckpoint::Restore() and
+/// the pending tracks are restored as the Geant4 primaries with their VMC
+/// track status (as the tracks transferred from another engine), so that
+/// they keep their VMC indices and parents.
+/// As the VMC stack is implemented by the user application, its contents
+/// must be saved and restored by the user checkpoint; the resume fails
+/// with an exception if the stack does not contain the checkpointed tracks.
+///
+/// The checkpoint is available only in sequential mode and with the tracks
+/// saved in the VMC stack.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4EventCheckpoint : public TG4Verbose
+{
+ public:
+  TG4EventCheckpoint();
+  virtual ~TG4EventCheckpoint();
+
+  // static access method
+  static TG4EventCheckpoint* Instance();
+
+  // methods
+  void BeginEvent();
+  G4bool IsDue() const;
+  G4bool Write(const G4Track* currentTrack);
+  G4bool Resume(G4Event* event);
+  void Request();
+
+  // set methods
+  void SetUserCheckpoint(TG4VUserEventCheckpoint* userCheckpoint);
+  void SetFileName(const G4String& fileName);
+  void SetMaxEventTime(G4double maxEventTime);
+  void SetResume(const G4String& fileName);
+
+  // get methods
+  G4bool IsResume() const;
+  G4bool IsCheckpointed() const;
+
+ private:
+  /// Not implemented
+  TG4EventCheckpoint(const TG4EventCheckpoint& right);
+  /// Not implemented
+  TG4EventCheckpoint& operator=(const TG4EventCheckpoint& right);
+
+  // methods
+  void WriteTrack(std::ofstream& file, const G4Track* track,
+    TG4TrackManager* trackManager) const;
+
+  // static data members
+  /// this instance
+  static G4ThreadLocal TG4EventCheckpoint* fgInstance;
+
+  // data members
+  /// Messenger
+  TG4EventCheckpointMessenger fMessenger;
+  /// The user checkpoint of the application state (owned)
+  TG4VUserEventCheckpoint* fUserCheckpoint;
+  /// The checkpoint file name
+  G4String fFileName;
+  /// The file name of the checkpoint to be resumed in the next event
+  G4String fResumeFileName;
+  /// The maximum event processing time (s), 0 = no limit
+  G4double fMaxEventTime;
+  /// The start time of the current event (s)
+  G4double fEventStartTime;
+  /// The checkpoint request
+  std::atomic<G4bool> fIsRequested;
+  /// The flag whether the current event was checkpointed
+  G4bool fIsCheckpointed;
+  /// The status of the resumed tracks
+  std::vector<std::unique_ptr<TMCParticleStatus>> fParticlesStatus;
+};
+
+// inline functions
+
+inline TG4EventCheckpoint* TG4EventCheckpoint::Instance()
+{
+  /// Return this instance
+  return fgInstance;
+}
+
+inline void TG4EventCheckpoint::Request()
+{
+  /// Request the checkpoint at the start of the next track
+  fIsRequested = true;
+}
+
+inline void TG4EventCheckpoint::SetFileName(const G4String& fileName)
+{
+  /// Set the checkpoint file name
+  fFileName = fileName;
+}
+
+inline void TG4EventCheckpoint::SetMaxEventTime(G4double maxEventTime)
+{
+  /// Set the maximum event processing time (s), 0 = no limit
+  fMaxEventTime = maxEventTime;
+}
+
+inline G4bool TG4EventCheckpoint::IsResume() const
+{
+  /// Return true if the next event should be resumed from a checkpoint
+  return !fResumeFileName.empty();
+}
+
+inline G4bool TG4EventCheckpoint::IsCheckpointed() const
+{
+  /// Return true if the current event was checkpointed
+  return fIsCheckpointed;
+}
+
+#endif // TG4_EVENT_CHECKPOINT_H
@@ -0,0 +1,75 @@
+#ifndef TG4_EVENT_CHECKPOINT_MESSENGER_H
+#define TG4_EVENT_CHECKPOINT_MESSENGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4EventCheckpointMessenger.h
+/// \brief Definition of the TG4EventCheckpointMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class TG4EventCheckpoint;
+
+class G4UIdirectory;
+class G4UIcommand;
+class G4UIcmdWithAString;
+class G4UIcmdWithADoubleAndUnit;
+
+/// \ingroup event
+/// \brief Messenger class that defines commands for the event checkpoint
+///
+/// Implements commands:
+/// - /mcEvent/checkpoint/setFileName fileName
+/// - /mcEvent/checkpoint/setMaxEventTime value unit
+/// - /mcEvent/checkpoint/resume [fileName]
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4EventCheckpointMessenger : public G4UImessenger
+{
+ public:
+  TG4EventCheckpointMessenger(TG4EventCheckpoint* eventCheckpoint);
+  virtual ~TG4EventCheckpointMessenger();
+
+  // methods
+  virtual void SetNewValue(G4UIcommand* command, G4String string);
+
+ private:
+  /// Not implemented
+  TG4EventCheckpointMessenger();
+  /// Not implemented
+  TG4EventCheckpointMessenger(const TG4EventCheckpointMessenger& right);
+  /// Not implemented
+  TG4EventCheckpointMessenger& operator=(
+    const TG4EventCheckpointMessenger& right);
+
+  //
+  // data members
+
+  /// associated class
+  TG4EventCheckpoint* fEventCheckpoint;
+
+  /// command directory
+  G4UIdirectory* fDirectory;
+
+  /// setFileName command
+  G4UIcmdWithAString* fSetFileNameCmd;
+
+  /// setMaxEventTime command
+  G4UIcmdWithADoubleAndUnit* fSetMaxEventTimeCmd;
+
+  /// resume command
+  G4UIcmdWithAString* fResumeCmd;
+};
+
+#endif // TG4_EVENT_CHECKPOINT_MESSENGER_H
@@ -15,17 +15,37 @@
 ///
 /// \author I. Hrivnacova; IPN, Orsay
 
+#include "TG4GeoTrackManagerMessenger.h"
 #include "TG4Verbose.h"
 
+#include <Rtypes.h>
 #include <globals.hh>
 
+#include <unordered_map>
+#include <vector>
+
 class G4Step;
+class G4Track;
 
 class TVirtualGeoTrack;
 
 /// \ingroup event
 /// \brief The manager class for collecting TGeo tracks for visualization
 ///
+/// The track points are collected per thread in a buffer of compact
+/// (x, y, z, t) single precision points with an index of the tracks
+/// by the track Id. The tracks are converted in TVirtualGeoTrack objects
+/// in the TGeoManager only at the end of event (FillRootTracks()), before
+/// the MC application FinishEvent() is called.
+///
+/// The number of points can be reduced with
+/// - the minimum distance between the stored points (0.01 cm by default);
+/// - the minimum change of the track direction: if the direction change
+///   at the last point is smaller, the last point is moved to the new
+///   position instead of adding a new point (not applied by default);
+/// - the maximum number of points per track: when it is reached, the last
+///   point is moved to the new position (no limit by default).
+///
 /// \author I. Hrivnacova; IPN, Orsay
 
 class TG4GeoTrackManager : public TG4Verbose
@@ -36,28 +56,109 @@ class TG4GeoTrackManager : public TG4Verbose
 
   // methods
   void UpdateRootTrack(const G4Step* step);
+  void FillRootTracks();
+  void ClearBuffer();
+
+  // set methods
+  void SetMinPointDistance(G4double minPointDistance);
+  void SetMinAngle(G4double minAngle);
+  void SetMaxNofPoints(G4int maxNofPoints);
+
+  // get methods
+  G4double GetMinPointDistance() const;
+  G4double GetMinAngle() const;
+  G4int GetMaxNofPoints() const;
+  std::size_t GetMemorySize() const;
 
  private:
+  /// The buffered track
+  struct TrackBuffer
+  {
+    Int_t fTrackID = -1;          ///< the track Id
+    Int_t fParentID = -1;         ///< the parent track Id
+    Int_t fPdg = 0;               ///< the particle PDG encoding
+    std::vector<Float_t> fPoints; ///< the (x, y, z, t) of the points
+  };
+
   /// Not implemented
   TG4GeoTrackManager(const TG4GeoTrackManager& right);
   /// Not implemented
   TG4GeoTrackManager& operator=(const TG4GeoTrackManager& right);
 
+  // methods
+  TrackBuffer* NewTrack();
+  void AddPoint(TrackBuffer& track, Double_t x, Double_t y, Double_t z,
+    Double_t t) const;
+  std::size_t GetMemorySize(TVirtualGeoTrack* track) const;
+
   // static data members
-  /// minimum point distance to store a point in TGeo track
-  static const G4double fgkMinPointDistance;
+  /// default minimum point distance to store a point in TGeo track
+  static const G4double fgkDefaultMinPointDistance;
 
   //
   // data members
 
-  /// control to collect Root tracks
-  G4bool fCollectTracks;
+  /// messenger
+  TG4GeoTrackManagerMessenger fMessenger;
+
+  /// minimum point distance to store a point in TGeo track (in cm)
+  G4double fMinPointDistance;
+
+  /// minimum change of the track direction to add a new point (in rad)
+  G4double fMinAngle;
+
+  /// cosine of fMinAngle
+  G4double fCosMinAngle;
+
+  /// maximum number of points per track (0 = no limit)
+  G4int fMaxNofPoints;
+
+  /// the buffered tracks (the entries are reused in the next events)
+  std::vector<TrackBuffer> fTracks;
 
-  /// current Root track
-  TVirtualGeoTrack* fCurrentTGeoTrack;
+  /// the number of buffered tracks in the current event
+  std::size_t fNofTracks;
 
-  /// parent of the current Root track
-  TVirtualGeoTrack* fParentTGeoTrack;
+  /// the index of the buffered tracks by the track Id
+  std::unordered_map<Int_t, std::size_t> fTrackIndex;
+
+  /// the G4 track of the current buffered track
+  const G4Track* fCurrentG4Track;
+
+  /// the index of the current buffered track
+  std::size_t fCurrentTrack;
 };
 
+// inline functions
+
+inline void TG4GeoTrackManager::SetMinPointDistance(G4double minPointDistance)
+{
+  /// Set the minimum distance between the stored points (in cm)
+  fMinPointDistance = minPointDistance;
+}
+
+inline void TG4GeoTrackManager::SetMaxNofPoints(G4int maxNofPoints)
+{
+  /// Set the maximum number of points per track (0 = no limit)
+  fMaxNofPoints = maxNofPoints;
+}
+
+inline G4double TG4GeoTrackManager::GetMinPointDistance() const
+{
+  /// Return the minimum distance between the stored points (in cm)
+  return fMinPointDistance;
+}
+
+inline G4double TG4GeoTrackManager::GetMinAngle() const
+{
+  /// Return the minimum change of the track direction to add a new point
+  return fMinAngle;
+}
+
+inline G4int TG4GeoTrackManager::GetMaxNofPoints() const
+{
+  /// Return the maximum number of points per track (0 = no limit)
+  return fMaxNofPoints;
+}
+
 #endif // TG4_GEO_TRAK_MANAGER_H
@@ -0,0 +1,76 @@
+#ifndef TG4_GEO_TRACK_MANAGER_MESSENGER_H
+#define TG4_GEO_TRACK_MANAGER_MESSENGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4GeoTrackManagerMessenger.h
+/// \brief Definition of the TG4GeoTrackManagerMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class TG4GeoTrackManager;
+
+class G4UIdirectory;
+class G4UIcommand;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAnInteger;
+
+/// \ingroup event
+/// \brief Messenger class that defines commands for the decimation
+///        of the collected TGeo tracks
+///
+/// Implements commands:
+/// - /mcTracking/geoTracks/setMinPointDistance value unit
+/// - /mcTracking/geoTracks/setMinAngle value unit
+/// - /mcTracking/geoTracks/setMaxNofPoints value
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4GeoTrackManagerMessenger : public G4UImessenger
+{
+ public:
+  TG4GeoTrackManagerMessenger(TG4GeoTrackManager* geoTrackManager);
+  virtual ~TG4GeoTrackManagerMessenger();
+
+  // methods
+  virtual void SetNewValue(G4UIcommand* command, G4String string);
+
+ private:
+  /// Not implemented
+  TG4GeoTrackManagerMessenger();
+  /// Not implemented
+  TG4GeoTrackManagerMessenger(const TG4GeoTrackManagerMessenger& right);
+  /// Not implemented
+  TG4GeoTrackManagerMessenger& operator=(
+    const TG4GeoTrackManagerMessenger& right);
+
+  //
+  // data members
+
+  /// associated class
+  TG4GeoTrackManager* fGeoTrackManager;
+
+  /// command directory
+  G4UIdirectory* fDirectory;
+
+  /// setMinPointDistance command
+  G4UIcmdWithADoubleAndUnit* fSetMinPointDistanceCmd;
+
+  /// setMinAngle command
+  G4UIcmdWithADoubleAndUnit* fSetMinAngleCmd;
+
+  /// setMaxNofPoints command
+  G4UIcmdWithAnInteger* fSetMaxNofPointsCmd;
+};
+
+#endif // TG4_GEO_TRACK_MANAGER_MESSENGER_H
@@ -0,0 +1,72 @@
+#ifndef TG4_MEMORY_ACCOUNTING_H
+#define TG4_MEMORY_ACCOUNTING_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4MemoryAccounting.h
+/// \brief Definition of the TG4MemoryAccounting class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <globals.hh>
+
+#include <map>
+
+/// \ingroup event
+/// \brief The per-thread accounting of the memory of the Geant4 VMC
+/// data structures
+///
+/// When activated (with /mcEvent/printMemoryAccounting command), the
+/// estimated footprint of the following Geant4 VMC owned data structures
+/// is printed at the end of each event in the lines starting with
+/// "MemAccounting":
+/// - mediumMap        - the TG4MediumMap
+/// - sdServices       - the TG4SDServices maps
+/// - rootGeometryMaps - the TG4RootDetectorConstruction maps (g4root only)
+/// - limits           - the TG4Limits instances
+/// - trackInformation - the TG4TrackInformation objects alive in the event
+/// - geoTracks        - the TGeo tracks collected by TG4GeoTrackManager
+/// - processMap       - the TG4ProcessMap
+/// - regions          - the regions, production cuts and the region data
+///
+/// For each item the size [kB] and its change since the previous event
+/// and since the first event of this thread are printed.
+/// The sizes are estimated from the container sizes and the typical
+/// container node overheads; they do not include the memory of the
+/// Geant4 objects referenced by the maps.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4MemoryAccounting
+{
+ public:
+  TG4MemoryAccounting();
+  ~TG4MemoryAccounting();
+
+  // methods
+  void Print(G4int eventID);
+
+ private:
+  /// Not implemented
+  TG4MemoryAccounting(const TG4MemoryAccounting& right);
+  /// Not implemented
+  TG4MemoryAccounting& operator=(const TG4MemoryAccounting& right);
+
+  // methods
+  void Collect(std::map<G4String, std::size_t>& sizes) const;
+
+  // data members
+  /// The sizes per item in the first accounted event
+  std::map<G4String, std::size_t> fFirstSizes;
+  /// The sizes per item in the previous accounted event
+  std::map<G4String, std::size_t> fPreviousSizes;
+};
+
+#endif // TG4_MEMORY_ACCOUNTING_H
@@ -16,6 +16,8 @@
 /// \author I. Hrivnacova; IPN, Orsay
 
 #include "TG4GeoTrackManager.h"
+#include "TG4OpticalYieldControl.h"
+#include "TG4StepReplay.h"
 #include "TG4SteppingActionMessenger.h"
 
 #include <G4UserSteppingAction.hh>
@@ -26,6 +28,8 @@ class TG4SpecialControlsV2;
 class TG4TrackManager;
 class TG4StepManager;
 class TG4StackPopper;
+class TG4ShowerLibraryModel;
+class TG4FieldTuner;
 
 class TVirtualMCApplication;
 
@@ -65,6 +69,7 @@ class TG4SteppingAction : public G4UserSteppingAction
   // the following method should not
   // be overwritten in a derived class
   virtual void UserSteppingAction(const G4Step* step);
+  void FillRootTracks();
 
   // set methods
   void SetLoopVerboseLevel(G4int level);
@@ -72,12 +77,16 @@ class TG4SteppingAction : public G4UserSteppingAction
   void SetSpecialControls(TG4SpecialControlsV2* specialControls);
   void SetIsPairCut(G4bool isPairCut);
   void SetCollectTracks(G4bool collectTracks);
+  void ResetNofSteps();
 
   // get methods
   G4int GetLoopVerboseLevel() const;
   G4int GetMaxNofSteps() const;
   G4bool GetIsPairCut() const;
   G4bool GetCollectTracks() const;
+  G4long GetNofSteps() const;
+  const TG4GeoTrackManager& GetGeoTrackManager() const;
+  TG4OpticalYieldControl& GetOpticalYieldControl();
 
  protected:
   // methods
@@ -107,6 +116,12 @@ class TG4SteppingAction : public G4UserSteppingAction
   /// manager for collecting TGeo tracks
   TG4GeoTrackManager fGeoTrackManager;
 
+  /// recorder of steps for the step manager accessors microbenchmark
+  TG4StepReplay fStepReplay;
+
+  /// control of the photon-yield-only mode of the optical processes
+  TG4OpticalYieldControl fOpticalYieldControl;
+
   /// the special controls manager
   TG4SpecialControlsV2* fSpecialControls;
 
@@ -122,6 +137,12 @@ class TG4SteppingAction : public G4UserSteppingAction
   /// Cached pointer to thread-local stack popper
   TG4StackPopper* fStackPopper;
 
+  /// Cached pointer to the shower library model (if recording)
+  TG4ShowerLibraryModel* fShowerLibraryModel;
+
+  /// Cached pointer to the field tuner (if sampling steps)
+  TG4FieldTuner* fFieldTuner;
+
   /// max number of allowed steps
   G4int fMaxNofSteps;
 
@@ -134,6 +155,9 @@ class TG4SteppingAction : public G4UserSteppingAction
   /// counter of step in looping
   G4int fLoopStepCounter;
 
+  /// counter of steps processed in this thread since the run start
+  G4long fNofSteps;
+
   /// control of cut on e+e- pair
   G4bool fIsPairCut;
 
@@ -186,6 +210,18 @@ inline void TG4SteppingAction::SetCollectTracks(G4bool collectTracks)
   fCollectTracks = collectTracks;
 }
 
+inline void TG4SteppingAction::ResetNofSteps()
+{
+  /// Reset the counter of processed steps
+  fNofSteps = 0;
+}
+
+inline void TG4SteppingAction::FillRootTracks()
+{
+  /// Fill the tracks collected in this event in the TGeoManager
+  fGeoTrackManager.FillRootTracks();
+}
+
 inline G4int TG4SteppingAction::GetMaxNofSteps() const
 {
   /// Get maximum number of steps allowed
@@ -210,4 +246,22 @@ inline G4bool TG4SteppingAction::GetCollectTracks() const
   return fCollectTracks;
 }
 
+inline G4long TG4SteppingAction::GetNofSteps() const
+{
+  /// Return the number of steps processed since the run start
+  return fNofSteps;
+}
+
+inline const TG4GeoTrackManager& TG4SteppingAction::GetGeoTrackManager() const
+{
+  /// Return the TGeo tracks manager
+  return fGeoTrackManager;
+}
+
+inline TG4OpticalYieldControl& TG4SteppingAction::GetOpticalYieldControl()
+{
+  /// Return the control of the photon-yield-only mode
+  return fOpticalYieldControl;
+}
+
 #endif // TG4_STEPPING_ACTION_H
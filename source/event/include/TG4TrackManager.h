@@ -73,6 +73,10 @@ class TG4TrackManager : public TG4Verbose
 
   void SaveSecondaries(const G4Track* track, const G4TrackVector* secondaries);
 
+  void AddTransfer(G4int nofTracks, G4int nofVertices, G4double time);
+  void PrintTransferStatistics() const;
+  void ResetTransferStatistics();
+
   // set methods
   void SetMCStack(TVirtualMCStack* mcStack);
   void SetMCManagerStack(TMCManagerStack* mcManagerStack);
@@ -88,6 +92,7 @@ class TG4TrackManager : public TG4Verbose
   TG4TrackSaveControl GetTrackSaveControl() const;
   G4bool GetSaveDynamicCharge() const;
   G4int GetNofTracks() const;
+  G4int GetPrimaryParticleId(G4int trackID) const;
   G4bool IsUserTrack(const G4Track* track) const;
 
  private:
@@ -123,6 +128,13 @@ class TG4TrackManager : public TG4Verbose
   G4int fTrackCounter;        ///< tracks counter
   G4int fCurrentTrackID;      ///< current track ID
   G4int fNofSavedSecondaries; ///< number of secondaries already saved
+
+  // the statistics of the tracks transferred from other engines
+  G4int fNofTransfers;          ///< number of transfers
+  G4int fNofTransferredTracks;  ///< number of transferred tracks
+  G4int fNofTransferVertices;   ///< number of their primary vertices
+  G4int fNofRestoredGeoStates;  ///< number of restored geometry states
+  G4double fTransferTime;       ///< time of the tracks transformation (s)
 #ifdef USE_G4ROOT
   TG4RootNavMgr* fRootNavMgr; ///< Pointer to RootNavMgr to communicate
                               ///< geometry states recovery
@@ -200,4 +212,10 @@ inline G4int TG4TrackManager::GetNofTracks() const
   return fTrackCounter;
 }
 
+inline G4int TG4TrackManager::GetPrimaryParticleId(G4int trackID) const
+{
+  /// Return the VMC stack Id of the primary particle with the given G4 track ID
+  return fPrimaryParticleIds[trackID - 1];
+}
+
 #endif // TG4_TRACK_MANAGER_H
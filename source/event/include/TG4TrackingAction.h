@@ -25,6 +25,9 @@ class TG4TrackInformation;
 class TG4TrackManager;
 class TG4StepManager;
 class TG4StackPopper;
+class TG4EventCheckpoint;
+class TG4OpticalDetectionMap;
+class TG4OpticalYieldControl;
 class TG4SpecialControlsV2;
 
 class TVirtualMCApplication;
@@ -110,6 +113,15 @@ class TG4TrackingAction : public G4UserTrackingAction, public TG4Verbose
   /// Cached pointer to thread-local stack popper
   TG4StackPopper* fStackPopper;
 
+  /// Cached pointer to thread-local event checkpoint
+  TG4EventCheckpoint* fEventCheckpoint;
+
+  /// Cached pointer to the optical detection map (if activated)
+  TG4OpticalDetectionMap* fOpticalDetectionMap;
+
+  /// Cached pointer to thread-local optical yield control (if activated)
+  TG4OpticalYieldControl* fOpticalYieldControl;
+
   /// current primary track ID
   G4int fPrimaryTrackID;
 
@@ -128,6 +140,10 @@ class TG4TrackingAction : public G4UserTrackingAction, public TG4Verbose
   /// track ID for which the new verbose level is applied
   G4int fNewVerboseTrackID;
 
+  /// Flag whether the current track is an optical photon with
+  /// the detection sampled from the optical detection map
+  G4bool fIsSampledPhoton;
+
   /// Flag whether for a newly picked up particle the
   /// TVirtualMCApplication::FinishPrimary should be called
   G4bool fDoFinishPrimary;
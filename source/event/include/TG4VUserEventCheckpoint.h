@@ -0,0 +1,52 @@
+#ifndef TG4_V_USER_EVENT_CHECKPOINT_H
+#define TG4_V_USER_EVENT_CHECKPOINT_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4VUserEventCheckpoint.h
+/// \brief Definition of the TG4VUserEventCheckpoint class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <globals.hh>
+
+/// \ingroup event
+/// \brief The abstract base class for saving and restoring the user
+/// application state (the VMC stack and hits) with the event checkpoint
+///
+/// See TG4EventCheckpoint for details.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4VUserEventCheckpoint
+{
+ public:
+  TG4VUserEventCheckpoint();
+  virtual ~TG4VUserEventCheckpoint();
+
+  /// Method to be overriden by user:
+  /// save the application event state in the file with the given name
+  virtual void Save(const G4String& fileName) = 0;
+
+  /// Method to be overriden by user:
+  /// restore the application event state from the file with the given name;
+  /// it is called after TVirtualMCApplication::BeginEvent().
+  /// The VMC stack must be restored with all tracks saved before the
+  /// checkpoint, as the resumed tracks keep their VMC stack indices.
+  virtual void Restore(const G4String& fileName) = 0;
+
+ private:
+  /// Not implemented
+  TG4VUserEventCheckpoint(const TG4VUserEventCheckpoint& right);
+  /// Not implemented
+  TG4VUserEventCheckpoint& operator=(const TG4VUserEventCheckpoint& right);
+};
+
+#endif // TG4_V_USER_EVENT_CHECKPOINT_H
@@ -14,9 +14,12 @@
 
 #include "TG4EventAction.h"
 #include "TG4Globals.h"
+#include "TG4MTProfiler.h"
 #include "TG4ParticlesManager.h"
 #include "TG4SDServices.h"
+#include "TG4ShowerLibraryModel.h"
 #include "TG4StateManager.h"
+#include "TG4SteppingAction.h"
 #include "TG4TrackManager.h"
 #include "TG4TrackingAction.h"
 
@@ -47,12 +50,17 @@ TG4EventAction::TG4EventAction()
   : TG4Verbose("eventAction"),
     fMessenger(this),
     fTimer(),
+    fMemoryAccounting(),
+    fEventCheckpoint(),
     fMCApplication(0),
     fMCStack(0),
     fTrackingAction(0),
+    fSteppingAction(0),
     fTrackManager(0),
     fStateManager(0),
+    fShowerLibraryModel(0),
     fPrintMemory(false),
+    fPrintMemoryAccounting(false),
     fSaveRandomStatus(false),
     fIsInterruptibleEvent(false)
 {
@@ -76,8 +84,14 @@ void TG4EventAction::LateInitialize()
 
   fMCApplication = TVirtualMCApplication::Instance();
   fTrackingAction = TG4TrackingAction::Instance();
+  fSteppingAction = TG4SteppingAction::Instance();
   fTrackManager = TG4TrackManager::Instance();
   fStateManager = TG4StateManager::Instance();
+
+  auto showerLibraryModel = TG4ShowerLibraryModel::Instance();
+  if (showerLibraryModel && showerLibraryModel->IsRecording()) {
+    fShowerLibraryModel = showerLibraryModel;
+  }
 }
 
 //_____________________________________________________________________________
@@ -85,6 +99,8 @@ void TG4EventAction::BeginOfEventAction(const G4Event* event)
 {
   /// Called by G4 kernel at the beginning of event.
 
+  TG4MTProfiler::StartEvent();
+
 #if G4VERSION_NUMBER == 1100
   // Temporary work-around for bug in Cerenkov
   static G4ThreadLocal auto applyCerenkovFix = true;
@@ -97,6 +113,9 @@ void TG4EventAction::BeginOfEventAction(const G4Event* event)
   // reset the tracks counters
   fTrackingAction->PrepareNewEvent();
 
+  // start the event checkpoint timer
+  fEventCheckpoint.BeginEvent();
+
   // fill primary particles in VMC stack if stack is empty
   if (fMCStack->GetNtrack() == 0) {
     if (VerboseLevel() > 0)
@@ -135,6 +154,12 @@ void TG4EventAction::EndOfEventAction(const G4Event* event)
   // G4cout << "Finish primary from event action" << G4endl;
   fTrackingAction->FinishPrimaryTrack();
 
+  // fill the tracks collected in this event in the TGeoManager
+  if (fSteppingAction) fSteppingAction->FillRootTracks();
+
+  // add the showers recorded in this event in the shower library
+  if (fShowerLibraryModel) fShowerLibraryModel->EndOfEvent();
+
   if (VerboseLevel() > 1) {
     G4cout << G4endl;
     G4cout << ">>> End of Event " << event->GetEventID() << G4endl;
@@ -165,11 +190,14 @@ void TG4EventAction::EndOfEventAction(const G4Event* event)
   }
 
   // VMC application finish event
-  if (!fIsInterruptibleEvent) {
+  // (not called if the event was checkpointed, it will be resumed)
+  if (!fIsInterruptibleEvent && !fEventCheckpoint.IsCheckpointed()) {
     fMCApplication->FinishEvent();
   }
   fStateManager->SetNewState(kNotInApplication);
 
+  TG4MTProfiler::EndEvent();
+
   if (VerboseLevel() > 1) {
     // print time
     fTimer.Stop();
@@ -182,4 +210,8 @@ void TG4EventAction::EndOfEventAction(const G4Event* event)
     G4cout << "Current memory usage: resident " << procInfo.fMemResident
            << ", virtual " << procInfo.fMemVirtual << G4endl;
   }
+
+  if (fPrintMemoryAccounting) {
+    fMemoryAccounting.Print(event->GetEventID());
+  }
 }
@@ -25,6 +25,7 @@ TG4EventActionMessenger::TG4EventActionMessenger(TG4EventAction* eventAction)
     fEventAction(eventAction),
     fEventDirectory(0),
     fPrintMemoryCmd(0),
+    fPrintMemoryAccountingCmd(0),
     fSaveRandomStatusCmd(0)
 {
   /// Standard constructor
@@ -38,6 +39,16 @@ TG4EventActionMessenger::TG4EventActionMessenger(TG4EventAction* eventAction)
   fPrintMemoryCmd->AvailableForStates(
     G4State_PreInit, G4State_Init, G4State_Idle);
 
+  fPrintMemoryAccountingCmd =
+    new G4UIcmdWithABool("/mcEvent/printMemoryAccounting", this);
+  fPrintMemoryAccountingCmd->SetGuidance(
+    "Print the estimated memory of the VMC data structures per thread");
+  fPrintMemoryAccountingCmd->SetGuidance(
+    "and its growth over events at the end of event");
+  fPrintMemoryAccountingCmd->SetParameterName("PrintMemoryAccounting", false);
+  fPrintMemoryAccountingCmd->AvailableForStates(
+    G4State_PreInit, G4State_Init, G4State_Idle);
+
   fSaveRandomStatusCmd = new G4UIcmdWithABool("/mcEvent/saveRandom", this);
   fSaveRandomStatusCmd->SetGuidance("Save random engine status for each event");
   fSaveRandomStatusCmd->SetParameterName("SaveRandom", false);
@@ -52,6 +63,7 @@ TG4EventActionMessenger::~TG4EventActionMessenger()
 
   delete fEventDirectory;
   delete fPrintMemoryCmd;
+  delete fPrintMemoryAccountingCmd;
   delete fSaveRandomStatusCmd;
 }
 
@@ -68,6 +80,10 @@ void TG4EventActionMessenger::SetNewValue(
   if (command == fPrintMemoryCmd) {
     fEventAction->SetPrintMemory(fPrintMemoryCmd->GetNewBoolValue(newValue));
   }
+  else if (command == fPrintMemoryAccountingCmd) {
+    fEventAction->SetPrintMemoryAccounting(
+      fPrintMemoryAccountingCmd->GetNewBoolValue(newValue));
+  }
   else if (command == fSaveRandomStatusCmd) {
     fEventAction->SetSaveRandomStatus(
       fSaveRandomStatusCmd->GetNewBoolValue(newValue));
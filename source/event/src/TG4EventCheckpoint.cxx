@@ -0,0 +1,377 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4EventCheckpoint.cxx
+/// \brief Implementation of the TG4EventCheckpoint class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4EventCheckpoint.h"
+#include "TG4G3Units.h"
+#include "TG4Globals.h"
+#include "TG4ParticlesManager.h"
+#include "TG4TrackInformation.h"
+#include "TG4TrackManager.h"
+#include "TG4VUserEventCheckpoint.h"
+
+#include <G4Event.hh>
+#include <G4EventManager.hh>
+#include <G4IonTable.hh>
+#include <G4ParticleDefinition.hh>
+#include <G4ParticleTable.hh>
+#include <G4PrimaryParticle.hh>
+#include <G4PrimaryVertex.hh>
+#include <G4RunManager.hh>
+#include <G4StackManager.hh>
+#include <G4Threading.hh>
+#include <G4Track.hh>
+#include <G4VTrajectory.hh>
+#include <Randomize.hh>
+
+#include <TMCParticleStatus.h>
+#include <TVirtualMC.h>
+#include <TVirtualMCStack.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+// static data members
+G4ThreadLocal TG4EventCheckpoint* TG4EventCheckpoint::fgInstance = 0;
+
+namespace
+{
+
+G4double Now()
+{
+  return std::chrono::duration<G4double>(
+    std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+} // namespace
+
+//_____________________________________________________________________________
+TG4EventCheckpoint::TG4EventCheckpoint()
+  : TG4Verbose("eventCheckpoint"),
+    fMessenger(this),
+    fUserCheckpoint(0),
+    fFileName("g4checkpoint.txt"),
+    fResumeFileName(),
+    fMaxEventTime(0.),
+    fEventStartTime(0.),
+    fIsRequested(false),
+    fIsCheckpointed(false),
+    fParticlesStatus()
+{
+  /// Default constructor
+
+  if (fgInstance) {
+    TG4Globals::Exception("TG4EventCheckpoint", "TG4EventCheckpoint",
+      "Cannot create two instances of singleton.");
+  }
+
+  fgInstance = this;
+}
+
+//_____________________________________________________________________________
+TG4EventCheckpoint::~TG4EventCheckpoint()
+{
+  /// Destructor
+
+  delete fUserCheckpoint;
+  fgInstance = 0;
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+void TG4EventCheckpoint::WriteTrack(std::ofstream& file, const G4Track* track,
+  TG4TrackManager* trackManager) const
+{
+  /// Write the given pending track in the file; the secondary track is
+  /// saved in the VMC stack first if it was not yet saved.
+  /// The line format:
+  /// track pdg vmcId vmcParentId charge x y z t px py pz polX polY polZ weight
+  /// (in Geant4 units)
+
+  G4int vmcId = -1;
+  G4int vmcParentId = -1;
+  if (track->GetParentID() == 0) {
+    vmcId = trackManager->GetPrimaryParticleId(track->GetTrackID());
+  }
+  else {
+    TG4TrackInformation* trackInfo = trackManager->GetTrackInformation(track);
+    if (trackInfo->GetTrackParticleID() < 0) {
+      trackManager->TrackToStack(track);
+    }
+    vmcId = trackInfo->GetTrackParticleID();
+    vmcParentId = trackInfo->GetParentParticleID();
+  }
+
+  G4int pdg =
+    TG4ParticlesManager::Instance()->GetPDGEncoding(track->GetDefinition());
+  const G4ThreeVector& position = track->GetPosition();
+  G4ThreeVector momentum = track->GetMomentum();
+  const G4ThreeVector& polarization = track->GetPolarization();
+
+  file << "track " << pdg << " " << vmcId << " " << vmcParentId << " "
+       << track->GetDynamicParticle()->GetCharge() << " " << position.x()
+       << " " << position.y() << " " << position.z() << " "
+       << track->GetGlobalTime() << " " << momentum.x() << " " << momentum.y()
+       << " " << momentum.z() << " " << polarization.x() << " "
+       << polarization.y() << " " << polarization.z() << " "
+       << track->GetWeight() << std::endl;
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4EventCheckpoint::BeginEvent()
+{
+  /// Start the event timer
+
+  fEventStartTime = Now();
+  fIsCheckpointed = false;
+}
+
+//_____________________________________________________________________________
+G4bool TG4EventCheckpoint::IsDue() const
+{
+  /// Return true if the checkpoint was requested or if the event processing
+  /// time exceeded the limit
+
+  if (fIsCheckpointed) return false;
+
+  return fIsRequested ||
+         (fMaxEventTime > 0. && Now() - fEventStartTime > fMaxEventTime);
+}
+
+//_____________________________________________________________________________
+G4bool TG4EventCheckpoint::Write(const G4Track* currentTrack)
+{
+  /// Write the checkpoint of the current event at the start of the given
+  /// track and abort the event and the run.
+  /// Return false if the checkpoint cannot be written.
+
+  // do not try again in this event
+  fIsRequested = false;
+  fIsCheckpointed = true;
+
+  TG4TrackManager* trackManager = TG4TrackManager::Instance();
+  if (G4Threading::IsMultithreadedApplication() ||
+      trackManager->GetTrackSaveControl() == kDoNotSave) {
+    TG4Globals::Warning("TG4EventCheckpoint", "Write",
+      "The event checkpoint is available only in sequential mode" +
+        TG4Globals::Endl() + "with the tracks saved in the VMC stack.");
+    fIsCheckpointed = false;
+    return false;
+  }
+
+  std::ofstream file(fFileName);
+  if (!file) {
+    TG4Globals::Warning("TG4EventCheckpoint", "Write",
+      "Cannot open file " + TString(fFileName.data()));
+    fIsCheckpointed = false;
+    return false;
+  }
+
+  // Pop the tracks from the urgent and waiting stacks
+  G4StackManager* stackManager =
+    G4EventManager::GetEventManager()->GetStackManager();
+  stackManager->TransferStackedTracks(fWaiting, fUrgent);
+  std::vector<G4Track*> stackedTracks;
+  while (stackManager->GetNUrgentTrack() > 0) {
+    G4VTrajectory* trajectory = 0;
+    stackedTracks.push_back(stackManager->PopNextTrack(&trajectory));
+    delete trajectory;
+  }
+
+  G4int eventID =
+    G4EventManager::GetEventManager()->GetConstCurrentEvent()->GetEventID();
+
+  file << "# TG4EventCheckpoint" << std::endl;
+  file << "event " << eventID << std::endl;
+  file << std::setprecision(17);
+  WriteTrack(file, currentTrack, trackManager);
+  for (auto track : stackedTracks) {
+    WriteTrack(file, track, trackManager);
+    delete track;
+  }
+  file.close();
+
+  G4Random::saveEngineStatus((fFileName + ".rndm").c_str());
+
+  if (fUserCheckpoint) fUserCheckpoint->Save(fFileName + ".user");
+
+  // The current track is not processed
+  trackManager->SetTrackInformation(currentTrack)->SetInterrupt(true);
+
+  if (VerboseLevel() > 0) {
+    G4cout << "### Event " << eventID << " checkpointed with "
+           << stackedTracks.size() + 1 << " pending tracks in " << fFileName
+           << G4endl;
+  }
+
+  G4RunManager::GetRunManager()->AbortRun(false);
+
+  return true;
+}
+
+//_____________________________________________________________________________
+G4bool TG4EventCheckpoint::Resume(G4Event* event)
+{
+  /// Restore the user state, the random engine status and the pending tracks
+  /// from the checkpoint file set with SetResume().
+
+  G4String fileName = fResumeFileName;
+  fResumeFileName = "";
+
+  std::ifstream file(fileName);
+  if (!file) {
+    TG4Globals::Warning("TG4EventCheckpoint", "Resume",
+      "Cannot open file " + TString(fileName.data()));
+    return false;
+  }
+
+  if (fUserCheckpoint) fUserCheckpoint->Restore(fileName + ".user");
+
+  G4Random::restoreEngineStatus((fileName + ".rndm").c_str());
+
+  G4ParticleTable* particleTable = G4ParticleTable::GetParticleTable();
+  fParticlesStatus.clear();
+
+  G4int eventID = -1;
+  G4int maxVmcId = -1;
+  std::vector<G4PrimaryVertex*> vertices;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream input(line);
+    std::string key;
+    input >> key;
+
+    if (key == "event") {
+      input >> eventID;
+      continue;
+    }
+    if (key != "track") continue;
+
+    G4int pdg, vmcId, vmcParentId;
+    G4double charge, x, y, z, t, px, py, pz, polX, polY, polZ, weight;
+    input >> pdg >> vmcId >> vmcParentId >> charge >> x >> y >> z >> t >>
+      px >> py >> pz >> polX >> polY >> polZ >> weight;
+
+    G4ParticleDefinition* particleDefinition = particleTable->FindParticle(pdg);
+    if (!particleDefinition && pdg > 1000000000) {
+      particleDefinition = G4IonTable::GetIonTable()->GetIon(pdg);
+    }
+    if (!input || !particleDefinition) {
+      TG4Globals::Warning("TG4EventCheckpoint", "Resume",
+        "Skipped track in " + TString(fileName.data()) + ": " +
+          TString(line.data()));
+      continue;
+    }
+
+    auto primaryParticle =
+      new G4PrimaryParticle(particleDefinition, px, py, pz);
+    primaryParticle->SetCharge(charge);
+    primaryParticle->SetWeight(weight);
+    primaryParticle->SetPolarization(polX, polY, polZ);
+
+    auto vertex = new G4PrimaryVertex(x, y, z, t);
+    vertex->SetPrimary(primaryParticle);
+    vertices.push_back(vertex);
+
+    // The VMC track status (in VMC units)
+    auto status = new TMCParticleStatus();
+    status->fId = vmcId;
+    status->fParentId = vmcParentId;
+    status->fStepNumber = 0;
+    status->fTrackLength = 0.;
+    status->fPosition.SetXYZT(x * TG4G3Units::InverseLength(),
+      y * TG4G3Units::InverseLength(), z * TG4G3Units::InverseLength(),
+      t * TG4G3Units::InverseTime());
+    status->fMomentum.SetXYZM(px * TG4G3Units::InverseEnergy(),
+      py * TG4G3Units::InverseEnergy(), pz * TG4G3Units::InverseEnergy(),
+      particleDefinition->GetPDGMass() * TG4G3Units::InverseEnergy());
+    status->fPolarization.SetXYZ(polX, polY, polZ);
+    status->fWeight = weight;
+    fParticlesStatus.emplace_back(status);
+
+    maxVmcId = std::max(maxVmcId, std::max(vmcId, vmcParentId));
+  }
+
+  // The restored tracks keep their VMC indices, so the VMC stack must
+  // already contain them (restored by the user checkpoint in a new
+  // process); otherwise the primaries would be pushed in the stack again
+  // under other indices and the tracks would point to wrong particles
+  TVirtualMCStack* mcStack = TVirtualMC::GetMC()->GetStack();
+  if (!mcStack || mcStack->GetNtrack() <= maxVmcId) {
+    for (auto vertex : vertices) {
+      delete vertex;
+    }
+    fParticlesStatus.clear();
+
+    TString text = "The VMC stack does not contain the checkpointed tracks";
+    text += TG4Globals::Endl();
+    text += "(tracks in stack: ";
+    text += mcStack ? mcStack->GetNtrack() : 0;
+    text += ", required: ";
+    text += maxVmcId + 1;
+    text += ").";
+    text += TG4Globals::Endl();
+    text += "The stack contents must be restored via ";
+    text += "TG4VUserEventCheckpoint::Restore().";
+    TG4Globals::Exception("TG4EventCheckpoint", "Resume", text);
+    return false;
+  }
+
+  // Add the pending tracks as primaries with their VMC track status
+  TG4TrackManager* trackManager = TG4TrackManager::Instance();
+  for (std::size_t i = 0; i < vertices.size(); ++i) {
+    event->AddPrimaryVertex(vertices[i]);
+    // The status defines the VMC track index and parent of the primary
+    trackManager->AddParticleStatus(fParticlesStatus[i].get());
+  }
+
+  if (VerboseLevel() > 0) {
+    G4cout << "### Event " << eventID << " resumed with "
+           << fParticlesStatus.size() << " pending tracks from " << fileName
+           << G4endl;
+  }
+
+  return true;
+}
+
+//_____________________________________________________________________________
+void TG4EventCheckpoint::SetUserCheckpoint(
+  TG4VUserEventCheckpoint* userCheckpoint)
+{
+  /// Set the user checkpoint of the application state (the object is
+  /// then owned by this class)
+
+  if (fUserCheckpoint == userCheckpoint) return;
+
+  delete fUserCheckpoint;
+  fUserCheckpoint = userCheckpoint;
+}
+
+//_____________________________________________________________________________
+void TG4EventCheckpoint::SetResume(const G4String& fileName)
+{
+  /// Resume the checkpointed event from the given file in the next event;
+  /// the checkpoint file name is used if the given name is empty
+
+  fResumeFileName = fileName.empty() ? fFileName : fileName;
+}
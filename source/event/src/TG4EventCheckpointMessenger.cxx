@@ -0,0 +1,100 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4EventCheckpointMessenger.cxx
+/// \brief Implementation of the TG4EventCheckpointMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4EventCheckpointMessenger.h"
+#include "TG4EventCheckpoint.h"
+
+#include <G4SystemOfUnits.hh>
+#include <G4UIcmdWithADoubleAndUnit.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIdirectory.hh>
+
+//______________________________________________________________________________
+TG4EventCheckpointMessenger::TG4EventCheckpointMessenger(
+  TG4EventCheckpoint* eventCheckpoint)
+  : G4UImessenger(),
+    fEventCheckpoint(eventCheckpoint),
+    fDirectory(0),
+    fSetFileNameCmd(0),
+    fSetMaxEventTimeCmd(0),
+    fResumeCmd(0)
+{
+  /// Standard constructor
+
+  fDirectory = new G4UIdirectory("/mcEvent/checkpoint/");
+  fDirectory->SetGuidance("Event checkpoint control commands.");
+
+  fSetFileNameCmd =
+    new G4UIcmdWithAString("/mcEvent/checkpoint/setFileName", this);
+  fSetFileNameCmd->SetGuidance("Set the name of the checkpoint file;");
+  fSetFileNameCmd->SetGuidance(
+    "the random engine status and the user state are written in the files");
+  fSetFileNameCmd->SetGuidance("with the .rndm and .user extensions added.");
+  fSetFileNameCmd->SetParameterName("FileName", false);
+  fSetFileNameCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fSetMaxEventTimeCmd = new G4UIcmdWithADoubleAndUnit(
+    "/mcEvent/checkpoint/setMaxEventTime", this);
+  fSetMaxEventTimeCmd->SetGuidance(
+    "Set the maximum event processing time after which the event");
+  fSetMaxEventTimeCmd->SetGuidance(
+    "checkpoint is written and the run is aborted.");
+  fSetMaxEventTimeCmd->SetGuidance("(0 = no limit)");
+  fSetMaxEventTimeCmd->SetParameterName("MaxEventTime", false);
+  fSetMaxEventTimeCmd->SetDefaultUnit("s");
+  fSetMaxEventTimeCmd->SetRange("MaxEventTime >= 0.");
+  fSetMaxEventTimeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fResumeCmd = new G4UIcmdWithAString("/mcEvent/checkpoint/resume", this);
+  fResumeCmd->SetGuidance(
+    "Resume the checkpointed event from the given file in the next event;");
+  fResumeCmd->SetGuidance(
+    "if no file is given, the checkpoint file name is used.");
+  fResumeCmd->SetParameterName("FileName", true);
+  fResumeCmd->SetDefaultValue("");
+  fResumeCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//______________________________________________________________________________
+TG4EventCheckpointMessenger::~TG4EventCheckpointMessenger()
+{
+  /// Destructor
+
+  delete fDirectory;
+  delete fSetFileNameCmd;
+  delete fSetMaxEventTimeCmd;
+  delete fResumeCmd;
+}
+
+//
+// public methods
+//
+
+//______________________________________________________________________________
+void TG4EventCheckpointMessenger::SetNewValue(
+  G4UIcommand* command, G4String newValue)
+{
+  /// Apply command to the associated object.
+
+  if (command == fSetFileNameCmd) {
+    fEventCheckpoint->SetFileName(newValue);
+  }
+  else if (command == fSetMaxEventTimeCmd) {
+    fEventCheckpoint->SetMaxEventTime(
+      fSetMaxEventTimeCmd->GetNewDoubleValue(newValue) / s);
+  }
+  else if (command == fResumeCmd) {
+    fEventCheckpoint->SetResume(newValue);
+  }
+}
@@ -14,24 +14,45 @@
 
 #include "TG4GeoTrackManager.h"
 #include "TG4Globals.h"
+#include "TG4MTProfiler.h"
+#include "TG4MemorySize.h"
 
+#include <G4AutoLock.hh>
 #include <G4Track.hh>
 
 #include <TDatabasePDG.h>
 #include <TGeoManager.h>
+#include <TGeoTrack.h>
+#include <TMath.h>
 #include <TParticlePDG.h>
 #include <TVirtualGeoTrack.h>
 #include <TVirtualMC.h>
+#include <TVirtualMCStack.h>
+
+#include <cmath>
+
+namespace
+{
+// Mutex to lock filling tracks in the TGeoManager
+G4Mutex fillRootTracksMutex = G4MUTEX_INITIALIZER;
+} // namespace
 
 // static data members
-const G4double TG4GeoTrackManager::fgkMinPointDistance = 0.01;
+const G4double TG4GeoTrackManager::fgkDefaultMinPointDistance = 0.01;
 
 //_____________________________________________________________________________
 TG4GeoTrackManager::TG4GeoTrackManager()
   : TG4Verbose("geoTrackManager"),
-    fCollectTracks(kFALSE),
-    fCurrentTGeoTrack(0),
-    fParentTGeoTrack(0)
+    fMessenger(this),
+    fMinPointDistance(fgkDefaultMinPointDistance),
+    fMinAngle(0.),
+    fCosMinAngle(1.),
+    fMaxNofPoints(0),
+    fTracks(),
+    fNofTracks(0),
+    fTrackIndex(),
+    fCurrentG4Track(0),
+    fCurrentTrack(0)
 {
   /// Default constructor
 }
@@ -42,6 +63,97 @@ TG4GeoTrackManager::~TG4GeoTrackManager()
   /// Destructor
 }
 
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+TG4GeoTrackManager::TrackBuffer* TG4GeoTrackManager::NewTrack()
+{
+  /// Return a new track buffer; the buffers from the previous events
+  /// are reused to keep the allocated points capacity
+
+  if (fNofTracks == fTracks.size()) {
+    fTracks.emplace_back();
+  }
+
+  TrackBuffer* track = &fTracks[fNofTracks++];
+  track->fPoints.clear();
+  return track;
+}
+
+//_____________________________________________________________________________
+void TG4GeoTrackManager::AddPoint(
+  TrackBuffer& track, Double_t x, Double_t y, Double_t z, Double_t t) const
+{
+  /// Add the point to the buffered track or move its last point
+  /// according to the decimation settings
+
+  std::vector<Float_t>& points = track.fPoints;
+  std::size_t nofPoints = points.size() / 4;
+
+  Bool_t moveLast = kFALSE;
+  if (nofPoints > 0) {
+    // Skip point if its distance from the previous one is smaller
+    // than the limit
+    const Float_t* last = &points[points.size() - 4];
+    Double_t dx = x - last[0];
+    Double_t dy = y - last[1];
+    Double_t dz = z - last[2];
+    Double_t dist2 = dx * dx + dy * dy + dz * dz;
+    if (dist2 < fMinPointDistance * fMinPointDistance) return;
+
+    if (fMaxNofPoints > 0 && nofPoints >= std::size_t(fMaxNofPoints)) {
+      moveLast = kTRUE;
+    }
+    else if (fMinAngle > 0. && nofPoints > 1) {
+      // Move the last point if the direction change is smaller
+      // than the limit
+      const Float_t* prev = last - 4;
+      Double_t px = last[0] - prev[0];
+      Double_t py = last[1] - prev[1];
+      Double_t pz = last[2] - prev[2];
+      Double_t prev2 = px * px + py * py + pz * pz;
+      if (prev2 > 0. &&
+          px * dx + py * dy + pz * dz >
+            fCosMinAngle * TMath::Sqrt(prev2 * dist2)) {
+        moveLast = kTRUE;
+      }
+    }
+  }
+
+  if (moveLast) {
+    points.resize(points.size() - 4);
+  }
+
+  points.push_back(x);
+  points.push_back(y);
+  points.push_back(z);
+  points.push_back(t);
+
+  if (VerboseLevel() > 2) {
+    G4cout << (moveLast ? "Moved" : "Added") << " point (x,y,z,t)=" << x
+           << ", " << y << ", " << z << ", " << t << G4endl;
+  }
+}
+
+//_____________________________________________________________________________
+std::size_t TG4GeoTrackManager::GetMemorySize(TVirtualGeoTrack* track) const
+{
+  /// Return the estimated size (in bytes) of the given TGeo track
+  /// with all its daughters; each point takes 4 doubles (x, y, z, t)
+
+  std::size_t size = sizeof(TGeoTrack) +
+                     track->GetNpoints() * 4 * sizeof(Double_t) +
+                     track->GetNdaughters() * sizeof(void*);
+
+  for (Int_t i = 0; i < track->GetNdaughters(); ++i) {
+    size += GetMemorySize(track->GetDaughter(i));
+  }
+
+  return size;
+}
+
 //
 // public methods
 //
@@ -49,65 +161,142 @@ TG4GeoTrackManager::~TG4GeoTrackManager()
 //_____________________________________________________________________________
 void TG4GeoTrackManager::UpdateRootTrack(const G4Step* step)
 {
-  /// Update the TGeo track with a current step point
-
-  G4Track* track = step->GetTrack();
-  G4int stepNumber = track->GetCurrentStepNumber();
-
-  if (stepNumber == 1) {
-    // Find and update parent track if it exists
-    Int_t trackNumber = gMC->GetStack()->GetCurrentTrackNumber();
-    Int_t parentTrackNumber = gMC->GetStack()->GetCurrentParentTrackNumber();
-    Int_t pdg = gMC->TrackPid();
-    if (parentTrackNumber >= 0) {
-      fParentTGeoTrack = gGeoManager->FindTrackWithId(parentTrackNumber);
-      if (!fParentTGeoTrack) {
-        TString text = "No parent track with id=";
-        text += parentTrackNumber;
-        TG4Globals::Exception("TG4GeoTrackManager", "UpdateRootTrack", text);
-      }
-      fCurrentTGeoTrack = fParentTGeoTrack->AddDaughter(trackNumber, pdg);
-      gGeoManager->SetCurrentTrack(fCurrentTGeoTrack);
+  /// Update the buffered track with a current step point
 
-      if (VerboseLevel() > 1) {
-        G4cout << "New TGeo track with id=" << trackNumber << "  pdg=" << pdg
-               << "  parent=" << parentTrackNumber << G4endl;
+  const G4Track* g4Track = step->GetTrack();
+
+  if (g4Track->GetCurrentStepNumber() == 1) {
+    // Create a new buffered track
+    TrackBuffer* track = NewTrack();
+    track->fTrackID = gMC->GetStack()->GetCurrentTrackNumber();
+    track->fParentID = gMC->GetStack()->GetCurrentParentTrackNumber();
+    track->fPdg = gMC->TrackPid();
+    fCurrentTrack = fNofTracks - 1;
+    fTrackIndex[track->fTrackID] = fCurrentTrack;
+
+    if (VerboseLevel() > 1) {
+      G4cout << "New TGeo track with id=" << track->fTrackID
+             << "  pdg=" << track->fPdg << "  parent=" << track->fParentID
+             << G4endl;
+    }
+  }
+  else if (g4Track != fCurrentG4Track) {
+    // Find the buffered track of a resumed track
+    auto it = fTrackIndex.find(gMC->GetStack()->GetCurrentTrackNumber());
+    if (it == fTrackIndex.end()) return;
+    fCurrentTrack = it->second;
+  }
+  fCurrentG4Track = g4Track;
+
+  Double_t x, y, z;
+  gMC->TrackPosition(x, y, z);
+  AddPoint(fTracks[fCurrentTrack], x, y, z, gMC->TrackTime());
+}
+
+//_____________________________________________________________________________
+void TG4GeoTrackManager::FillRootTracks()
+{
+  /// Convert the buffered tracks in the TGeo tracks in the TGeoManager
+  /// and clear the buffer
+
+  if (!fNofTracks) return;
+
+  if (!gGeoManager) {
+    ClearBuffer();
+    return;
+  }
+
+  G4AutoLock lm(&fillRootTracksMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "TG4GeoTrackManager::FillRootTracks");
+
+  // The parent tracks are always buffered before their daughters
+  std::vector<TVirtualGeoTrack*> geoTracks(fNofTracks, 0);
+  for (std::size_t i = 0; i < fNofTracks; ++i) {
+    const TrackBuffer& track = fTracks[i];
+
+    TVirtualGeoTrack* parent = 0;
+    if (track.fParentID >= 0) {
+      auto it = fTrackIndex.find(track.fParentID);
+      if (it != fTrackIndex.end() && it->second < i) {
+        parent = geoTracks[it->second];
+      }
+      else if (VerboseLevel() > 0) {
+        G4cout << "No parent TGeo track with id=" << track.fParentID
+               << ", track id=" << track.fTrackID << " added as primary"
+               << G4endl;
       }
     }
+
+    TVirtualGeoTrack* geoTrack = 0;
+    if (parent) {
+      geoTrack = parent->AddDaughter(track.fTrackID, track.fPdg);
+    }
     else {
-      Int_t itrack = gGeoManager->AddTrack(trackNumber, pdg);
-      gGeoManager->SetCurrentTrack(itrack);
-      fCurrentTGeoTrack = gGeoManager->GetCurrentTrack();
-      if (VerboseLevel() > 1) {
-        G4cout << "New primary TGeo track with id=" << trackNumber
-               << "  pdg=" << pdg << G4endl;
-      }
+      Int_t itrack = gGeoManager->AddTrack(track.fTrackID, track.fPdg);
+      geoTrack = gGeoManager->GetTrack(itrack);
     }
-    TParticlePDG* particle = TDatabasePDG::Instance()->GetParticle(pdg);
+    geoTracks[i] = geoTrack;
+
+    TParticlePDG* particle = TDatabasePDG::Instance()->GetParticle(track.fPdg);
     if (particle) {
-      fCurrentTGeoTrack->SetName(particle->GetName());
-      fCurrentTGeoTrack->SetParticle(particle);
+      geoTrack->SetName(particle->GetName());
+      geoTrack->SetParticle(particle);
+    }
+
+    const std::vector<Float_t>& points = track.fPoints;
+    for (std::size_t ip = 0; ip < points.size(); ip += 4) {
+      geoTrack->AddPoint(
+        points[ip], points[ip + 1], points[ip + 2], points[ip + 3]);
     }
   }
 
-  // Skip point if its distance from the previous one is smaller than the limit
-  Double_t x, y, z;
-  gMC->TrackPosition(x, y, z);
-  Bool_t skipPoint = kFALSE;
-  if (fCurrentTGeoTrack->HasPoints()) {
-    Double_t xo, yo, zo, to;
-    fCurrentTGeoTrack->GetLastPoint(xo, yo, zo, to);
-    Double_t rdist = TMath::Sqrt(
-      (xo - x) * (xo - x) + (yo - y) * (yo - y) + (zo - z) * (zo - z));
-    if (rdist < fgkMinPointDistance) skipPoint = kTRUE;
+  if (VerboseLevel() > 1) {
+    G4cout << fNofTracks << " TGeo tracks filled" << G4endl;
   }
-  if (skipPoint) return;
 
-  // Add point to the track
-  G4double time = gMC->TrackTime();
-  fCurrentTGeoTrack->AddPoint(x, y, z, time);
-  if (VerboseLevel() > 2) {
-    G4cout << "Added point (x,y,z,t)=" << x << ", " << y << ", " << z << ", "
-           << time << G4endl;
+  lm.unlock();
+
+  ClearBuffer();
+}
+
+//_____________________________________________________________________________
+void TG4GeoTrackManager::ClearBuffer()
+{
+  /// Clear the buffered tracks (keeping the allocated memory)
+
+  fNofTracks = 0;
+  fTrackIndex.clear();
+  fCurrentG4Track = 0;
+  fCurrentTrack = 0;
+}
+
+//_____________________________________________________________________________
+void TG4GeoTrackManager::SetMinAngle(G4double minAngle)
+{
+  /// Set the minimum change of the track direction to add a new point
+  /// (in rad); 0 means that the decimation by angle is not applied
+
+  fMinAngle = minAngle;
+  fCosMinAngle = std::cos(minAngle);
+}
+
+//_____________________________________________________________________________
+std::size_t TG4GeoTrackManager::GetMemorySize() const
+{
+  /// Return the estimated size (in bytes) of the buffered tracks
+  /// and the TGeo tracks collected in the geometry manager
+
+  std::size_t size = fTracks.capacity() * sizeof(TrackBuffer) +
+                     TG4MemorySize::Of(fTrackIndex);
+  for (const auto& track : fTracks) {
+    size += track.fPoints.capacity() * sizeof(Float_t);
   }
+
+  if (!gGeoManager) return size;
+
+  for (Int_t i = 0; i < gGeoManager->GetNtracks(); ++i) {
+    size += GetMemorySize(gGeoManager->GetTrack(i));
+  }
+
+  return size;
 }
@@ -0,0 +1,106 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4GeoTrackManagerMessenger.cxx
+/// \brief Implementation of the TG4GeoTrackManagerMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4GeoTrackManagerMessenger.h"
+#include "TG4G3Units.h"
+#include "TG4GeoTrackManager.h"
+
+#include <G4UIcmdWithADoubleAndUnit.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIdirectory.hh>
+
+//______________________________________________________________________________
+TG4GeoTrackManagerMessenger::TG4GeoTrackManagerMessenger(
+  TG4GeoTrackManager* geoTrackManager)
+  : G4UImessenger(),
+    fGeoTrackManager(geoTrackManager),
+    fDirectory(0),
+    fSetMinPointDistanceCmd(0),
+    fSetMinAngleCmd(0),
+    fSetMaxNofPointsCmd(0)
+{
+  /// Standard constructor
+
+  fDirectory = new G4UIdirectory("/mcTracking/geoTracks/");
+  fDirectory->SetGuidance(
+    "Control of the TGeo tracks collected with TVirtualMC::SetCollectTracks.");
+
+  fSetMinPointDistanceCmd = new G4UIcmdWithADoubleAndUnit(
+    "/mcTracking/geoTracks/setMinPointDistance", this);
+  fSetMinPointDistanceCmd->SetGuidance(
+    "Set the minimum distance between the stored track points.");
+  fSetMinPointDistanceCmd->SetParameterName("MinPointDistance", false);
+  fSetMinPointDistanceCmd->SetDefaultUnit("mm");
+  fSetMinPointDistanceCmd->SetRange("MinPointDistance >= 0.");
+  fSetMinPointDistanceCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fSetMinAngleCmd = new G4UIcmdWithADoubleAndUnit(
+    "/mcTracking/geoTracks/setMinAngle", this);
+  fSetMinAngleCmd->SetGuidance(
+    "Set the minimum change of the track direction for storing a new point;");
+  fSetMinAngleCmd->SetGuidance(
+    "the last point is moved when the direction change is smaller.");
+  fSetMinAngleCmd->SetGuidance("(0 = the decimation by angle is not applied)");
+  fSetMinAngleCmd->SetParameterName("MinAngle", false);
+  fSetMinAngleCmd->SetDefaultUnit("deg");
+  fSetMinAngleCmd->SetRange("MinAngle >= 0.");
+  fSetMinAngleCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fSetMaxNofPointsCmd = new G4UIcmdWithAnInteger(
+    "/mcTracking/geoTracks/setMaxNofPoints", this);
+  fSetMaxNofPointsCmd->SetGuidance(
+    "Set the maximum number of stored points per track;");
+  fSetMaxNofPointsCmd->SetGuidance(
+    "the last point is moved when the limit is reached.");
+  fSetMaxNofPointsCmd->SetGuidance("(0 = no limit)");
+  fSetMaxNofPointsCmd->SetParameterName("MaxNofPoints", false);
+  fSetMaxNofPointsCmd->SetRange("MaxNofPoints >= 0");
+  fSetMaxNofPointsCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+//______________________________________________________________________________
+TG4GeoTrackManagerMessenger::~TG4GeoTrackManagerMessenger()
+{
+  /// Destructor
+
+  delete fDirectory;
+  delete fSetMinPointDistanceCmd;
+  delete fSetMinAngleCmd;
+  delete fSetMaxNofPointsCmd;
+}
+
+//
+// public methods
+//
+
+//______________________________________________________________________________
+void TG4GeoTrackManagerMessenger::SetNewValue(
+  G4UIcommand* command, G4String newValue)
+{
+  /// Apply command to the associated object.
+
+  if (command == fSetMinPointDistanceCmd) {
+    fGeoTrackManager->SetMinPointDistance(
+      fSetMinPointDistanceCmd->GetNewDoubleValue(newValue) /
+      TG4G3Units::Length());
+  }
+  else if (command == fSetMinAngleCmd) {
+    fGeoTrackManager->SetMinAngle(
+      fSetMinAngleCmd->GetNewDoubleValue(newValue));
+  }
+  else if (command == fSetMaxNofPointsCmd) {
+    fGeoTrackManager->SetMaxNofPoints(
+      fSetMaxNofPointsCmd->GetNewIntValue(newValue));
+  }
+}
@@ -0,0 +1,130 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4MemoryAccounting.cxx
+/// \brief Implementation of the TG4MemoryAccounting class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4MemoryAccounting.h"
+#include "TG4GeoTrackManager.h"
+#include "TG4GeometryManager.h"
+#include "TG4GeometryServices.h"
+#include "TG4Limits.h"
+#include "TG4MediumMap.h"
+#include "TG4ProcessMap.h"
+#include "TG4RootDetectorConstruction.h"
+#include "TG4SDServices.h"
+#include "TG4SteppingAction.h"
+#include "TG4TrackInformation.h"
+#include "TG4VRegionsManager.h"
+
+#include <G4Threading.hh>
+
+#include <iomanip>
+
+//_____________________________________________________________________________
+TG4MemoryAccounting::TG4MemoryAccounting() : fFirstSizes(), fPreviousSizes()
+{
+  /// Default constructor
+}
+
+//_____________________________________________________________________________
+TG4MemoryAccounting::~TG4MemoryAccounting()
+{
+  /// Destructor
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+void TG4MemoryAccounting::Collect(std::map<G4String, std::size_t>& sizes) const
+{
+  /// Collect the estimated sizes (in bytes) of the accounted data structures
+
+  auto mediumMap = TG4GeometryServices::Instance()->GetMediumMap();
+  if (mediumMap) sizes["mediumMap"] = mediumMap->GetMemorySize();
+
+  sizes["sdServices"] = TG4SDServices::Instance()->GetMemorySize();
+
+  auto geometryManager = TG4GeometryManager::Instance();
+  if (geometryManager && geometryManager->GetRootDetectorConstruction()) {
+    sizes["rootGeometryMaps"] =
+      geometryManager->GetRootDetectorConstruction()->GetMapsMemorySize();
+  }
+
+  // TG4Limits do not own any heap data
+  sizes["limits"] = TG4Limits::GetNofLimits() * sizeof(TG4Limits);
+
+  // the allocator pages include the objects alive in this thread
+  sizes["trackInformation"] = TG4TrackInformation::GetAllocatedSize();
+
+  if (TG4SteppingAction::Instance()) {
+    sizes["geoTracks"] =
+      TG4SteppingAction::Instance()->GetGeoTrackManager().GetMemorySize();
+  }
+
+  if (TG4ProcessMap::Instance()) {
+    sizes["processMap"] = TG4ProcessMap::Instance()->GetMemorySize();
+  }
+
+  if (TG4VRegionsManager::Instance()) {
+    sizes["regions"] = TG4VRegionsManager::Instance()->GetMemorySize();
+  }
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4MemoryAccounting::Print(G4int eventID)
+{
+  /// Collect and print the estimated sizes (in kB) of the accounted data
+  /// structures and their changes since the previous and the first event
+
+  std::map<G4String, std::size_t> sizes;
+  Collect(sizes);
+
+  if (fFirstSizes.empty()) fFirstSizes = sizes;
+  if (fPreviousSizes.empty()) fPreviousSizes = sizes;
+
+  G4int threadId = G4Threading::G4GetThreadId();
+  G4double total = 0.;
+
+  G4cout << "### Memory accounting in thread " << threadId << " after event "
+         << eventID << " (" << TG4TrackInformation::GetNofInstances()
+         << " track information objects alive)" << G4endl;
+
+  auto flags = G4cout.flags();
+  auto precision = G4cout.precision();
+  G4cout << std::fixed << std::setprecision(1);
+
+  for (const auto& it : sizes) {
+    G4double size = it.second / 1024.;
+    G4double previousDelta = size - fPreviousSizes[it.first] / 1024.;
+    G4double firstDelta = size - fFirstSizes[it.first] / 1024.;
+    total += size;
+
+    G4cout << "MemAccounting " << std::setw(16) << std::left << it.first
+           << std::right << " thread " << threadId << " event " << eventID
+           << " sizeKB " << size << " deltaPreviousKB " << previousDelta
+           << " deltaFirstKB " << firstDelta << G4endl;
+  }
+  G4cout << "MemAccounting " << std::setw(16) << std::left << "total"
+         << std::right << " thread " << threadId << " event " << eventID
+         << " sizeKB " << total << G4endl;
+
+  G4cout.flags(flags);
+  G4cout.precision(precision);
+
+  fPreviousSizes = sizes;
+}
@@ -13,11 +13,14 @@
 /// \author I. Hrivnacova; IPN, Orsay
 
 #include "TG4SteppingAction.h"
+#include "TG4FieldTuner.h"
 #include "TG4G3Units.h"
+#include "TG4GeometryManager.h"
 #include "TG4Globals.h"
 #include "TG4Limits.h"
 #include "TG4SDServices.h"
 #include "TG4SensitiveDetector.h"
+#include "TG4ShowerLibraryModel.h"
 #include "TG4SpecialControlsV2.h"
 #include "TG4StackPopper.h"
 #include "TG4StepManager.h"
@@ -42,15 +45,20 @@ TG4SteppingAction::TG4SteppingAction()
   : G4UserSteppingAction(),
     fMessenger(this),
     fGeoTrackManager(),
+    fStepReplay(),
+    fOpticalYieldControl(),
     fSpecialControls(0),
     fMCApplication(0),
     fTrackManager(0),
     fStepManager(0),
     fStackPopper(0),
+    fShowerLibraryModel(0),
+    fFieldTuner(0),
     fMaxNofSteps(kMaxNofSteps),
     fStandardVerboseLevel(-1),
     fLoopVerboseLevel(1),
     fLoopStepCounter(0),
+    fNofSteps(0),
     fIsPairCut(false),
     fCollectTracks(false)
 {
@@ -322,6 +330,18 @@ void TG4SteppingAction::LateInitialize()
   fTrackManager = TG4TrackManager::Instance();
   fStepManager = TG4StepManager::Instance();
   fStackPopper = TG4StackPopper::Instance();
+
+  auto showerLibraryModel = TG4ShowerLibraryModel::Instance();
+  if (showerLibraryModel && showerLibraryModel->IsRecording()) {
+    fShowerLibraryModel = showerLibraryModel;
+  }
+
+  auto fieldTuner = TG4GeometryManager::Instance()->GetFieldTuner();
+  if (fieldTuner->IsActive()) {
+    fFieldTuner = fieldTuner;
+  }
+
+  fOpticalYieldControl.LateInitialize();
 }
 
 #include "TGeoManager.h"
@@ -335,6 +355,8 @@ void TG4SteppingAction::UserSteppingAction(const G4Step* step)
   /// there is defined SteppingAction(const G4Step* step) method
   /// for this purpose.
 
+  ++fNofSteps;
+
   // Fix creator process for secondaries if using gamma or neutron general process
   ProcessTrackIfGeneralProcess(step);
 
@@ -383,6 +405,23 @@ void TG4SteppingAction::UserSteppingAction(const G4Step* step)
     fSpecialControls->ApplyControls();
   }
 
+  // switch the optical photons stacking if entering a volume with
+  // the photon-yield-only medium or leaving it
+  if (step->GetPostStepPoint()->GetStepStatus() == fGeomBoundary &&
+      fOpticalYieldControl.IsActive()) {
+    fOpticalYieldControl.UpdateStacking(
+      step->GetPostStepPoint()->GetPhysicalVolume());
+  }
+
+  // record the step energy deposit in the shower library
+  if (fShowerLibraryModel) fShowerLibraryModel->RecordStep(step);
+
+  // sample the step for the field accuracy tuning
+  if (fFieldTuner) fFieldTuner->RecordStep(step);
+
+  // record the step for the step replay microbenchmark
+  if (fStepReplay.IsRecording()) fStepReplay.RecordStep(step);
+
   // call stepping action of derived class
   SteppingAction(step);
 
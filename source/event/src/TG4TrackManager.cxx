@@ -53,7 +53,12 @@ TG4TrackManager::TG4TrackManager()
     fSaveDynamicCharge(false),
     fTrackCounter(0),
     fCurrentTrackID(0),
-    fNofSavedSecondaries(0)
+    fNofSavedSecondaries(0),
+    fNofTransfers(0),
+    fNofTransferredTracks(0),
+    fNofTransferVertices(0),
+    fNofRestoredGeoStates(0),
+    fTransferTime(0.)
 #ifdef USE_G4ROOT
     // - TG4RootNavMgr is instantiated (cloned for worker) during construction
     // of TG4RunManager
@@ -101,8 +106,16 @@ void TG4TrackManager::LateInitialize()
   // Set recovery lambda
   if (fMCManager && fRootNavMgr) {
     fRootNavMgr->SetGeometryRestoreFunction([this](Int_t g4TrackId) -> Bool_t {
-      return fMCManager->RestoreGeometryState(
-        fPrimaryParticleIds[g4TrackId - 1]);
+      // Do not call the manager for the tracks without a stored geometry
+      // state (or with the state already restored)
+      if (g4TrackId < 1 || g4TrackId > G4int(fParticlesStatus.size()) ||
+          fParticlesStatus[g4TrackId - 1]->fGeoStateIndex == 0) {
+        return false;
+      }
+      Bool_t isRestored =
+        fMCManager->RestoreGeometryState(fPrimaryParticleIds[g4TrackId - 1]);
+      if (isRestored) ++fNofRestoredGeoStates;
+      return isRestored;
     });
   }
 #endif
@@ -127,6 +140,51 @@ void TG4TrackManager::AddParticleStatus(const TMCParticleStatus* particleStatus)
   fParticlesStatus.push_back((TMCParticleStatus*)particleStatus);
 }
 
+//_____________________________________________________________________________
+void TG4TrackManager::AddTransfer(
+  G4int nofTracks, G4int nofVertices, G4double time)
+{
+  /// Add the tracks transferred from another engine in one event
+  /// to the statistics
+
+  ++fNofTransfers;
+  fNofTransferredTracks += nofTracks;
+  fNofTransferVertices += nofVertices;
+  fTransferTime += time;
+}
+
+//_____________________________________________________________________________
+void TG4TrackManager::PrintTransferStatistics() const
+{
+  /// Print the statistics of the tracks transferred from other engines
+
+  if (fNofTransfers == 0) return;
+
+  G4cout << "### Transfers to " << gMC->GetName() << ": " << fNofTransfers
+         << " transfers, " << fNofTransferredTracks << " tracks in "
+         << fNofTransferVertices << " vertices, " << fNofRestoredGeoStates
+         << " restored geometry states" << G4endl;
+
+  G4cout << "    transformation time: " << fTransferTime << " s";
+  if (fNofTransferredTracks > 0) {
+    G4cout << " (" << fTransferTime / fNofTransferredTracks * 1.e6
+           << " us/track)";
+  }
+  G4cout << G4endl;
+}
+
+//_____________________________________________________________________________
+void TG4TrackManager::ResetTransferStatistics()
+{
+  /// Reset the statistics of the transferred tracks
+
+  fNofTransfers = 0;
+  fNofTransferredTracks = 0;
+  fNofTransferVertices = 0;
+  fNofRestoredGeoStates = 0;
+  fTransferTime = 0.;
+}
+
 //_____________________________________________________________________________
 TG4TrackInformation* TG4TrackManager::SetTrackInformation(
   const G4Track* track, G4bool overWrite)
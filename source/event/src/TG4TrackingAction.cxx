@@ -13,8 +13,13 @@
 /// \author I. Hrivnacova; IPN, Orsay
 
 #include "TG4TrackingAction.h"
+#include "TG4EventCheckpoint.h"
+#include "TG4GeometryManager.h"
 #include "TG4GeometryServices.h"
+#include "TG4GflashSensitiveDetector.h"
 #include "TG4Globals.h"
+#include "TG4OpticalDetectionMap.h"
+#include "TG4OpticalYieldControl.h"
 #include "TG4ParticlesManager.h"
 #include "TG4PhysicsManager.h"
 #include "TG4SDServices.h"
@@ -48,12 +53,16 @@ TG4TrackingAction::TG4TrackingAction()
     fMCStack(0),
     fStepManager(0),
     fStackPopper(0),
+    fEventCheckpoint(0),
+    fOpticalDetectionMap(0),
+    fOpticalYieldControl(0),
     fPrimaryTrackID(0),
     fCurrentTrackID(0),
     fTrackSaveControl(kDoNotSave),
     fOverwriteLastTrack(false),
     fNewVerboseLevel(0),
     fNewVerboseTrackID(-1),
+    fIsSampledPhoton(false),
     fDoFinishPrimary(true)
 {
   /// Default constructor
@@ -137,6 +146,26 @@ void TG4TrackingAction::LateInitialize()
   fMCApplication = TVirtualMCApplication::Instance();
   fStepManager = TG4StepManager::Instance();
   fStackPopper = TG4StackPopper::Instance();
+  fEventCheckpoint = TG4EventCheckpoint::Instance();
+
+  auto opticalDetectionMap =
+    TG4GeometryManager::Instance()->GetOpticalDetectionMap();
+  if (opticalDetectionMap->IsProduction() &&
+      fTrackManager->GetTrackSaveControl() == kSaveInStep) {
+    // the photons would be already saved in the VMC stack in step
+    TG4Globals::Warning("TG4TrackingAction", "LateInitialize",
+      "The optical detection map cannot be applied when saving secondaries"
+      " in step." + TG4Globals::Endl() + "The map is not applied.");
+  }
+  else if (opticalDetectionMap->IsCalibration() ||
+           opticalDetectionMap->IsProduction()) {
+    fOpticalDetectionMap = opticalDetectionMap;
+  }
+
+  auto opticalYieldControl = TG4OpticalYieldControl::Instance();
+  if (opticalYieldControl && opticalYieldControl->IsActive()) {
+    fOpticalYieldControl = opticalYieldControl;
+  }
 
   fTrackManager->LateInitialize();
 }
@@ -157,6 +186,8 @@ void TG4TrackingAction::PrepareNewEvent()
     fTrackManager->SetNofTracks(fMCStack->GetNtrack());
 
   fCurrentTrackID = 0;
+
+  if (fOpticalDetectionMap) fOpticalDetectionMap->ClearDetectedPhotons();
 }
 
 //_____________________________________________________________________________
@@ -172,6 +203,30 @@ void TG4TrackingAction::PreUserTrackingAction(const G4Track* track)
 
   G4bool isFirstStep = (track->GetCurrentStepNumber() == 0);
 
+  // write the event checkpoint (and abort the event) if it is due
+  if (fEventCheckpoint && isFirstStep && fEventCheckpoint->IsDue() &&
+      fEventCheckpoint->Write(track)) {
+    return;
+  }
+
+  // sample the optical photon detection from the map (the photon is not
+  // tracked) or record the photon origin for the map calibration
+  if (fOpticalDetectionMap && isFirstStep) {
+    if (fOpticalDetectionMap->IsProduction() &&
+        fOpticalDetectionMap->SamplePhoton(track)) {
+      fIsSampledPhoton = true;
+      return;
+    }
+    if (fOpticalDetectionMap->IsCalibration()) {
+      fOpticalDetectionMap->BeginPhoton(track);
+    }
+  }
+
+  // switch the optical photons stacking according to the track medium
+  if (fOpticalYieldControl) {
+    fOpticalYieldControl->UpdateStacking(track->GetVolume());
+  }
+
   // finish previous primary track first
   if (track->GetParentID() == 0 && isFirstStep) {
     FinishPrimaryTrack();
@@ -261,6 +316,20 @@ void TG4TrackingAction::PostUserTrackingAction(const G4Track* track)
 {
   /// Called by G4 kernel after finishing tracking.
 
+  // nothing to be done for the photon sampled from the optical map
+  if (fIsSampledPhoton) {
+    fIsSampledPhoton = false;
+    return;
+  }
+
+  // record the photon detection for the optical map calibration
+  if (fOpticalDetectionMap && fOpticalDetectionMap->IsCalibration()) {
+    fOpticalDetectionMap->EndPhoton(track);
+  }
+
+  // pass Gflash spots aggregated during this track to the user stepping
+  TG4GflashSensitiveDetector::FlushSpots();
+
 #ifdef STACK_WITH_KEEP_FLAG
   // Remember whether this track should be kept in the stack
   // or can be overwritten:
@@ -0,0 +1,27 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4VUserEventCheckpoint.cxx
+/// \brief Implementation of the TG4VUserEventCheckpoint class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4VUserEventCheckpoint.h"
+
+//_____________________________________________________________________________
+TG4VUserEventCheckpoint::TG4VUserEventCheckpoint()
+{
+  /// Default constructor
+}
+
+//_____________________________________________________________________________
+TG4VUserEventCheckpoint::~TG4VUserEventCheckpoint()
+{
+  /// Destructor
+}
@@ -26,6 +26,8 @@ class G4UIdirectory;
 class G4UIcmdWithoutParameter;
 class G4UIcmdWithABool;
 class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithADouble;
 class G4UIcmdWithADoubleAndUnit;
 
 /// \ingroup geometry
@@ -47,6 +49,14 @@ class G4UIcmdWithADoubleAndUnit;
 /// - /mcDet/setIsMaxStepInLowDensityMaterials true|false
 /// - /mcDet/setMaxStepInLowDensityMaterials value
 /// - /mcDet/setLimitDensity value
+/// - /mcDet/setGeometryCache true|false
+/// - /mcDet/setGeometryCacheDirectory dirName
+/// - /mcDet/setOptimizePlacements true|false
+/// - /mcDet/setMinNofOptimizedCopies value
+/// - /mcDet/setFieldClassification true|false
+/// - /mcDet/setFieldClassificationTolerance value
+/// - /mcDet/setZeroFieldTolerance value unit
+/// - /mcDet/setFieldClassificationNofSamples value
 /// - /mcDet/setNewRadiator volumeName xtrModel foilNumber
 /// - /mcDet/setRadiatorLayer materialName thickness [fluctuation]
 /// - /mcDet/setRadiatorStrawTube gasMaterialName wallThickness gassThickness
@@ -134,6 +144,30 @@ class TG4DetConstructionMessenger : public G4UImessenger
   /// command: setMaxStepInLowDensityMaterials
   G4UIcmdWithADoubleAndUnit* fSetMaxStepInLowDensityMaterialsCmd;
 
+  /// command: setGeometryCache
+  G4UIcmdWithABool* fSetGeometryCacheCmd;
+
+  /// command: setGeometryCacheDirectory
+  G4UIcmdWithAString* fSetGeometryCacheDirectoryCmd;
+
+  /// command: setOptimizePlacements
+  G4UIcmdWithABool* fSetOptimizePlacementsCmd;
+
+  /// command: setMinNofOptimizedCopies
+  G4UIcmdWithAnInteger* fSetMinNofOptimizedCopiesCmd;
+
+  /// command: setFieldClassification
+  G4UIcmdWithABool* fSetFieldClassificationCmd;
+
+  /// command: setFieldClassificationTolerance
+  G4UIcmdWithADouble* fSetFieldClassificationToleranceCmd;
+
+  /// command: setZeroFieldTolerance
+  G4UIcmdWithADoubleAndUnit* fSetZeroFieldToleranceCmd;
+
+  /// command: setFieldClassificationNofSamples
+  G4UIcmdWithAnInteger* fSetFieldClassificationNofSamplesCmd;
+
   /// command: setNewRadiator
   G4UIcommand* fSetNewRadiatorCmd;
 
@@ -58,6 +58,7 @@ class TG4Field
   G4EquationOfMotion* GetEquation() const;
   G4MagIntegratorStepper* GetStepper() const;
   G4VIntegrationDriver* GetIntegrationDriver() const;
+  const TG4FieldParameters* GetParameters() const;
 
  private:
   // methods
@@ -84,6 +85,8 @@ class TG4Field
   G4VIntegrationDriver* fDriver;
   /// Chord finder
   G4ChordFinder* fChordFinder;
+  /// The field parameters
+  const TG4FieldParameters* fParameters;
 };
 
 // inline functions
@@ -106,4 +109,10 @@ inline G4MagIntegratorStepper* TG4Field::GetStepper() const
   return fStepper;
 }
 
+inline const TG4FieldParameters* TG4Field::GetParameters() const
+{
+  /// Return the field parameters
+  return fParameters;
+}
+
 #endif // TG4_FIELD_H
@@ -0,0 +1,189 @@
+#ifndef TG4_FIELD_CLASSIFIER_H
+#define TG4_FIELD_CLASSIFIER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4FieldClassifier.h
+/// \brief Definition of the TG4FieldClassifier class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4Verbose.h"
+
+#include <G4RotationMatrix.hh>
+#include <G4ThreeVector.hh>
+#include <globals.hh>
+
+#include <map>
+#include <vector>
+
+class TG4FieldParameters;
+
+class G4ChordFinder;
+class G4FieldManager;
+class G4LogicalVolume;
+class G4MagneticField;
+class G4Mag_UsualEqRhs;
+class G4MagIntegratorStepper;
+class G4UniformMagField;
+class G4VPhysicalVolume;
+
+/// \ingroup geometry
+/// \brief The automatic classification of volumes in the global magnetic field
+///
+/// The global magnetic field is sampled on a regular grid over the extent
+/// of each logical volume in the global frame (the union of the bounding
+/// boxes of all its placements) and the volume is classified as:
+/// - zero field: the field magnitude is below the zero field tolerance
+///   in all sampled points; a field manager without field is attached
+///   to the volume
+/// - uniform field: the deviations of the sampled values from their mean
+///   are below the relative tolerance; a field manager with
+///   G4UniformMagField of the mean value and G4ExactHelixStepper is attached
+///   to the volume
+/// - general field: the volume is left with the global field manager
+///   and the stepper configured in the global field parameters.
+///
+/// Only the volumes without a field manager are classified, the volumes
+/// with local fields or with zero field set via the tracking medium
+/// ifield parameter are skipped.
+/// The daughters of replicated or parameterised volumes are sampled over
+/// the extent of their mother.
+///
+/// The classification is performed once and shared by all threads;
+/// the field managers are created per thread.
+/// The classification is activated with /mcDet/setFieldClassification true.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4FieldClassifier : public TG4Verbose
+{
+ public:
+  /// The volume field classification
+  enum FieldClass
+  {
+    kZeroField,    ///< field-free volume
+    kUniformField, ///< uniform field volume
+    kGeneralField  ///< general field volume
+  };
+
+ public:
+  TG4FieldClassifier();
+  ~TG4FieldClassifier();
+
+  // methods
+  void Classify(G4MagneticField* field, const TG4FieldParameters& parameters);
+
+  // set methods
+  void SetIsActive(G4bool isActive);
+  void SetTolerance(G4double tolerance);
+  void SetZeroFieldTolerance(G4double tolerance);
+  void SetNofSamples(G4int nofSamples);
+
+  // get methods
+  G4bool IsActive() const;
+
+ private:
+  /// The volume extent in the global frame
+  struct Extent
+  {
+    G4ThreeVector fMin;   ///< the lower box corner
+    G4ThreeVector fMax;   ///< the upper box corner
+    G4int fNofPlacements; ///< the number of placements
+  };
+
+  /// The volume classification result
+  struct Result
+  {
+    FieldClass fClass;    ///< the field class
+    G4ThreeVector fField; ///< the mean field value
+    G4int fNofPlacements; ///< the number of placements
+  };
+
+  /// The per-thread uniform field setting
+  struct UniformField
+  {
+    G4UniformMagField* fField;        ///< the uniform field
+    G4Mag_UsualEqRhs* fEquation;      ///< the equation of motion
+    G4MagIntegratorStepper* fStepper; ///< the exact helix stepper
+    G4ChordFinder* fChordFinder;      ///< the chord finder
+    G4FieldManager* fFieldManager;    ///< the field manager
+  };
+
+  /// Not implemented
+  TG4FieldClassifier(const TG4FieldClassifier& right);
+  /// Not implemented
+  TG4FieldClassifier& operator=(const TG4FieldClassifier& right);
+
+  // methods
+  void AddExtent(G4LogicalVolume* lv, const G4ThreeVector& min,
+    const G4ThreeVector& max,
+    std::map<G4LogicalVolume*, Extent>& extents) const;
+  void CollectExtents(G4VPhysicalVolume* pv, const G4RotationMatrix& rotation,
+    const G4ThreeVector& translation,
+    std::map<G4LogicalVolume*, Extent>& extents) const;
+  void CollectExtents(G4LogicalVolume* lv, const Extent& motherExtent,
+    std::map<G4LogicalVolume*, Extent>& extents) const;
+  Result ClassifyVolume(G4MagneticField* field, const Extent& extent) const;
+  void ComputeClassification(G4MagneticField* field);
+  G4FieldManager* GetUniformFieldManager(
+    const G4ThreeVector& value, const TG4FieldParameters& parameters);
+  void PrintReport() const;
+
+  // static data members
+  /// The per-thread uniform field settings
+  static G4ThreadLocal std::vector<UniformField>* fgUniformFields;
+  /// The per-thread zero field manager
+  static G4ThreadLocal G4FieldManager* fgZeroFieldManager;
+
+  // data members
+  G4bool fIsActive;        ///< option to activate the classification
+  G4bool fIsClassified;    ///< info if the classification was performed
+  G4double fTolerance;     ///< the relative tolerance for uniform field
+  G4double fZeroTolerance; ///< the absolute tolerance for zero field
+  G4int fNofSamples;       ///< the number of samples per axis
+
+  /// The classification results
+  std::map<G4LogicalVolume*, Result> fResults;
+};
+
+// inline functions
+
+inline void TG4FieldClassifier::SetIsActive(G4bool isActive)
+{
+  /// (In)Activate the classification
+  fIsActive = isActive;
+}
+
+inline void TG4FieldClassifier::SetTolerance(G4double tolerance)
+{
+  /// Set the relative tolerance for the uniform field classification
+  fTolerance = tolerance;
+}
+
+inline void TG4FieldClassifier::SetZeroFieldTolerance(G4double tolerance)
+{
+  /// Set the field magnitude tolerance for the zero field classification
+  fZeroTolerance = tolerance;
+}
+
+inline void TG4FieldClassifier::SetNofSamples(G4int nofSamples)
+{
+  /// Set the number of field samples per axis
+  fNofSamples = nofSamples;
+}
+
+inline G4bool TG4FieldClassifier::IsActive() const
+{
+  /// Return true if the classification is activated
+  return fIsActive;
+}
+
+#endif // TG4_FIELD_CLASSIFIER_H
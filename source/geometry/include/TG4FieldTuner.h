@@ -0,0 +1,172 @@
+#ifndef TG4_FIELD_TUNER_H
+#define TG4_FIELD_TUNER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4FieldTuner.h
+/// \brief Definition of the TG4FieldTuner class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4FieldTunerMessenger.h"
+#include "TG4Verbose.h"
+
+#include <G4ThreeVector.hh>
+#include <globals.hh>
+
+#include <map>
+#include <ostream>
+#include <vector>
+
+class TG4Field;
+
+class G4EquationOfMotion;
+class G4Field;
+class G4MagInt_Driver;
+class G4Step;
+
+/// \ingroup geometry
+/// \brief The calibration-driven tuning of the field integration accuracy
+///
+/// When activated, the charged particle steps in the fields defined via
+/// TVirtualMagField are sampled during the calibration events (the step
+/// starting point, momentum, charge, mass and length) per field.
+/// The tuning, triggered with the /mcDet/fieldTuning/tune command, then
+/// integrates each sampled step with the field stepper and the accuracy
+/// parameters scaled by a factor from 1 (the current parameters) to 1024
+/// and compares the step endpoints with a tight-tolerance reference.
+/// The field evaluations are counted as a measure of integration cost.
+///
+/// The parameter sets are tried from the current to the loosest one and
+/// the last one before the first failure, with the endpoint deviations
+/// within the user position and relative momentum budgets, is written
+/// in a macro with the /mcMagField commands, which can be loaded in the
+/// production job; the parameters are thus never tighter than the current
+/// ones. Only the delta one step and the epsilon step limits are scaled
+/// and validated; the delta chord and delta intersection, which control
+/// the boundary crossing accuracy and cannot be validated on isolated
+/// steps, are not written.
+///
+/// The steps are sampled in all threads without locking and merged
+/// at the end of run; the tuning is performed on master with the master
+/// fields. The FSAL steppers are not supported.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4FieldTuner : public TG4Verbose
+{
+ public:
+  TG4FieldTuner();
+  ~TG4FieldTuner();
+
+  // methods
+  void RecordStep(const G4Step* step);
+  void MergeSamples();
+  void Tune(const G4String& fileName);
+
+  // set methods
+  void SetIsActive(G4bool isActive);
+  void SetPositionBudget(G4double budget);
+  void SetMomentumBudget(G4double budget);
+  void SetMaxNofSamples(G4int maxNofSamples);
+
+  // get methods
+  G4bool IsActive() const;
+
+ private:
+  /// The sampled step
+  struct Sample
+  {
+    G4ThreeVector fPosition; ///< the step starting point
+    G4ThreeVector fMomentum; ///< the step starting momentum
+    G4double fCharge;        ///< the particle charge
+    G4double fMass;          ///< the particle mass
+    G4double fStepLength;    ///< the step length
+  };
+
+  /// The integration result for one parameter set
+  struct Result
+  {
+    G4double fScale;             ///< the parameters scale factor
+    G4double fMaxPositionDev;    ///< the maximum endpoint position deviation
+    G4double fMaxMomentumDev;    ///< the maximum relative momentum deviation
+    G4long fNofFieldEvaluations; ///< the number of field evaluations
+  };
+
+  /// Not implemented
+  TG4FieldTuner(const TG4FieldTuner& right);
+  /// Not implemented
+  TG4FieldTuner& operator=(const TG4FieldTuner& right);
+
+  // methods
+  G4int GetFieldIndex(const G4Field* field) const;
+  G4ThreeVector Integrate(G4MagInt_Driver& driver, G4EquationOfMotion* equation,
+    const Sample& sample, G4double epsilon, G4ThreeVector& momentum) const;
+  G4bool TuneField(TG4Field* field, const std::vector<Sample>& samples,
+    std::ostream& out) const;
+
+  // static data members
+  /// The per-thread map of fields to their indices
+  static G4ThreadLocal std::map<const G4Field*, G4int>* fgFieldIndices;
+  /// The per-thread sampled steps per field index
+  static G4ThreadLocal std::vector<std::vector<Sample> >* fgThreadSamples;
+  /// The relative accuracy of the reference integration
+  static const G4double fgkReferenceEpsilon;
+  /// The maximum accepted epsilon step
+  static const G4double fgkMaxEpsilonStep;
+
+  // data members
+  /// Messenger
+  TG4FieldTunerMessenger fMessenger;
+  /// Option to activate the steps sampling
+  G4bool fIsActive;
+  /// The budget for the endpoint position deviation
+  G4double fPositionBudget;
+  /// The budget for the endpoint relative momentum deviation
+  G4double fMomentumBudget;
+  /// The maximum number of sampled steps per field
+  G4int fMaxNofSamples;
+  /// The sampled steps per field index
+  std::vector<std::vector<Sample> > fSamples;
+};
+
+// inline functions
+
+inline void TG4FieldTuner::SetIsActive(G4bool isActive)
+{
+  /// (In)Activate the steps sampling
+  fIsActive = isActive;
+}
+
+inline void TG4FieldTuner::SetPositionBudget(G4double budget)
+{
+  /// Set the budget for the endpoint position deviation
+  fPositionBudget = budget;
+}
+
+inline void TG4FieldTuner::SetMomentumBudget(G4double budget)
+{
+  /// Set the budget for the endpoint relative momentum deviation
+  fMomentumBudget = budget;
+}
+
+inline void TG4FieldTuner::SetMaxNofSamples(G4int maxNofSamples)
+{
+  /// Set the maximum number of sampled steps per field
+  fMaxNofSamples = maxNofSamples;
+}
+
+inline G4bool TG4FieldTuner::IsActive() const
+{
+  /// Return true if the steps sampling is activated
+  return fIsActive;
+}
+
+#endif // TG4_FIELD_TUNER_H
@@ -0,0 +1,85 @@
+#ifndef TG4_FIELD_TUNER_MESSENGER_H
+#define TG4_FIELD_TUNER_MESSENGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4FieldTunerMessenger.h
+/// \brief Definition of the TG4FieldTunerMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class TG4FieldTuner;
+
+class G4UIdirectory;
+class G4UIcommand;
+class G4UIcmdWithABool;
+class G4UIcmdWithADouble;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+
+/// \ingroup geometry
+/// \brief Messenger class that defines commands for the field accuracy tuning
+///
+/// Implements commands:
+/// - /mcDet/fieldTuning/setActive true|false
+/// - /mcDet/fieldTuning/setPositionBudget value unit
+/// - /mcDet/fieldTuning/setMomentumBudget value
+/// - /mcDet/fieldTuning/setMaxNofSamples value
+/// - /mcDet/fieldTuning/tune fileName
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4FieldTunerMessenger : public G4UImessenger
+{
+ public:
+  TG4FieldTunerMessenger(TG4FieldTuner* fieldTuner);
+  virtual ~TG4FieldTunerMessenger();
+
+  // methods
+  virtual void SetNewValue(G4UIcommand* command, G4String string);
+
+ private:
+  /// Not implemented
+  TG4FieldTunerMessenger();
+  /// Not implemented
+  TG4FieldTunerMessenger(const TG4FieldTunerMessenger& right);
+  /// Not implemented
+  TG4FieldTunerMessenger& operator=(const TG4FieldTunerMessenger& right);
+
+  //
+  // data members
+
+  /// associated class
+  TG4FieldTuner* fFieldTuner;
+
+  /// command directory
+  G4UIdirectory* fDirectory;
+
+  /// setActive command
+  G4UIcmdWithABool* fSetActiveCmd;
+
+  /// setPositionBudget command
+  G4UIcmdWithADoubleAndUnit* fSetPositionBudgetCmd;
+
+  /// setMomentumBudget command
+  G4UIcmdWithADouble* fSetMomentumBudgetCmd;
+
+  /// setMaxNofSamples command
+  G4UIcmdWithAnInteger* fSetMaxNofSamplesCmd;
+
+  /// tune command
+  G4UIcmdWithAString* fTuneCmd;
+};
+
+#endif // TG4_FIELD_TUNER_MESSENGER_H
@@ -0,0 +1,115 @@
+#ifndef TG4_GEOMETRY_CACHE_H
+#define TG4_GEOMETRY_CACHE_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4GeometryCache.h
+/// \brief Definition of the TG4GeometryCache class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4Verbose.h"
+
+#include <globals.hh>
+
+#include <map>
+
+class TG4MediumMap;
+
+class G4LogicalVolume;
+class G4VPhysicalVolume;
+
+/// \ingroup geometry
+/// \brief The cache of the Geant4 geometry converted from Root
+///
+/// The Geant4 geometry converted from the Root geometry is saved in a GDML
+/// file together with the medium IDs mapped to the logical volumes
+/// (as the volumes auxiliary information). The file name contains
+/// the MD5 hash of the streamed Root geometry and the Geant4 version,
+/// so a job with the same Root geometry can load the cached Geant4
+/// geometry instead of converting it.
+///
+/// The cache is available only if Geant4 was built with GDML;
+/// it is activated with /mcDet/setGeometryCache true.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4GeometryCache : public TG4Verbose
+{
+ public:
+  TG4GeometryCache();
+  ~TG4GeometryCache();
+
+  // methods
+  G4VPhysicalVolume* Load();
+  G4bool Save(G4VPhysicalVolume* world, const TG4MediumMap* mediumMap);
+
+  // set methods
+  void SetIsActive(G4bool isActive);
+  void SetDirectory(const G4String& directory);
+
+  // get methods
+  G4bool IsActive() const;
+  G4bool IsLoaded() const;
+  G4int GetMediumId(G4LogicalVolume* lv) const;
+  G4String GetFileName();
+
+ private:
+  /// Not implemented
+  TG4GeometryCache(const TG4GeometryCache& right);
+  /// Not implemented
+  TG4GeometryCache& operator=(const TG4GeometryCache& right);
+
+  // methods
+  G4String ComputeHash() const;
+
+  // static data members
+  /// The cache format version (to be increased with incompatible changes)
+  static const G4int fgkFormatVersion;
+  /// The name of the volume auxiliary information with medium ID
+  static const G4String fgkMediumIdAuxType;
+
+  // data members
+  G4bool fIsActive;      ///< option to activate the cache
+  G4bool fIsLoaded;      ///< info if the geometry was loaded from the cache
+  G4String fDirectory;   ///< the cache directory
+  G4String fHash;        ///< the Root geometry hash
+
+  /// The medium IDs loaded from the cache
+  std::map<G4LogicalVolume*, G4int> fMediumIds;
+};
+
+// inline functions
+
+inline void TG4GeometryCache::SetIsActive(G4bool isActive)
+{
+  /// (In)Activate the cache
+  fIsActive = isActive;
+}
+
+inline void TG4GeometryCache::SetDirectory(const G4String& directory)
+{
+  /// Set the cache directory
+  fDirectory = directory;
+}
+
+inline G4bool TG4GeometryCache::IsActive() const
+{
+  /// Return true if the cache is activated
+  return fIsActive;
+}
+
+inline G4bool TG4GeometryCache::IsLoaded() const
+{
+  /// Return true if the geometry was loaded from the cache
+  return fIsLoaded;
+}
+
+#endif // TG4_GEOMETRY_CACHE_H
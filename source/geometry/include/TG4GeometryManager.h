@@ -22,11 +22,19 @@
 
 #include <vector>
 
+class TG4EmDegradation;
 class TG4Field;
+class TG4FieldClassifier;
+class TG4FieldTuner;
 class TG4GeometryServices;
 class TG4OpGeometryManager;
+class TG4GeometryCache;
+class TG4NavigationControl;
+class TG4OpticalDetectionMap;
+class TG4PlacementsOptimizer;
 class TG4ModelConfigurationManager;
 class TG4BiasingManager;
+class TG4ImportanceBiasingManager;
 class TG4G3CutVector;
 class TG4G3ControlVector;
 class TG4VUserRegionConstruction;
@@ -58,8 +66,20 @@ class TG4GeometryManager : public TG4Verbose
 
   TVirtualMCGeometry* GetMCGeometry() const;
   TG4OpGeometryManager* GetOpManager() const;
+  TG4GeometryCache* GetGeometryCache() const;
+  TG4PlacementsOptimizer* GetPlacementsOptimizer() const;
+  TG4FieldClassifier* GetFieldClassifier() const;
+  TG4FieldTuner* GetFieldTuner() const;
+  TG4NavigationControl* GetNavigationControl() const;
+  TG4OpticalDetectionMap* GetOpticalDetectionMap() const;
   TG4ModelConfigurationManager* GetFastModelsManager() const;
   TG4ModelConfigurationManager* GetEmModelsManager() const;
+  TG4BiasingManager* GetBiasingManager() const;
+  TG4ImportanceBiasingManager* GetImportanceBiasingManager() const;
+  TG4EmDegradation* GetEmDegradation() const;
+  TG4RootDetectorConstruction* GetRootDetectorConstruction() const;
+  G4int GetNofFields() const;
+  TG4Field* GetField(G4int index) const;
 
   // functions for building geometry
   void ConstructGeometry();
@@ -107,6 +127,7 @@ class TG4GeometryManager : public TG4Verbose
   void CreateMCGeometry();
   void ConstructG4GeometryViaVMC();
   void ConstructG4GeometryViaVGM();
+  G4bool ConstructG4GeometryFromCache();
   void ConstructG4Geometry();
   void FillMediumMapFromG3();
   void FillMediumMapFromG4();
@@ -118,6 +139,7 @@ class TG4GeometryManager : public TG4Verbose
   void ConstructGlobalField();
   void ConstructZeroFields();
   void ConstructLocalFields();
+  void ClassifyFieldVolumes();
 
   // static data members
   static TG4GeometryManager* fgInstance; ///< this instance
@@ -134,6 +156,12 @@ class TG4GeometryManager : public TG4Verbose
   TVirtualMCGeometry* fMCGeometry;        ///< VirtualMC geometry
   TG4RootDetectorConstruction* fRootDetectorConstruction; ///< Root detector construction
   TG4OpGeometryManager* fOpManager;       ///< optical geometry manager
+  TG4GeometryCache* fGeometryCache;       ///< converted geometry cache
+  TG4PlacementsOptimizer* fPlacementsOptimizer; ///< placements optimizer
+  TG4FieldClassifier* fFieldClassifier;   ///< field classifier
+  TG4FieldTuner* fFieldTuner;             ///< field accuracy tuner
+  TG4NavigationControl* fNavigationControl; ///< navigation control
+  TG4OpticalDetectionMap* fOpticalDetectionMap; ///< optical detection map
 
   /// Fast simulation models manager
   TG4ModelConfigurationManager* fFastModelsManager;
@@ -144,6 +172,12 @@ class TG4GeometryManager : public TG4Verbose
   /// Biasing manager
   TG4BiasingManager* fBiasingManager;
 
+  /// Importance biasing manager
+  TG4ImportanceBiasingManager* fImportanceBiasingManager;
+
+  /// EM physics degradation outside sensitive volumes
+  TG4EmDegradation* fEmDegradation;
+
   /// User geometry input
   G4String fUserGeometry;
 
@@ -198,6 +232,44 @@ inline TG4OpGeometryManager* TG4GeometryManager::GetOpManager() const
   return fOpManager;
 }
 
+inline TG4GeometryCache* TG4GeometryManager::GetGeometryCache() const
+{
+  /// Return the converted geometry cache
+  return fGeometryCache;
+}
+
+inline TG4PlacementsOptimizer*
+TG4GeometryManager::GetPlacementsOptimizer() const
+{
+  /// Return the placements optimizer
+  return fPlacementsOptimizer;
+}
+
+inline TG4FieldClassifier* TG4GeometryManager::GetFieldClassifier() const
+{
+  /// Return the field classifier
+  return fFieldClassifier;
+}
+
+inline TG4FieldTuner* TG4GeometryManager::GetFieldTuner() const
+{
+  /// Return the field accuracy tuner
+  return fFieldTuner;
+}
+
+inline TG4NavigationControl* TG4GeometryManager::GetNavigationControl() const
+{
+  /// Return the navigation control
+  return fNavigationControl;
+}
+
+inline TG4OpticalDetectionMap*
+TG4GeometryManager::GetOpticalDetectionMap() const
+{
+  /// Return the optical photon detection map
+  return fOpticalDetectionMap;
+}
+
 inline TG4ModelConfigurationManager*
 TG4GeometryManager::GetFastModelsManager() const
 {
@@ -212,6 +284,32 @@ TG4GeometryManager::GetEmModelsManager() const
   return fEmModelsManager;
 }
 
+inline TG4BiasingManager* TG4GeometryManager::GetBiasingManager() const
+{
+  /// Return the biasing manager
+  return fBiasingManager;
+}
+
+inline TG4ImportanceBiasingManager*
+TG4GeometryManager::GetImportanceBiasingManager() const
+{
+  /// Return the importance biasing manager
+  return fImportanceBiasingManager;
+}
+
+inline TG4EmDegradation* TG4GeometryManager::GetEmDegradation() const
+{
+  /// Return the EM physics degradation
+  return fEmDegradation;
+}
+
+inline TG4RootDetectorConstruction*
+TG4GeometryManager::GetRootDetectorConstruction() const
+{
+  /// Return Root detector construction (if g4root navigation is used)
+  return fRootDetectorConstruction;
+}
+
 inline void TG4GeometryManager::SetRootDetectorConstruction(
   TG4RootDetectorConstruction* rootDetectorConstruction)
 {
@@ -39,6 +39,7 @@ class TG4Medium
   void SetMaterial(G4Material* material);
   void SetLimits(G4UserLimits* limits);
   void SetIfield(G4int ifield);
+  void SetIsvol(G4int isvol);
 
   // get methods
   G4int GetID() const;
@@ -46,6 +47,7 @@ class TG4Medium
   G4Material* GetMaterial() const;
   G4UserLimits* GetLimits() const;
   G4int GetIfield() const;
+  G4int GetIsvol() const;
 
  private:
   /// Not implemented
@@ -58,6 +60,7 @@ class TG4Medium
   // static data members
   static const G4String fgkUndefinedName; ///< the default (undefined) name
   static const G4int fgkDefaultIfield;    ///< the default ifield value
+  static const G4int fgkDefaultIsvol;     ///< the default isvol value
 
   // data members
   G4int fID;             ///< medium ID
@@ -72,6 +75,9 @@ class TG4Medium
   /// -  2  tracking performed with helix
   /// -  3  constant magnetic field along z
   G4int fIfield;
+
+  /// G3 tracking medium parameter 'isvol' (sensitive volume flag)
+  G4int fIsvol;
 };
 
 // inline functions
@@ -81,6 +87,11 @@ inline void TG4Medium::SetIfield(G4int ifield)
   fIfield = ifield;
 }
 
+inline void TG4Medium::SetIsvol(G4int isvol)
+{ /// Set G3 tracking medium parameter 'isvol'
+  fIsvol = isvol;
+}
+
 inline G4int TG4Medium::GetID() const
 { /// Return ID
   return fID;
@@ -106,4 +117,9 @@ inline G4int TG4Medium::GetIfield() const
   return fIfield;
 }
 
+inline G4int TG4Medium::GetIsvol() const
+{ /// Return G3 tracking medium parameter 'isvol'
+  return fIsvol;
+}
+
 #endif // TG4_MEDIUM_H
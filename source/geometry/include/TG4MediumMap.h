@@ -50,6 +50,7 @@ class TG4MediumMap
   TG4Medium* GetMedium(const G4Material* material, G4bool warn = true) const;
   void GetMedia(const G4String& namePattern, std::vector<TG4Medium*>& media,
     G4bool warn = true) const;
+  std::size_t GetMemorySize() const;
 
  private:
   /// Not implemented
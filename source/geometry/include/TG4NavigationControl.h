@@ -0,0 +1,129 @@
+#ifndef TG4_NAVIGATION_CONTROL_H
+#define TG4_NAVIGATION_CONTROL_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4NavigationControl.h
+/// \brief Definition of the TG4NavigationControl class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4NavigationControlMessenger.h"
+#include "TG4Verbose.h"
+
+#include <globals.hh>
+
+#include <utility>
+#include <vector>
+
+class G4LogicalVolume;
+
+/// \ingroup geometry
+/// \brief The control of the Geant4 navigation voxelisation and
+///        the navigation profiling
+///
+/// The voxelisation of the logical volumes selected by their name or name
+/// pattern (ABC*) can be tuned with:
+/// - /mcDet/navigation/setSmartless name value - the smartless parameter
+///   (the average number of slices per contained volume, 2 by default)
+/// - /mcDet/navigation/setOptimisation name true|false - enables (default)
+///   or disables the voxelisation of the volume
+///
+/// The settings are applied after the geometry construction; when changed
+/// later, the geometry is reoptimised at the next run.
+/// The voxels memory per volume is printed with /mcDet/navigation/printVoxels.
+///
+/// When the profiling is activated (before initialization), the Geant4
+/// navigator for tracking is replaced in each thread with
+/// TG4ProfilingNavigator, which counts the ComputeStep() and ComputeSafety()
+/// calls per logical volume and samples their time. The profile is printed
+/// at the end of run. The profiling is not available with the geometry
+/// navigation via G4Root.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4NavigationControl : public TG4Verbose
+{
+ public:
+  TG4NavigationControl();
+  ~TG4NavigationControl();
+
+  // methods
+  void ApplySettings();
+  void CreateProfilingNavigator() const;
+  void PrintVoxels(G4int nofVolumes) const;
+
+  // set methods
+  void SetSmartless(const G4String& namePattern, G4double smartless);
+  void SetOptimisation(const G4String& namePattern, G4bool optimisation);
+  void SetIsProfiling(G4bool isProfiling);
+  void SetSamplingPeriod(G4int samplingPeriod);
+  void SetNofProfiledVolumes(G4int nofVolumes);
+
+  // get methods
+  G4bool IsProfiling() const;
+
+ private:
+  /// Not implemented
+  TG4NavigationControl(const TG4NavigationControl& right);
+  /// Not implemented
+  TG4NavigationControl& operator=(const TG4NavigationControl& right);
+
+  // methods
+  std::vector<G4LogicalVolume*> GetVolumes(const G4String& namePattern) const;
+  void ApplySmartless(const G4String& namePattern, G4double smartless) const;
+  void ApplyOptimisation(
+    const G4String& namePattern, G4bool optimisation) const;
+  void GeometryModified() const;
+
+  // data members
+  /// Messenger
+  TG4NavigationControlMessenger fMessenger;
+  /// The smartless settings (name pattern, value)
+  std::vector<std::pair<G4String, G4double>> fSmartless;
+  /// The optimisation settings (name pattern, value)
+  std::vector<std::pair<G4String, G4bool>> fOptimisation;
+  /// Info whether the settings were already applied
+  G4bool fIsApplied;
+  /// Option to activate the navigation profiling
+  G4bool fIsProfiling;
+  /// The period of the calls with the time sampling
+  G4int fSamplingPeriod;
+  /// The number of volumes printed in the profile
+  G4int fNofProfiledVolumes;
+};
+
+// inline functions
+
+inline void TG4NavigationControl::SetIsProfiling(G4bool isProfiling)
+{
+  /// (In)Activate the navigation profiling
+  fIsProfiling = isProfiling;
+}
+
+inline void TG4NavigationControl::SetSamplingPeriod(G4int samplingPeriod)
+{
+  /// Set the period of the calls with the time sampling
+  fSamplingPeriod = samplingPeriod;
+}
+
+inline void TG4NavigationControl::SetNofProfiledVolumes(G4int nofVolumes)
+{
+  /// Set the number of volumes printed in the profile
+  fNofProfiledVolumes = nofVolumes;
+}
+
+inline G4bool TG4NavigationControl::IsProfiling() const
+{
+  /// Return true if the navigation profiling is activated
+  return fIsProfiling;
+}
+
+#endif // TG4_NAVIGATION_CONTROL_H
@@ -0,0 +1,92 @@
+#ifndef TG4_NAVIGATION_CONTROL_MESSENGER_H
+#define TG4_NAVIGATION_CONTROL_MESSENGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4NavigationControlMessenger.h
+/// \brief Definition of the TG4NavigationControlMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class TG4NavigationControl;
+
+class G4UIdirectory;
+class G4UIcommand;
+class G4UIcmdWithABool;
+class G4UIcmdWithAnInteger;
+
+/// \ingroup geometry
+/// \brief Messenger class that defines commands for the navigation
+///        voxelisation control and profiling
+///
+/// Implements commands:
+/// - /mcDet/navigation/setSmartless name value
+/// - /mcDet/navigation/setOptimisation name true|false
+/// - /mcDet/navigation/printVoxels [nofVolumes]
+/// - /mcDet/navigation/setProfiling true|false
+/// - /mcDet/navigation/setSamplingPeriod value
+/// - /mcDet/navigation/setNofProfiledVolumes value
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4NavigationControlMessenger : public G4UImessenger
+{
+ public:
+  TG4NavigationControlMessenger(TG4NavigationControl* navigationControl);
+  virtual ~TG4NavigationControlMessenger();
+
+  // methods
+  virtual void SetNewValue(G4UIcommand* command, G4String string);
+
+ private:
+  /// Not implemented
+  TG4NavigationControlMessenger();
+  /// Not implemented
+  TG4NavigationControlMessenger(const TG4NavigationControlMessenger& right);
+  /// Not implemented
+  TG4NavigationControlMessenger& operator=(
+    const TG4NavigationControlMessenger& right);
+
+  // methods
+  void CreateSetSmartlessCmd();
+  void CreateSetOptimisationCmd();
+
+  //
+  // data members
+
+  /// associated class
+  TG4NavigationControl* fNavigationControl;
+
+  /// command directory
+  G4UIdirectory* fDirectory;
+
+  /// setSmartless command
+  G4UIcommand* fSetSmartlessCmd;
+
+  /// setOptimisation command
+  G4UIcommand* fSetOptimisationCmd;
+
+  /// printVoxels command
+  G4UIcmdWithAnInteger* fPrintVoxelsCmd;
+
+  /// setProfiling command
+  G4UIcmdWithABool* fSetProfilingCmd;
+
+  /// setSamplingPeriod command
+  G4UIcmdWithAnInteger* fSetSamplingPeriodCmd;
+
+  /// setNofProfiledVolumes command
+  G4UIcmdWithAnInteger* fSetNofProfiledVolumesCmd;
+};
+
+#endif // TG4_NAVIGATION_CONTROL_MESSENGER_H
@@ -0,0 +1,268 @@
+#ifndef TG4_OPTICAL_DETECTION_MAP_H
+#define TG4_OPTICAL_DETECTION_MAP_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4OpticalDetectionMap.h
+/// \brief Definition of the TG4OpticalDetectionMap class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4OpticalDetectionMapMessenger.h"
+#include "TG4Verbose.h"
+
+#include <G4ThreeVector.hh>
+#include <globals.hh>
+
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class G4LogicalVolume;
+class G4Track;
+class G4VPhysicalVolume;
+class G4VTouchable;
+
+/// \ingroup geometry
+/// \brief The optical photon detection probability maps
+///
+/// The maps provide a fast alternative to the tracking of the optical
+/// photons produced by the Cerenkov and scintillation processes.
+///
+/// In the calibration run, the photons are tracked and for each
+/// (volume placement, position voxel, wavelength bin) of the photon origin
+/// the number of produced photons and the number of photons detected
+/// in each photosensor, together with their time of flight distribution,
+/// are tabulated. The photosensors are the logical volumes declared via
+/// /mcDet/opticalMap/addSensor; a photon is detected if it ends
+/// in a photosensor volume. The position voxels are defined in the local
+/// frame of the origin volume within its bounding box. The placement is
+/// identified by the physical volumes and the replica numbers of the origin
+/// touchable history, so that each placement of a repeated volume has its
+/// own entries and detects the photons in its own photosensors copies.
+/// The map is written at the end of each run in a binary file, which is
+/// keyed to the geometry (the logical volumes names and their daughters)
+/// and includes the photosensors names and the binning.
+///
+/// In the production run, the map is loaded and the Cerenkov and
+/// scintillation photons are not tracked: the detection is sampled from
+/// the map when the photon track is started and the track is then killed.
+/// The detected photons of the current event are available via
+/// GetDetectedPhotons(). The photons with the origin not covered by the map
+/// are tracked as usual. The production map is not applied when the
+/// secondaries are saved in the VMC stack in step, as the photons are then
+/// already saved when their track is started.
+///
+/// The calibration is performed in all threads and merged on master;
+/// the production map is shared by all threads.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4OpticalDetectionMap : public TG4Verbose
+{
+ public:
+  /// The photon detected via the map
+  struct DetectedPhoton
+  {
+    G4int fSensorIndex = 0;      ///< the sensor volume index
+    G4int fCopyNo = 0;           ///< the sensor copy number
+    G4double fTime = 0.;         ///< the detection time
+    G4double fWavelength = 0.;   ///< the photon wavelength
+  };
+
+  TG4OpticalDetectionMap();
+  ~TG4OpticalDetectionMap();
+
+  // methods
+  void Initialize();
+  void BeginPhoton(const G4Track* track);
+  void EndPhoton(const G4Track* track);
+  G4bool SamplePhoton(const G4Track* track);
+  void Merge();
+  G4bool Write() const;
+  G4bool Read();
+  void ClearDetectedPhotons();
+  void PrintStatistics() const;
+  void ResetStatistics();
+
+  // set methods
+  void AddSensor(const G4String& volumeName);
+  void SetNofVoxels(G4int nofVoxels);
+  void SetNofWavelengthBins(G4int nofBins);
+  void SetMinWavelength(G4double wavelength);
+  void SetMaxWavelength(G4double wavelength);
+  void SetNofTimeBins(G4int nofBins);
+  void SetMaxTime(G4double time);
+  void SetCalibration(const G4String& fileName);
+  void SetProduction(const G4String& fileName);
+
+  // get methods
+  G4bool IsCalibration() const;
+  G4bool IsProduction() const;
+  const G4String& GetSensorName(G4int index) const;
+  const std::vector<DetectedPhoton>& GetDetectedPhotons() const;
+
+ private:
+  /// The detection in one photosensor
+  struct Sensor
+  {
+    G4int fIndex = 0;               ///< the sensor volume index
+    G4int fCopyNo = 0;              ///< the sensor copy number
+    G4long fNofDetected = 0;        ///< the number of detected photons
+    std::vector<G4long> fTimeCounts; ///< the time of flight histogram
+  };
+
+  /// The map key: the placement key and the (volume, voxel, wavelength bin)
+  using Key = std::pair<G4long, G4long>;
+
+  /// The map entry per (placement, volume, voxel, wavelength bin)
+  struct Entry
+  {
+    G4long fNofPhotons = 0;       ///< the number of produced photons
+    std::vector<Sensor> fSensors; ///< the photosensors with detections
+  };
+
+  /// The volume information cached per thread
+  struct Volume
+  {
+    G4int fIndex = -1;     ///< the index in the logical volume store
+    G4ThreeVector fMin;    ///< the bounding box minimum
+    G4ThreeVector fMax;    ///< the bounding box maximum
+  };
+
+  /// The photon origin
+  struct Origin
+  {
+    G4bool fIsValid = false; ///< info whether the origin is recorded
+    Key fKey;                ///< the map key
+    G4double fTime = 0.;     ///< the photon production time
+  };
+
+  /// The thread-local data
+  struct ThreadData
+  {
+    std::map<Key, Entry> fEntries;  ///< the calibration entries
+    std::unordered_map<const G4LogicalVolume*, Volume> fVolumes;
+    std::unordered_map<const G4VPhysicalVolume*, G4int> fPhysicalVolumes;
+    std::unordered_map<const G4LogicalVolume*, G4int> fSensorVolumes;
+    G4bool fIsSensorVolumesSet = false; ///< info if sensors are resolved
+    Origin fOrigin;                     ///< the current photon origin
+    std::vector<DetectedPhoton> fDetectedPhotons; ///< detected photons
+    G4long fNofSampled = 0;   ///< the number of sampled photons
+    G4long fNofDetected = 0;  ///< the number of detected photons
+    G4long fNofNotMapped = 0; ///< the number of photons out of map
+  };
+
+  /// Not implemented
+  TG4OpticalDetectionMap(const TG4OpticalDetectionMap& right);
+  /// Not implemented
+  TG4OpticalDetectionMap& operator=(const TG4OpticalDetectionMap& right);
+
+  // methods
+  ThreadData& GetThreadData() const;
+  G4bool IsMappedPhoton(const G4Track* track) const;
+  G4bool GetKey(const G4Track* track, Key& key) const;
+  G4long GetPlacementKey(const G4VTouchable* touchable) const;
+  G4int GetSensorIndex(const G4LogicalVolume* volume) const;
+  G4int GetWavelengthBin(G4double wavelength) const;
+  G4long GetGeometryKey() const;
+
+  // static data members
+  /// the thread-local data
+  static G4ThreadLocal ThreadData* fgThreadData;
+
+  // data members
+  /// Messenger
+  TG4OpticalDetectionMapMessenger fMessenger;
+  /// The photosensors volume names
+  std::vector<G4String> fSensorNames;
+  /// The merged calibration entries or the loaded production entries
+  std::map<Key, Entry> fEntries;
+  /// The calibration file name
+  G4String fCalibrationFileName;
+  /// The production file name
+  G4String fProductionFileName;
+  /// Info whether the geometry is already constructed
+  G4bool fIsInitialized;
+  /// Info whether the production map is loaded
+  G4bool fIsLoaded;
+  /// The number of position voxels per axis
+  G4int fNofVoxels;
+  /// The number of wavelength bins
+  G4int fNofWavelengthBins;
+  /// The wavelength range minimum
+  G4double fMinWavelength;
+  /// The wavelength range maximum
+  G4double fMaxWavelength;
+  /// The number of time of flight bins
+  G4int fNofTimeBins;
+  /// The time of flight range maximum
+  G4double fMaxTime;
+};
+
+// inline functions
+
+inline void TG4OpticalDetectionMap::SetNofVoxels(G4int nofVoxels)
+{
+  /// Set the number of position voxels per axis
+  fNofVoxels = nofVoxels;
+}
+
+inline void TG4OpticalDetectionMap::SetNofWavelengthBins(G4int nofBins)
+{
+  /// Set the number of wavelength bins
+  fNofWavelengthBins = nofBins;
+}
+
+inline void TG4OpticalDetectionMap::SetMinWavelength(G4double wavelength)
+{
+  /// Set the wavelength range minimum
+  fMinWavelength = wavelength;
+}
+
+inline void TG4OpticalDetectionMap::SetMaxWavelength(G4double wavelength)
+{
+  /// Set the wavelength range maximum
+  fMaxWavelength = wavelength;
+}
+
+inline void TG4OpticalDetectionMap::SetNofTimeBins(G4int nofBins)
+{
+  /// Set the number of time of flight bins
+  fNofTimeBins = nofBins;
+}
+
+inline void TG4OpticalDetectionMap::SetMaxTime(G4double time)
+{
+  /// Set the time of flight range maximum
+  fMaxTime = time;
+}
+
+inline G4bool TG4OpticalDetectionMap::IsCalibration() const
+{
+  /// Return true if the calibration is activated
+  return !fCalibrationFileName.empty();
+}
+
+inline G4bool TG4OpticalDetectionMap::IsProduction() const
+{
+  /// Return true if the production map is loaded
+  return fIsLoaded;
+}
+
+inline const G4String& TG4OpticalDetectionMap::GetSensorName(
+  G4int index) const
+{
+  /// Return the name of the sensor volume with the given index
+  return fSensorNames.at(index);
+}
+
+#endif // TG4_OPTICAL_DETECTION_MAP_H
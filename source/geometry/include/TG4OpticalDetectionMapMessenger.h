@@ -0,0 +1,102 @@
+#ifndef TG4_OPTICAL_DETECTION_MAP_MESSENGER_H
+#define TG4_OPTICAL_DETECTION_MAP_MESSENGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4OpticalDetectionMapMessenger.h
+/// \brief Definition of the TG4OpticalDetectionMapMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class TG4OpticalDetectionMap;
+
+class G4UIdirectory;
+class G4UIcommand;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+
+/// \ingroup geometry
+/// \brief Messenger class that defines commands for the optical photon
+///        detection maps
+///
+/// Implements commands:
+/// - /mcDet/opticalMap/addSensor volumeName
+/// - /mcDet/opticalMap/setNofVoxels value
+/// - /mcDet/opticalMap/setNofWavelengthBins value
+/// - /mcDet/opticalMap/setMinWavelength value unit
+/// - /mcDet/opticalMap/setMaxWavelength value unit
+/// - /mcDet/opticalMap/setNofTimeBins value
+/// - /mcDet/opticalMap/setMaxTime value unit
+/// - /mcDet/opticalMap/calibrate fileName
+/// - /mcDet/opticalMap/load fileName
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4OpticalDetectionMapMessenger : public G4UImessenger
+{
+ public:
+  TG4OpticalDetectionMapMessenger(TG4OpticalDetectionMap* detectionMap);
+  virtual ~TG4OpticalDetectionMapMessenger();
+
+  // methods
+  virtual void SetNewValue(G4UIcommand* command, G4String string);
+
+ private:
+  /// Not implemented
+  TG4OpticalDetectionMapMessenger();
+  /// Not implemented
+  TG4OpticalDetectionMapMessenger(
+    const TG4OpticalDetectionMapMessenger& right);
+  /// Not implemented
+  TG4OpticalDetectionMapMessenger& operator=(
+    const TG4OpticalDetectionMapMessenger& right);
+
+  //
+  // data members
+
+  /// associated class
+  TG4OpticalDetectionMap* fDetectionMap;
+
+  /// command directory
+  G4UIdirectory* fDirectory;
+
+  /// addSensor command
+  G4UIcmdWithAString* fAddSensorCmd;
+
+  /// setNofVoxels command
+  G4UIcmdWithAnInteger* fSetNofVoxelsCmd;
+
+  /// setNofWavelengthBins command
+  G4UIcmdWithAnInteger* fSetNofWavelengthBinsCmd;
+
+  /// setMinWavelength command
+  G4UIcmdWithADoubleAndUnit* fSetMinWavelengthCmd;
+
+  /// setMaxWavelength command
+  G4UIcmdWithADoubleAndUnit* fSetMaxWavelengthCmd;
+
+  /// setNofTimeBins command
+  G4UIcmdWithAnInteger* fSetNofTimeBinsCmd;
+
+  /// setMaxTime command
+  G4UIcmdWithADoubleAndUnit* fSetMaxTimeCmd;
+
+  /// calibrate command
+  G4UIcmdWithAString* fCalibrateCmd;
+
+  /// load command
+  G4UIcmdWithAString* fLoadCmd;
+};
+
+#endif // TG4_OPTICAL_DETECTION_MAP_MESSENGER_H
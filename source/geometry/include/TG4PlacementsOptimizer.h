@@ -0,0 +1,125 @@
+#ifndef TG4_PLACEMENTS_OPTIMIZER_H
+#define TG4_PLACEMENTS_OPTIMIZER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4PlacementsOptimizer.h
+/// \brief Definition of the TG4PlacementsOptimizer class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4Verbose.h"
+
+#include <globals.hh>
+
+#include <vector>
+
+class G4LogicalVolume;
+class G4VPhysicalVolume;
+class G4VPVParameterisation;
+
+/// \ingroup geometry
+/// \brief The optimisation of regularly placed copies of identical volumes
+///
+/// The optimizer replaces the placements of identical daughters of a mother
+/// volume, which are regularly translated or rotated around the mother
+/// z axis, with a single parameterised volume (TG4RegularParameterisation).
+///
+/// As Geant4 requires that a parameterised volume is the only daughter
+/// of its mother, the placements are replaced only if:
+/// - all mother daughters are placements of the same logical volume
+/// - their number is at least the minimum number of copies
+/// - their copy numbers are consecutive and they start from the number
+///   given in Optimize(), so that TG4StepManager::CurrentVolID() and
+///   CurrentVolOffID() return the same copy numbers as before the
+///   optimisation
+/// - the copies translations and rotations follow the pattern within
+///   the geometry tolerance
+///
+/// The optimisation is activated with /mcDet/setOptimizePlacements true
+/// and it is applied to the Geant4 geometry converted from VMC or Root.
+/// The volumes of the replaced copies cannot be selected by their copy
+/// number in the optical border surfaces definition.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4PlacementsOptimizer : public TG4Verbose
+{
+ public:
+  TG4PlacementsOptimizer();
+  ~TG4PlacementsOptimizer();
+
+  // methods
+  void Optimize(G4int firstCopyNo);
+
+  // set methods
+  void SetIsActive(G4bool isActive);
+  void SetMinNofCopies(G4int minNofCopies);
+
+  // get methods
+  G4bool IsActive() const;
+  G4int GetMinNofCopies() const;
+
+ private:
+  /// Not implemented
+  TG4PlacementsOptimizer(const TG4PlacementsOptimizer& right);
+  /// Not implemented
+  TG4PlacementsOptimizer& operator=(const TG4PlacementsOptimizer& right);
+
+  // methods
+  G4bool GetDaughters(G4LogicalVolume* motherLV, G4int firstCopyNo,
+    std::vector<G4VPhysicalVolume*>& daughters) const;
+  G4VPVParameterisation* CreateParameterisation(
+    const std::vector<G4VPhysicalVolume*>& daughters) const;
+  void Replace(G4LogicalVolume* motherLV,
+    const std::vector<G4VPhysicalVolume*>& daughters,
+    G4VPVParameterisation* parameterisation);
+
+  // static data members
+  /// The default minimum number of copies
+  static const G4int fgkDefaultMinNofCopies;
+  /// The tolerance for comparing the rotation matrices elements
+  static const G4double fgkRotationTolerance;
+
+  // data members
+  G4bool fIsActive;    ///< option to activate the optimisation
+  G4int fMinNofCopies; ///< the minimum number of copies to be replaced
+
+  /// The created parameterisations
+  std::vector<G4VPVParameterisation*> fParameterisations;
+};
+
+// inline functions
+
+inline void TG4PlacementsOptimizer::SetIsActive(G4bool isActive)
+{
+  /// (In)Activate the optimisation
+  fIsActive = isActive;
+}
+
+inline void TG4PlacementsOptimizer::SetMinNofCopies(G4int minNofCopies)
+{
+  /// Set the minimum number of copies to be replaced
+  fMinNofCopies = minNofCopies;
+}
+
+inline G4bool TG4PlacementsOptimizer::IsActive() const
+{
+  /// Return true if the optimisation is activated
+  return fIsActive;
+}
+
+inline G4int TG4PlacementsOptimizer::GetMinNofCopies() const
+{
+  /// Return the minimum number of copies to be replaced
+  return fMinNofCopies;
+}
+
+#endif // TG4_PLACEMENTS_OPTIMIZER_H
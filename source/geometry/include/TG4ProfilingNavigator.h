@@ -0,0 +1,106 @@
+#ifndef TG4_PROFILING_NAVIGATOR_H
+#define TG4_PROFILING_NAVIGATOR_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ProfilingNavigator.h
+/// \brief Definition of the TG4ProfilingNavigator class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4Navigator.hh>
+#include <globals.hh>
+
+#include <unordered_map>
+
+class G4LogicalVolume;
+
+/// \ingroup geometry
+/// \brief The Geant4 navigator with the profiling per logical volume
+///
+/// All ComputeStep() and ComputeSafety() calls are counted per logical
+/// volume where the point is located; the time is measured in every
+/// n-th call (the sampling period) and the total time per volume is
+/// estimated from the mean sampled time.
+/// The profile of the volumes with the largest estimated time is printed
+/// at the end of run (see TG4NavigationControl).
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4ProfilingNavigator : public G4Navigator
+{
+ public:
+  TG4ProfilingNavigator(G4int samplingPeriod, G4int nofPrintedVolumes);
+  virtual ~TG4ProfilingNavigator();
+
+  // static access method
+  static TG4ProfilingNavigator* Instance();
+
+  // methods
+  virtual G4double ComputeStep(const G4ThreeVector& globalPoint,
+    const G4ThreeVector& direction, const G4double proposedStepLength,
+    G4double& newSafety);
+  virtual G4double ComputeSafety(const G4ThreeVector& globalPoint,
+    const G4double proposedMaxLength = DBL_MAX,
+    const G4bool keepState = true);
+
+  void PrintStatistics() const;
+  void ResetStatistics();
+
+ private:
+  /// The statistics per volume
+  struct Statistics
+  {
+    G4long fNofStepCalls = 0;          ///< number of ComputeStep calls
+    G4long fNofSafetyCalls = 0;        ///< number of ComputeSafety calls
+    G4long fNofSampledStepCalls = 0;   ///< number of sampled ComputeStep
+    G4long fNofSampledSafetyCalls = 0; ///< number of sampled ComputeSafety
+    G4double fSampledStepTime = 0.;    ///< sampled ComputeStep time (s)
+    G4double fSampledSafetyTime = 0.;  ///< sampled ComputeSafety time (s)
+  };
+
+  /// Not implemented
+  TG4ProfilingNavigator();
+  /// Not implemented
+  TG4ProfilingNavigator(const TG4ProfilingNavigator& right);
+  /// Not implemented
+  TG4ProfilingNavigator& operator=(const TG4ProfilingNavigator& right);
+
+  // methods
+  Statistics& GetStatistics();
+
+  // static data members
+  /// this instance
+  static G4ThreadLocal TG4ProfilingNavigator* fgInstance;
+
+  // data members
+  /// The period of the calls with the time sampling
+  G4int fSamplingPeriod;
+  /// The number of volumes printed in the profile
+  G4int fNofPrintedVolumes;
+  /// The calls counter
+  G4long fNofCalls;
+  /// The statistics per volume
+  std::unordered_map<const G4LogicalVolume*, Statistics> fStatistics;
+  /// The volume of the last call
+  const G4LogicalVolume* fLastVolume;
+  /// The statistics of the last call volume
+  Statistics* fLastStatistics;
+};
+
+// inline functions
+
+inline TG4ProfilingNavigator* TG4ProfilingNavigator::Instance()
+{
+  /// Return this instance
+  return fgInstance;
+}
+
+#endif // TG4_PROFILING_NAVIGATOR_H
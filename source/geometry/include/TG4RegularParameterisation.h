@@ -0,0 +1,73 @@
+#ifndef TG4_REGULAR_PARAMETERISATION_H
+#define TG4_REGULAR_PARAMETERISATION_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4RegularParameterisation.h
+/// \brief Definition of the TG4RegularParameterisation class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4RotationMatrix.hh>
+#include <G4ThreeVector.hh>
+#include <G4VPVParameterisation.hh>
+#include <globals.hh>
+
+#include <vector>
+
+class G4VPhysicalVolume;
+
+/// \ingroup geometry
+/// \brief The parameterisation of regularly placed copies of a volume
+///
+/// The copies are either translated with a constant step
+/// (the i-th copy translation is origin + i*step with the same rotation
+/// for all copies) or rotated around the mother z axis with a constant
+/// angle step (the i-th copy translation and object rotation are
+/// the ones of the first copy rotated by i*phiStep).
+///
+/// The frame rotations are precomputed, so the parameterisation is
+/// read-only during tracking and it can be shared between threads.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4RegularParameterisation : public G4VPVParameterisation
+{
+ public:
+  TG4RegularParameterisation(const G4ThreeVector& origin,
+    const G4ThreeVector& step, const G4RotationMatrix& objectRotation);
+  TG4RegularParameterisation(const G4ThreeVector& origin, G4double phiStep,
+    const G4RotationMatrix& objectRotation, G4int nofCopies);
+  virtual ~TG4RegularParameterisation();
+
+  // methods
+  virtual void ComputeTransformation(
+    const G4int copyNo, G4VPhysicalVolume* physVol) const;
+
+ private:
+  /// Not implemented
+  TG4RegularParameterisation(const TG4RegularParameterisation& right);
+  /// Not implemented
+  TG4RegularParameterisation& operator=(
+    const TG4RegularParameterisation& right);
+
+  // data members
+  G4ThreeVector fOrigin;  ///< the first copy translation
+  G4ThreeVector fStep;    ///< the translation step
+  G4double fPhiStep;      ///< the rotation angle step
+  G4bool fIsRotation;     ///< true for the rotation pattern
+  G4bool fIsIdentity;     ///< true if the copies are not rotated
+
+  /// The frame rotations (one for the translation pattern,
+  /// one per copy for the rotation pattern)
+  mutable std::vector<G4RotationMatrix> fRotations;
+};
+
+#endif // TG4_REGULAR_PARAMETERISATION_H
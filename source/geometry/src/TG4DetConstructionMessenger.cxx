@@ -14,16 +14,21 @@
 
 #include "TG4DetConstructionMessenger.h"
 #include "TG4DetConstruction.h"
+#include "TG4FieldClassifier.h"
+#include "TG4GeometryCache.h"
 #include "TG4G3Units.h"
 #include "TG4GeometryManager.h"
 #include "TG4GeometryServices.h"
 #include "TG4Globals.h"
+#include "TG4PlacementsOptimizer.h"
 #include "TG4RadiatorDescription.h"
 
 #include <G4AnalysisUtilities.hh>
 #include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithADouble.hh>
 #include <G4UIcmdWithADoubleAndUnit.hh>
 #include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
 #include <G4UIcmdWithoutParameter.hh>
 #include <G4UIdirectory.hh>
 
@@ -45,6 +50,14 @@ TG4DetConstructionMessenger::TG4DetConstructionMessenger(
     fIsMaxStepInLowDensityMaterialsCmd(0),
     fSetLimitDensityCmd(0),
     fSetMaxStepInLowDensityMaterialsCmd(0),
+    fSetGeometryCacheCmd(0),
+    fSetGeometryCacheDirectoryCmd(0),
+    fSetOptimizePlacementsCmd(0),
+    fSetMinNofOptimizedCopiesCmd(0),
+    fSetFieldClassificationCmd(0),
+    fSetFieldClassificationToleranceCmd(0),
+    fSetZeroFieldToleranceCmd(0),
+    fSetFieldClassificationNofSamplesCmd(0),
     fSetNewRadiatorCmd(0),
     fSetRadiatorLayerCmd(0),
     fSetRadiatorStrawTubeCmd(0),
@@ -173,6 +186,89 @@ TG4DetConstructionMessenger::TG4DetConstructionMessenger(
   fSetMaxStepInLowDensityMaterialsCmd->SetUnitCategory("Length");
   fSetMaxStepInLowDensityMaterialsCmd->AvailableForStates(G4State_PreInit);
 
+  fSetGeometryCacheCmd = new G4UIcmdWithABool("/mcDet/setGeometryCache", this);
+  fSetGeometryCacheCmd->SetGuidance(
+    "(In)activate the cache of Geant4 geometry converted from Root.");
+  fSetGeometryCacheCmd->SetGuidance(
+    "When activated, the converted geometry is loaded from the cache file");
+  fSetGeometryCacheCmd->SetGuidance(
+    "matching the Root geometry hash, or saved in it if it does not exist.");
+  fSetGeometryCacheCmd->SetGuidance(
+    "Applied only with geomRootToGeant4 and Geant4 built with GDML.");
+  fSetGeometryCacheCmd->SetParameterName("GeometryCache", false);
+  fSetGeometryCacheCmd->AvailableForStates(G4State_PreInit);
+
+  fSetGeometryCacheDirectoryCmd =
+    new G4UIcmdWithAString("/mcDet/setGeometryCacheDirectory", this);
+  fSetGeometryCacheDirectoryCmd->SetGuidance(
+    "Set the directory of the converted geometry cache files.");
+  fSetGeometryCacheDirectoryCmd->SetParameterName(
+    "GeometryCacheDirectory", false);
+  fSetGeometryCacheDirectoryCmd->AvailableForStates(G4State_PreInit);
+
+  fSetOptimizePlacementsCmd =
+    new G4UIcmdWithABool("/mcDet/setOptimizePlacements", this);
+  fSetOptimizePlacementsCmd->SetGuidance(
+    "(In)activate replacing regularly placed copies of identical volumes");
+  fSetOptimizePlacementsCmd->SetGuidance(
+    "with parameterised volumes. The copies are replaced only if they are");
+  fSetOptimizePlacementsCmd->SetGuidance(
+    "the only daughters of their mother and their copy numbers are");
+  fSetOptimizePlacementsCmd->SetGuidance(
+    "consecutive, so that the copy numbers seen in VMC are preserved.");
+  fSetOptimizePlacementsCmd->SetGuidance(
+    "Applied only with geomVMCtoGeant4 and geomRootToGeant4.");
+  fSetOptimizePlacementsCmd->SetParameterName("OptimizePlacements", false);
+  fSetOptimizePlacementsCmd->AvailableForStates(G4State_PreInit);
+
+  fSetMinNofOptimizedCopiesCmd =
+    new G4UIcmdWithAnInteger("/mcDet/setMinNofOptimizedCopies", this);
+  fSetMinNofOptimizedCopiesCmd->SetGuidance(
+    "Set the minimum number of copies replaced with a parameterised volume.");
+  fSetMinNofOptimizedCopiesCmd->SetParameterName("MinNofCopies", false);
+  fSetMinNofOptimizedCopiesCmd->SetRange("MinNofCopies >= 2");
+  fSetMinNofOptimizedCopiesCmd->AvailableForStates(G4State_PreInit);
+
+  fSetFieldClassificationCmd =
+    new G4UIcmdWithABool("/mcDet/setFieldClassification", this);
+  fSetFieldClassificationCmd->SetGuidance(
+    "(In)activate the automatic classification of volumes in the global");
+  fSetFieldClassificationCmd->SetGuidance(
+    "magnetic field. The field is sampled over each volume extent and");
+  fSetFieldClassificationCmd->SetGuidance(
+    "the zero field volumes get a field manager without field, the uniform");
+  fSetFieldClassificationCmd->SetGuidance(
+    "field volumes a field manager with G4ExactHelixStepper.");
+  fSetFieldClassificationCmd->SetParameterName("FieldClassification", false);
+  fSetFieldClassificationCmd->AvailableForStates(G4State_PreInit);
+
+  fSetFieldClassificationToleranceCmd =
+    new G4UIcmdWithADouble("/mcDet/setFieldClassificationTolerance", this);
+  fSetFieldClassificationToleranceCmd->SetGuidance(
+    "Set the relative tolerance of the field deviations from the mean value");
+  fSetFieldClassificationToleranceCmd->SetGuidance(
+    "for the uniform field classification.");
+  fSetFieldClassificationToleranceCmd->SetParameterName("Tolerance", false);
+  fSetFieldClassificationToleranceCmd->SetRange("Tolerance >= 0");
+  fSetFieldClassificationToleranceCmd->AvailableForStates(G4State_PreInit);
+
+  fSetZeroFieldToleranceCmd =
+    new G4UIcmdWithADoubleAndUnit("/mcDet/setZeroFieldTolerance", this);
+  fSetZeroFieldToleranceCmd->SetGuidance(
+    "Set the field magnitude below which the field is classified as zero.");
+  fSetZeroFieldToleranceCmd->SetParameterName("ZeroFieldTolerance", false);
+  fSetZeroFieldToleranceCmd->SetDefaultUnit("tesla");
+  fSetZeroFieldToleranceCmd->SetUnitCategory("Magnetic flux density");
+  fSetZeroFieldToleranceCmd->AvailableForStates(G4State_PreInit);
+
+  fSetFieldClassificationNofSamplesCmd =
+    new G4UIcmdWithAnInteger("/mcDet/setFieldClassificationNofSamples", this);
+  fSetFieldClassificationNofSamplesCmd->SetGuidance(
+    "Set the number of field samples per axis over each volume extent.");
+  fSetFieldClassificationNofSamplesCmd->SetParameterName("NofSamples", false);
+  fSetFieldClassificationNofSamplesCmd->SetRange("NofSamples >= 1");
+  fSetFieldClassificationNofSamplesCmd->AvailableForStates(G4State_PreInit);
+
   CreateSetNewRadiatorCmd();
   CreateSetRadiatorLayerCmd();
   CreateSetRadiatorStrawTubeCmd();
@@ -203,6 +299,14 @@ TG4DetConstructionMessenger::~TG4DetConstructionMessenger()
   delete fIsMaxStepInLowDensityMaterialsCmd;
   delete fSetLimitDensityCmd;
   delete fSetMaxStepInLowDensityMaterialsCmd;
+  delete fSetGeometryCacheCmd;
+  delete fSetGeometryCacheDirectoryCmd;
+  delete fSetOptimizePlacementsCmd;
+  delete fSetMinNofOptimizedCopiesCmd;
+  delete fSetFieldClassificationCmd;
+  delete fSetFieldClassificationToleranceCmd;
+  delete fSetZeroFieldToleranceCmd;
+  delete fSetFieldClassificationNofSamplesCmd;
   delete fSetNewRadiatorCmd;
   delete fSetRadiatorLayerCmd;
   delete fSetRadiatorStrawTubeCmd;
@@ -391,6 +495,38 @@ void TG4DetConstructionMessenger::SetNewValue(
     TG4GeometryManager::Instance()->SetMaxStepInLowDensityMaterials(
       fSetMaxStepInLowDensityMaterialsCmd->GetNewDoubleValue(newValues));
   }
+  else if (command == fSetGeometryCacheCmd) {
+    TG4GeometryManager::Instance()->GetGeometryCache()->SetIsActive(
+      fSetGeometryCacheCmd->GetNewBoolValue(newValues));
+  }
+  else if (command == fSetGeometryCacheDirectoryCmd) {
+    TG4GeometryManager::Instance()->GetGeometryCache()->SetDirectory(
+      newValues);
+  }
+  else if (command == fSetOptimizePlacementsCmd) {
+    TG4GeometryManager::Instance()->GetPlacementsOptimizer()->SetIsActive(
+      fSetOptimizePlacementsCmd->GetNewBoolValue(newValues));
+  }
+  else if (command == fSetMinNofOptimizedCopiesCmd) {
+    TG4GeometryManager::Instance()->GetPlacementsOptimizer()->SetMinNofCopies(
+      fSetMinNofOptimizedCopiesCmd->GetNewIntValue(newValues));
+  }
+  else if (command == fSetFieldClassificationCmd) {
+    TG4GeometryManager::Instance()->GetFieldClassifier()->SetIsActive(
+      fSetFieldClassificationCmd->GetNewBoolValue(newValues));
+  }
+  else if (command == fSetFieldClassificationToleranceCmd) {
+    TG4GeometryManager::Instance()->GetFieldClassifier()->SetTolerance(
+      fSetFieldClassificationToleranceCmd->GetNewDoubleValue(newValues));
+  }
+  else if (command == fSetZeroFieldToleranceCmd) {
+    TG4GeometryManager::Instance()->GetFieldClassifier()->SetZeroFieldTolerance(
+      fSetZeroFieldToleranceCmd->GetNewDoubleValue(newValues));
+  }
+  else if (command == fSetFieldClassificationNofSamplesCmd) {
+    TG4GeometryManager::Instance()->GetFieldClassifier()->SetNofSamples(
+      fSetFieldClassificationNofSamplesCmd->GetNewIntValue(newValues));
+  }
   else if (command == fSetNewRadiatorCmd) {
     // tokenize parameters in a vector
     std::vector<G4String> parameters;
@@ -72,7 +72,8 @@ TG4Field::TG4Field(const TG4FieldParameters& parameters,
     fEquation(0),
     fStepper(0),
     fDriver(0),
-    fChordFinder(0)
+    fChordFinder(0),
+    fParameters(0)
 {
   /// Default constructor
 
@@ -323,6 +324,8 @@ void TG4Field::Update(const TG4FieldParameters& parameters)
 {
   /// Update field with new field parameters
 
+  fParameters = &parameters;
+
   // Create field
   CreateG4Field(parameters, fVirtualMagField);
 
@@ -0,0 +1,378 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4FieldClassifier.cxx
+/// \brief Implementation of the TG4FieldClassifier class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4FieldClassifier.h"
+#include "TG4FieldParameters.h"
+#include "TG4GeometryServices.h"
+#include "TG4Globals.h"
+#include "TG4MTProfiler.h"
+
+#include <G4AutoLock.hh>
+#include <G4ChordFinder.hh>
+#include <G4ExactHelixStepper.hh>
+#include <G4FieldManager.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Mag_UsualEqRhs.hh>
+#include <G4MagneticField.hh>
+#include <G4SystemOfUnits.hh>
+#include <G4UniformMagField.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VSolid.hh>
+
+#include <algorithm>
+
+namespace
+{
+// Mutex to lock the classification
+G4Mutex fieldClassifierMutex = G4MUTEX_INITIALIZER;
+} // namespace
+
+G4ThreadLocal std::vector<TG4FieldClassifier::UniformField>*
+  TG4FieldClassifier::fgUniformFields = 0;
+G4ThreadLocal G4FieldManager* TG4FieldClassifier::fgZeroFieldManager = 0;
+
+//_____________________________________________________________________________
+TG4FieldClassifier::TG4FieldClassifier()
+  : TG4Verbose("fieldClassifier"),
+    fIsActive(false),
+    fIsClassified(false),
+    fTolerance(1.e-03),
+    fZeroTolerance(1.e-06 * tesla),
+    fNofSamples(5),
+    fResults()
+{
+  /// Default constructor
+}
+
+//_____________________________________________________________________________
+TG4FieldClassifier::~TG4FieldClassifier()
+{
+  /// Destructor
+
+  if (fgUniformFields) {
+    for (auto& uniformField : *fgUniformFields) {
+      delete uniformField.fChordFinder;
+      delete uniformField.fStepper;
+      delete uniformField.fEquation;
+      delete uniformField.fField;
+    }
+    delete fgUniformFields;
+    fgUniformFields = 0;
+  }
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+void TG4FieldClassifier::AddExtent(G4LogicalVolume* lv,
+  const G4ThreeVector& min, const G4ThreeVector& max,
+  std::map<G4LogicalVolume*, Extent>& extents) const
+{
+  /// Add the box given by its corners to the volume extent
+
+  auto it = extents.find(lv);
+  if (it == extents.end()) {
+    Extent extent;
+    extent.fMin = min;
+    extent.fMax = max;
+    extent.fNofPlacements = 1;
+    extents[lv] = extent;
+    return;
+  }
+
+  Extent& extent = it->second;
+  extent.fMin.set(std::min(extent.fMin.x(), min.x()),
+    std::min(extent.fMin.y(), min.y()), std::min(extent.fMin.z(), min.z()));
+  extent.fMax.set(std::max(extent.fMax.x(), max.x()),
+    std::max(extent.fMax.y(), max.y()), std::max(extent.fMax.z(), max.z()));
+  ++extent.fNofPlacements;
+}
+
+//_____________________________________________________________________________
+void TG4FieldClassifier::CollectExtents(G4VPhysicalVolume* pv,
+  const G4RotationMatrix& rotation, const G4ThreeVector& translation,
+  std::map<G4LogicalVolume*, Extent>& extents) const
+{
+  /// Add the extent of the placed volume in the global frame given by the
+  /// rotation and translation and process its daughters recursively
+
+  G4LogicalVolume* lv = pv->GetLogicalVolume();
+
+  // the global bounding box of the volume bounding box
+  G4ThreeVector pmin;
+  G4ThreeVector pmax;
+  lv->GetSolid()->BoundingLimits(pmin, pmax);
+
+  Extent extent;
+  extent.fMin.set(kInfinity, kInfinity, kInfinity);
+  extent.fMax.set(-kInfinity, -kInfinity, -kInfinity);
+  for (G4int i = 0; i < 8; ++i) {
+    G4ThreeVector corner((i & 1) ? pmax.x() : pmin.x(),
+      (i & 2) ? pmax.y() : pmin.y(), (i & 4) ? pmax.z() : pmin.z());
+    corner = rotation * corner + translation;
+    extent.fMin.set(std::min(extent.fMin.x(), corner.x()),
+      std::min(extent.fMin.y(), corner.y()),
+      std::min(extent.fMin.z(), corner.z()));
+    extent.fMax.set(std::max(extent.fMax.x(), corner.x()),
+      std::max(extent.fMax.y(), corner.y()),
+      std::max(extent.fMax.z(), corner.z()));
+  }
+  AddExtent(lv, extent.fMin, extent.fMax, extents);
+
+  for (size_t i = 0; i < lv->GetNoDaughters(); ++i) {
+    G4VPhysicalVolume* daughter = lv->GetDaughter(i);
+    if (daughter->VolumeType() == kNormal) {
+      CollectExtents(daughter, rotation * daughter->GetObjectRotationValue(),
+        rotation * daughter->GetObjectTranslation() + translation, extents);
+    }
+    else {
+      // replicated or parameterised volumes are contained in the mother
+      CollectExtents(daughter->GetLogicalVolume(), extent, extents);
+    }
+  }
+}
+
+//_____________________________________________________________________________
+void TG4FieldClassifier::CollectExtents(G4LogicalVolume* lv,
+  const Extent& motherExtent,
+  std::map<G4LogicalVolume*, Extent>& extents) const
+{
+  /// Add the mother extent to the volume and all its daughters
+
+  AddExtent(lv, motherExtent.fMin, motherExtent.fMax, extents);
+
+  for (size_t i = 0; i < lv->GetNoDaughters(); ++i) {
+    CollectExtents(lv->GetDaughter(i)->GetLogicalVolume(), motherExtent,
+      extents);
+  }
+}
+
+//_____________________________________________________________________________
+TG4FieldClassifier::Result TG4FieldClassifier::ClassifyVolume(
+  G4MagneticField* field, const Extent& extent) const
+{
+  /// Sample the field over the volume extent and classify the volume
+
+  G4int nofSamples = std::max(fNofSamples, 1);
+  G4ThreeVector size = extent.fMax - extent.fMin;
+
+  std::vector<G4ThreeVector> values;
+  values.reserve(nofSamples * nofSamples * nofSamples);
+  for (G4int i = 0; i < nofSamples; ++i) {
+    for (G4int j = 0; j < nofSamples; ++j) {
+      for (G4int k = 0; k < nofSamples; ++k) {
+        G4ThreeVector fraction(0.5, 0.5, 0.5);
+        if (nofSamples > 1) {
+          fraction.set(G4double(i) / (nofSamples - 1),
+            G4double(j) / (nofSamples - 1), G4double(k) / (nofSamples - 1));
+        }
+        G4double point[4] = { extent.fMin.x() + fraction.x() * size.x(),
+          extent.fMin.y() + fraction.y() * size.y(),
+          extent.fMin.z() + fraction.z() * size.z(), 0. };
+        G4double value[6] = { 0., 0., 0., 0., 0., 0. };
+        field->GetFieldValue(point, value);
+        values.push_back(G4ThreeVector(value[0], value[1], value[2]));
+      }
+    }
+  }
+
+  // compute the maximum magnitude and the mean value
+  G4double maxMagnitude = 0.;
+  G4ThreeVector mean;
+  for (const auto& value : values) {
+    maxMagnitude = std::max(maxMagnitude, value.mag());
+    mean += value;
+  }
+  mean /= values.size();
+
+  // compute the maximum deviation from the mean value
+  G4double maxDeviation = 0.;
+  for (const auto& value : values) {
+    maxDeviation = std::max(maxDeviation, (value - mean).mag());
+  }
+
+  Result result;
+  result.fClass = kGeneralField;
+  result.fField = mean;
+  result.fNofPlacements = extent.fNofPlacements;
+
+  if (maxMagnitude <= fZeroTolerance) {
+    result.fClass = kZeroField;
+    result.fField = G4ThreeVector();
+  }
+  else if (maxDeviation <= fTolerance * mean.mag()) {
+    result.fClass = kUniformField;
+  }
+
+  return result;
+}
+
+//_____________________________________________________________________________
+void TG4FieldClassifier::ComputeClassification(G4MagneticField* field)
+{
+  /// Classify all volumes placed in the geometry tree which have not
+  /// yet a field manager
+
+  G4VPhysicalVolume* world = TG4GeometryServices::Instance()->GetWorld();
+  if (!world) {
+    TG4Globals::Warning("TG4FieldClassifier", "ComputeClassification",
+      "The world volume is not defined.");
+    return;
+  }
+
+  std::map<G4LogicalVolume*, Extent> extents;
+  CollectExtents(world, G4RotationMatrix(), G4ThreeVector(), extents);
+
+  for (const auto& it : extents) {
+    if (it.first->GetFieldManager()) continue;
+    fResults[it.first] = ClassifyVolume(field, it.second);
+  }
+}
+
+//_____________________________________________________________________________
+G4FieldManager* TG4FieldClassifier::GetUniformFieldManager(
+  const G4ThreeVector& value, const TG4FieldParameters& parameters)
+{
+  /// Return the field manager with the uniform field of the given value,
+  /// create it if it does not yet exist
+
+  if (!fgUniformFields) {
+    fgUniformFields = new std::vector<UniformField>();
+  }
+
+  for (const auto& uniformField : *fgUniformFields) {
+    if (uniformField.fField->GetConstantFieldValue() == value) {
+      return uniformField.fFieldManager;
+    }
+  }
+
+  UniformField uniformField;
+  uniformField.fField = new G4UniformMagField(value);
+  uniformField.fEquation = new G4Mag_UsualEqRhs(uniformField.fField);
+  uniformField.fStepper = new G4ExactHelixStepper(uniformField.fEquation);
+  uniformField.fChordFinder = new G4ChordFinder(
+    uniformField.fField, parameters.GetStepMinimum(), uniformField.fStepper);
+  uniformField.fChordFinder->SetDeltaChord(parameters.GetDeltaChord());
+
+  G4FieldManager* fieldManager =
+    new G4FieldManager(uniformField.fField, uniformField.fChordFinder, false);
+  fieldManager->SetMinimumEpsilonStep(parameters.GetMinimumEpsilonStep());
+  fieldManager->SetMaximumEpsilonStep(parameters.GetMaximumEpsilonStep());
+  fieldManager->SetDeltaOneStep(parameters.GetDeltaOneStep());
+  fieldManager->SetDeltaIntersection(parameters.GetDeltaIntersection());
+  uniformField.fFieldManager = fieldManager;
+
+  fgUniformFields->push_back(uniformField);
+
+  return fieldManager;
+}
+
+//_____________________________________________________________________________
+void TG4FieldClassifier::PrintReport() const
+{
+  /// Print the classification report
+
+  static const G4String kClassNames[3] = { "zero", "uniform", "general" };
+
+  G4int nofVolumes[3] = { 0, 0, 0 };
+  G4int nofPlacements[3] = { 0, 0, 0 };
+  for (const auto& it : fResults) {
+    ++nofVolumes[it.second.fClass];
+    nofPlacements[it.second.fClass] += it.second.fNofPlacements;
+
+    if (VerboseLevel() > 1) {
+      G4cout << "  " << it.first->GetName() << ": "
+             << kClassNames[it.second.fClass] << " field";
+      if (it.second.fClass == kUniformField) {
+        G4cout << " " << it.second.fField / tesla << " T";
+      }
+      G4cout << G4endl;
+    }
+  }
+
+  G4int savedPlacements =
+    nofPlacements[kZeroField] + nofPlacements[kUniformField];
+  G4int totalPlacements = savedPlacements + nofPlacements[kGeneralField];
+
+  G4cout << "### Field classification:" << G4endl;
+  for (G4int i = 0; i < 3; ++i) {
+    G4cout << "    " << kClassNames[i] << " field: " << nofVolumes[i]
+           << " volumes, " << nofPlacements[i] << " placements" << G4endl;
+  }
+  if (totalPlacements) {
+    G4cout << "    Estimated share of integration calls saved: "
+           << 100. * savedPlacements / totalPlacements
+           << " % (assuming the charged steps evenly shared by placements)"
+           << G4endl;
+  }
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4FieldClassifier::Classify(
+  G4MagneticField* field, const TG4FieldParameters& parameters)
+{
+  /// Classify the volumes in the given global field (if not yet done)
+  /// and attach the zero and uniform field managers to the volumes.
+  /// This function is called from each thread.
+
+  if (!fIsActive) return;
+
+  G4AutoLock lm(&fieldClassifierMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "FieldClassifier::Classify");
+  if (!fIsClassified) {
+    ComputeClassification(field);
+    fIsClassified = true;
+    if (VerboseLevel() > 0) PrintReport();
+  }
+  lm.unlock();
+
+  // Set a dummy field manager to all classified volumes first in order
+  // to avoid propagation of field managers to volume daughters
+  G4bool forceToAllDaughters = false;
+  G4FieldManager* dummyFieldManager = new G4FieldManager();
+  for (const auto& it : fResults) {
+    it.first->SetFieldManager(dummyFieldManager, forceToAllDaughters);
+  }
+
+  for (const auto& it : fResults) {
+    if (it.second.fClass == kZeroField) {
+      if (!fgZeroFieldManager) {
+        fgZeroFieldManager = new G4FieldManager();
+        fgZeroFieldManager->SetDetectorField(0);
+        fgZeroFieldManager->CreateChordFinder(0);
+      }
+      it.first->SetFieldManager(fgZeroFieldManager, forceToAllDaughters);
+    }
+    else if (it.second.fClass == kUniformField) {
+      it.first->SetFieldManager(
+        GetUniformFieldManager(it.second.fField, parameters),
+        forceToAllDaughters);
+    }
+  }
+
+  // Remove the dummy field manager from the general field volumes
+  for (const auto& it : fResults) {
+    if (it.first->GetFieldManager() == dummyFieldManager) {
+      it.first->SetFieldManager(0, forceToAllDaughters);
+    }
+  }
+
+  delete dummyFieldManager;
+}
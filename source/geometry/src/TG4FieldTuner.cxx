@@ -0,0 +1,401 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4FieldTuner.cxx
+/// \brief Implementation of the TG4FieldTuner class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4FieldTuner.h"
+#include "TG4Field.h"
+#include "TG4FieldParameters.h"
+#include "TG4GeometryManager.h"
+#include "TG4Globals.h"
+#include "TG4MTProfiler.h"
+
+#include <G4AutoLock.hh>
+#include <G4ChargeState.hh>
+#include <G4EquationOfMotion.hh>
+#include <G4FieldManager.hh>
+#include <G4FieldTrack.hh>
+#include <G4LogicalVolume.hh>
+#include <G4MagIntegratorDriver.hh>
+#include <G4MagneticField.hh>
+#include <G4Step.hh>
+#include <G4SystemOfUnits.hh>
+#include <G4Track.hh>
+#include <G4TransportationManager.hh>
+#include <G4VPhysicalVolume.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace
+{
+// Mutex to lock merging the samples
+G4Mutex fieldTunerMutex = G4MUTEX_INITIALIZER;
+
+// The magnetic field which counts the field evaluations
+class CountingMagField : public G4MagneticField
+{
+ public:
+  CountingMagField(const G4MagneticField* field)
+    : G4MagneticField(), fField(field), fNofEvaluations(0)
+  {}
+
+  virtual void GetFieldValue(const G4double point[4], G4double* value) const
+  {
+    ++fNofEvaluations;
+    fField->GetFieldValue(point, value);
+  }
+
+  const G4MagneticField* fField;
+  mutable G4long fNofEvaluations;
+};
+
+} // namespace
+
+G4ThreadLocal std::map<const G4Field*, G4int>*
+  TG4FieldTuner::fgFieldIndices = 0;
+G4ThreadLocal std::vector<std::vector<TG4FieldTuner::Sample> >*
+  TG4FieldTuner::fgThreadSamples = 0;
+const G4double TG4FieldTuner::fgkReferenceEpsilon = 1.e-10;
+const G4double TG4FieldTuner::fgkMaxEpsilonStep = 1.e-02;
+
+//_____________________________________________________________________________
+TG4FieldTuner::TG4FieldTuner()
+  : TG4Verbose("fieldTuner"),
+    fMessenger(this),
+    fIsActive(false),
+    fPositionBudget(0.01 * mm),
+    fMomentumBudget(1.e-05),
+    fMaxNofSamples(1000),
+    fSamples()
+{
+  /// Default constructor
+}
+
+//_____________________________________________________________________________
+TG4FieldTuner::~TG4FieldTuner()
+{
+  /// Destructor
+
+  delete fgFieldIndices;
+  fgFieldIndices = 0;
+  delete fgThreadSamples;
+  fgThreadSamples = 0;
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+G4int TG4FieldTuner::GetFieldIndex(const G4Field* field) const
+{
+  /// Return the index of the TG4Field with the given Geant4 field
+  /// or -1 if the field is not defined via TG4Field
+
+  if (!fgFieldIndices) {
+    fgFieldIndices = new std::map<const G4Field*, G4int>();
+    TG4GeometryManager* geometryManager = TG4GeometryManager::Instance();
+    for (G4int i = 0; i < geometryManager->GetNofFields(); ++i) {
+      (*fgFieldIndices)[geometryManager->GetField(i)->GetG4Field()] = i;
+    }
+  }
+
+  auto it = fgFieldIndices->find(field);
+  if (it == fgFieldIndices->end()) return -1;
+
+  return it->second;
+}
+
+//_____________________________________________________________________________
+G4ThreeVector TG4FieldTuner::Integrate(G4MagInt_Driver& driver,
+  G4EquationOfMotion* equation, const Sample& sample, G4double epsilon,
+  G4ThreeVector& momentum) const
+{
+  /// Integrate the sampled step with the given relative accuracy,
+  /// return the endpoint position and fill the endpoint momentum
+
+  G4double momentumMag = sample.fMomentum.mag();
+  G4double kineticEnergy =
+    std::sqrt(momentumMag * momentumMag + sample.fMass * sample.fMass) -
+    sample.fMass;
+
+  G4ChargeState chargeState(sample.fCharge, 0., 0.);
+  equation->SetChargeMomentumMass(chargeState, momentumMag, sample.fMass);
+
+  G4FieldTrack track(sample.fPosition, 0., sample.fMomentum.unit(),
+    kineticEnergy, sample.fMass, sample.fCharge, G4ThreeVector());
+  driver.AccurateAdvance(track, sample.fStepLength, epsilon);
+
+  momentum = track.GetMomentum();
+  return track.GetPosition();
+}
+
+//_____________________________________________________________________________
+G4bool TG4FieldTuner::TuneField(TG4Field* field,
+  const std::vector<Sample>& samples, std::ostream& out) const
+{
+  /// Integrate the samples with the scaled field parameters, select
+  /// the loosest parameters within the budgets and write them in the macro.
+  /// Return false if the field cannot be tuned.
+
+  const TG4FieldParameters* parameters = field->GetParameters();
+  G4MagIntegratorStepper* stepper = field->GetStepper();
+  G4EquationOfMotion* equation = field->GetEquation();
+  G4MagneticField* magField =
+    dynamic_cast<G4MagneticField*>(field->GetG4Field());
+
+  if (!parameters || !stepper || !equation || !magField ||
+      parameters->GetStepperType() >= kRK547FEq1) {
+    TG4Globals::Warning("TG4FieldTuner", "TuneField",
+      "The field stepper or field type is not supported by tuning.");
+    return false;
+  }
+
+  G4String fieldName = parameters->GetVolumeName();
+  G4String directoryName = "/mcMagField/";
+  if (fieldName != "") {
+    directoryName.append(fieldName);
+    directoryName.append("/");
+  }
+  else {
+    fieldName = "global";
+  }
+
+  // count the field evaluations
+  CountingMagField countingField(magField);
+  equation->SetFieldObj(&countingField);
+  G4MagInt_Driver driver(
+    parameters->GetStepMinimum(), stepper, stepper->GetNumberOfVariables(), 0);
+
+  // reference endpoints
+  std::vector<G4ThreeVector> refPositions;
+  std::vector<G4ThreeVector> refMomenta;
+  for (const auto& sample : samples) {
+    G4ThreeVector momentum;
+    refPositions.push_back(
+      Integrate(driver, equation, sample, fgkReferenceEpsilon, momentum));
+    refMomenta.push_back(momentum);
+  }
+
+  // scaled parameters, from the current ones to the loosest ones;
+  // the scan stops at the first scale out of the budgets, so that
+  // the selected parameters are never tighter than the current ones
+  // and a loose parameter set passing by chance is not selected
+  std::vector<Result> results;
+  for (G4int k = 0; k <= 10; ++k) {
+    Result result;
+    result.fScale = std::pow(2., k);
+    result.fMaxPositionDev = 0.;
+    result.fMaxMomentumDev = 0.;
+
+    G4double deltaOneStep = parameters->GetDeltaOneStep() * result.fScale;
+    G4double minEpsilon = std::min(
+      parameters->GetMinimumEpsilonStep() * result.fScale, fgkMaxEpsilonStep);
+    G4double maxEpsilon = std::min(
+      parameters->GetMaximumEpsilonStep() * result.fScale, fgkMaxEpsilonStep);
+
+    countingField.fNofEvaluations = 0;
+    for (size_t i = 0; i < samples.size(); ++i) {
+      // the same relative accuracy as applied in G4PropagatorInField
+      G4double epsilon = std::min(
+        std::max(deltaOneStep / samples[i].fStepLength, minEpsilon),
+        maxEpsilon);
+
+      G4ThreeVector momentum;
+      G4ThreeVector position =
+        Integrate(driver, equation, samples[i], epsilon, momentum);
+
+      result.fMaxPositionDev = std::max(
+        result.fMaxPositionDev, (position - refPositions[i]).mag());
+      result.fMaxMomentumDev = std::max(result.fMaxMomentumDev,
+        (momentum - refMomenta[i]).mag() / refMomenta[i].mag());
+    }
+    result.fNofFieldEvaluations = countingField.fNofEvaluations;
+
+    results.push_back(result);
+    if (result.fMaxPositionDev > fPositionBudget ||
+        result.fMaxMomentumDev > fMomentumBudget) {
+      break;
+    }
+  }
+
+  equation->SetFieldObj(magField);
+
+  // the last scale is out of the budgets, if the scan was stopped
+  G4int selectedIndex = G4int(results.size()) - 1;
+  const Result& last = results[selectedIndex];
+  if (last.fMaxPositionDev > fPositionBudget ||
+      last.fMaxMomentumDev > fMomentumBudget) {
+    --selectedIndex;
+  }
+
+  if (selectedIndex < 0) {
+    TG4Globals::Warning("TG4FieldTuner", "TuneField",
+      "The current parameters of " + TString(fieldName) +
+        " field are not within the budgets, they are kept.");
+    return false;
+  }
+
+  const Result& selected = results[selectedIndex];
+  G4double saved = 0.;
+  if (results[0].fNofFieldEvaluations > 0) {
+    saved = 1. - G4double(selected.fNofFieldEvaluations) /
+                   results[0].fNofFieldEvaluations;
+  }
+
+  if (VerboseLevel() > 0) {
+    G4cout << "### Field tuning: " << fieldName << " field, "
+           << samples.size() << " sampled steps" << G4endl;
+    for (const auto& result : results) {
+      G4cout << "    scale " << result.fScale << ": "
+             << result.fNofFieldEvaluations << " field evaluations, "
+             << "max position deviation " << result.fMaxPositionDev / mm
+             << " mm, max momentum deviation " << result.fMaxMomentumDev
+             << G4endl;
+    }
+    G4cout << "    selected scale " << selected.fScale << ", field evaluations "
+           << "saved " << saved * 100. << " %" << G4endl;
+  }
+
+  // write the macro
+  G4double scale = selected.fScale;
+  out << "# " << fieldName << " field: " << samples.size()
+      << " sampled steps, scale " << scale << ", field evaluations saved "
+      << saved * 100. << " %" << G4endl;
+  out << directoryName << "setDeltaOneStep "
+      << parameters->GetDeltaOneStep() * scale / mm << " mm" << G4endl;
+  out << directoryName << "setMinimumEpsilonStep "
+      << std::min(parameters->GetMinimumEpsilonStep() * scale,
+           fgkMaxEpsilonStep)
+      << G4endl;
+  out << directoryName << "setMaximumEpsilonStep "
+      << std::min(parameters->GetMaximumEpsilonStep() * scale,
+           fgkMaxEpsilonStep)
+      << G4endl;
+
+  return true;
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4FieldTuner::RecordStep(const G4Step* step)
+{
+  /// Sample the charged particle step in the field defined via TG4Field
+  /// in the samples of this thread
+
+  const G4Track* track = step->GetTrack();
+  G4double charge = track->GetDynamicParticle()->GetCharge();
+  if (charge == 0. || step->GetStepLength() <= 0.) return;
+
+  // get the field applied in the step volume
+  G4LogicalVolume* lv =
+    step->GetPreStepPoint()->GetPhysicalVolume()->GetLogicalVolume();
+  G4FieldManager* fieldManager = lv->GetFieldManager();
+  if (!fieldManager) {
+    fieldManager =
+      G4TransportationManager::GetTransportationManager()->GetFieldManager();
+  }
+  if (!fieldManager->GetDetectorField()) return;
+
+  G4int index = GetFieldIndex(fieldManager->GetDetectorField());
+  if (index < 0) return;
+
+  if (!fgThreadSamples) {
+    fgThreadSamples = new std::vector<std::vector<Sample> >();
+  }
+  if (index >= G4int(fgThreadSamples->size())) {
+    fgThreadSamples->resize(index + 1);
+  }
+  std::vector<Sample>& samples = (*fgThreadSamples)[index];
+  if (G4int(samples.size()) >= fMaxNofSamples) return;
+
+  Sample sample;
+  sample.fPosition = step->GetPreStepPoint()->GetPosition();
+  sample.fMomentum = step->GetPreStepPoint()->GetMomentum();
+  sample.fCharge = charge;
+  sample.fMass = track->GetDynamicParticle()->GetMass();
+  sample.fStepLength = step->GetStepLength();
+  samples.push_back(sample);
+}
+
+//_____________________________________________________________________________
+void TG4FieldTuner::MergeSamples()
+{
+  /// Merge the samples of this thread in the shared samples;
+  /// to be called at the end of run in each thread
+
+  if (!fgThreadSamples) return;
+
+  G4AutoLock lm(&fieldTunerMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "FieldTuner::MergeSamples");
+  if (fgThreadSamples->size() > fSamples.size()) {
+    fSamples.resize(fgThreadSamples->size());
+  }
+  for (std::size_t i = 0; i < fgThreadSamples->size(); ++i) {
+    const std::vector<Sample>& threadSamples = (*fgThreadSamples)[i];
+    std::size_t nofSamples = std::min(threadSamples.size(),
+      std::size_t(std::max(fMaxNofSamples - G4int(fSamples[i].size()), 0)));
+    fSamples[i].insert(fSamples[i].end(), threadSamples.begin(),
+      threadSamples.begin() + nofSamples);
+  }
+  lm.unlock();
+
+  delete fgThreadSamples;
+  fgThreadSamples = 0;
+}
+
+//_____________________________________________________________________________
+void TG4FieldTuner::Tune(const G4String& fileName)
+{
+  /// Tune the parameters of all fields with sampled steps and write
+  /// the selected parameters in the macro with the given name
+
+  G4AutoLock lm(&fieldTunerMutex);
+
+  std::ofstream out(fileName);
+  if (!out) {
+    TG4Globals::Warning("TG4FieldTuner", "Tune",
+      "Cannot open file " + TString(fileName.data()));
+    return;
+  }
+
+  out << "# Field accuracy parameters tuned with the position budget "
+      << fPositionBudget / mm << " mm and the momentum budget "
+      << fMomentumBudget << G4endl;
+
+  G4int nofTunedFields = 0;
+  TG4GeometryManager* geometryManager = TG4GeometryManager::Instance();
+  for (G4int i = 0; i < G4int(fSamples.size()); ++i) {
+    if (!fSamples[i].size()) continue;
+
+    TG4Field* field = geometryManager->GetField(i);
+    if (!field) continue;
+
+    if (TuneField(field, fSamples[i], out)) ++nofTunedFields;
+  }
+
+  if (!nofTunedFields) {
+    TG4Globals::Warning("TG4FieldTuner", "Tune",
+      "No field was tuned. Sampling of steps has to be activated with "
+      "/mcDet/fieldTuning/setActive true" + TG4Globals::Endl() +
+        "and the current parameters have to be within the budgets.");
+    return;
+  }
+
+  G4cout << "### Field tuning: the tuned parameters written in " << fileName
+         << G4endl;
+}
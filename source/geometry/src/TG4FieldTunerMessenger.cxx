@@ -0,0 +1,126 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4FieldTunerMessenger.cxx
+/// \brief Implementation of the TG4FieldTunerMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4FieldTunerMessenger.h"
+#include "TG4FieldTuner.h"
+
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithADouble.hh>
+#include <G4UIcmdWithADoubleAndUnit.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIdirectory.hh>
+
+//______________________________________________________________________________
+TG4FieldTunerMessenger::TG4FieldTunerMessenger(TG4FieldTuner* fieldTuner)
+  : G4UImessenger(),
+    fFieldTuner(fieldTuner),
+    fDirectory(0),
+    fSetActiveCmd(0),
+    fSetPositionBudgetCmd(0),
+    fSetMomentumBudgetCmd(0),
+    fSetMaxNofSamplesCmd(0),
+    fTuneCmd(0)
+{
+  /// Standard constructor
+
+  fDirectory = new G4UIdirectory("/mcDet/fieldTuning/");
+  fDirectory->SetGuidance("Field integration accuracy tuning commands.");
+
+  fSetActiveCmd = new G4UIcmdWithABool("/mcDet/fieldTuning/setActive", this);
+  fSetActiveCmd->SetGuidance(
+    "(In)activate sampling of charged particle steps in fields");
+  fSetActiveCmd->SetGuidance("for the field accuracy tuning.");
+  fSetActiveCmd->SetParameterName("Active", false);
+  fSetActiveCmd->AvailableForStates(G4State_PreInit);
+
+  fSetPositionBudgetCmd = new G4UIcmdWithADoubleAndUnit(
+    "/mcDet/fieldTuning/setPositionBudget", this);
+  fSetPositionBudgetCmd->SetGuidance(
+    "Set the maximum accepted deviation of the step endpoint position.");
+  fSetPositionBudgetCmd->SetParameterName("PositionBudget", false);
+  fSetPositionBudgetCmd->SetDefaultUnit("mm");
+  fSetPositionBudgetCmd->SetUnitCategory("Length");
+  fSetPositionBudgetCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fSetMomentumBudgetCmd =
+    new G4UIcmdWithADouble("/mcDet/fieldTuning/setMomentumBudget", this);
+  fSetMomentumBudgetCmd->SetGuidance(
+    "Set the maximum accepted relative deviation of the step endpoint "
+    "momentum.");
+  fSetMomentumBudgetCmd->SetParameterName("MomentumBudget", false);
+  fSetMomentumBudgetCmd->SetRange("MomentumBudget > 0");
+  fSetMomentumBudgetCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fSetMaxNofSamplesCmd =
+    new G4UIcmdWithAnInteger("/mcDet/fieldTuning/setMaxNofSamples", this);
+  fSetMaxNofSamplesCmd->SetGuidance(
+    "Set the maximum number of sampled steps per field.");
+  fSetMaxNofSamplesCmd->SetParameterName("MaxNofSamples", false);
+  fSetMaxNofSamplesCmd->SetRange("MaxNofSamples > 0");
+  fSetMaxNofSamplesCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  fTuneCmd = new G4UIcmdWithAString("/mcDet/fieldTuning/tune", this);
+  fTuneCmd->SetGuidance(
+    "Tune the field accuracy parameters on the sampled steps and write");
+  fTuneCmd->SetGuidance("the loosest parameters within the budgets in the");
+  fTuneCmd->SetGuidance("macro with the given name.");
+  fTuneCmd->SetParameterName("FileName", true);
+  fTuneCmd->SetDefaultValue("fieldTuning.mac");
+  fTuneCmd->AvailableForStates(G4State_Idle);
+  fTuneCmd->SetToBeBroadcasted(false);
+}
+
+//______________________________________________________________________________
+TG4FieldTunerMessenger::~TG4FieldTunerMessenger()
+{
+  /// Destructor
+
+  delete fDirectory;
+  delete fSetActiveCmd;
+  delete fSetPositionBudgetCmd;
+  delete fSetMomentumBudgetCmd;
+  delete fSetMaxNofSamplesCmd;
+  delete fTuneCmd;
+}
+
+//
+// public methods
+//
+
+//______________________________________________________________________________
+void TG4FieldTunerMessenger::SetNewValue(
+  G4UIcommand* command, G4String newValue)
+{
+  /// Apply command to the associated object.
+
+  if (command == fSetActiveCmd) {
+    fFieldTuner->SetIsActive(fSetActiveCmd->GetNewBoolValue(newValue));
+  }
+  else if (command == fSetPositionBudgetCmd) {
+    fFieldTuner->SetPositionBudget(
+      fSetPositionBudgetCmd->GetNewDoubleValue(newValue));
+  }
+  else if (command == fSetMomentumBudgetCmd) {
+    fFieldTuner->SetMomentumBudget(
+      fSetMomentumBudgetCmd->GetNewDoubleValue(newValue));
+  }
+  else if (command == fSetMaxNofSamplesCmd) {
+    fFieldTuner->SetMaxNofSamples(
+      fSetMaxNofSamplesCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fTuneCmd) {
+    fFieldTuner->Tune(newValue);
+  }
+}
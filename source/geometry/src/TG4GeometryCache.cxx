@@ -0,0 +1,213 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4GeometryCache.cxx
+/// \brief Implementation of the TG4GeometryCache class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4GeometryCache.h"
+#include "TG4Globals.h"
+#include "TG4Medium.h"
+#include "TG4MediumMap.h"
+
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4Version.hh>
+
+#ifdef USE_GDML
+#include <G4GDMLParser.hh>
+#endif
+
+#include <TBufferFile.h>
+#include <TGeoManager.h>
+#include <TMD5.h>
+#include <TSystem.h>
+
+const G4int TG4GeometryCache::fgkFormatVersion = 1;
+const G4String TG4GeometryCache::fgkMediumIdAuxType = "TG4MediumId";
+
+//_____________________________________________________________________________
+TG4GeometryCache::TG4GeometryCache()
+  : TG4Verbose("geometryCache"),
+    fIsActive(false),
+    fIsLoaded(false),
+    fDirectory("."),
+    fHash(),
+    fMediumIds()
+{
+  /// Default constructor
+}
+
+//_____________________________________________________________________________
+TG4GeometryCache::~TG4GeometryCache()
+{
+  /// Destructor
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+G4String TG4GeometryCache::ComputeHash() const
+{
+  /// Compute the MD5 hash of the streamed Root geometry,
+  /// the Geant4 version and the cache format version
+
+  if (!gGeoManager) {
+    TG4Globals::Exception(
+      "TG4GeometryCache", "ComputeHash", "Root geometry is not defined.");
+  }
+
+  TBufferFile buffer(TBuffer::kWrite);
+  gGeoManager->Streamer(buffer);
+
+  G4String versions = std::to_string(G4VERSION_NUMBER) + ":" +
+                      std::to_string(fgkFormatVersion);
+
+  TMD5 md5;
+  md5.Update(reinterpret_cast<const UChar_t*>(buffer.Buffer()),
+    buffer.Length());
+  md5.Update(
+    reinterpret_cast<const UChar_t*>(versions.data()), versions.size());
+  md5.Final();
+
+  return md5.AsString();
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+G4VPhysicalVolume* TG4GeometryCache::Load()
+{
+  /// Load the Geant4 geometry and the medium IDs from the cache file
+  /// matching the Root geometry hash.
+  /// Return the world volume or 0 if the cache file does not exist.
+
+#ifdef USE_GDML
+  G4String fileName = GetFileName();
+  if (gSystem->AccessPathName(fileName.data())) {
+    if (VerboseLevel() > 0) {
+      G4cout << "Geometry cache " << fileName << " not found." << G4endl;
+    }
+    return 0;
+  }
+
+  if (VerboseLevel() > 0) {
+    G4cout << "Loading Geant4 geometry from cache " << fileName << G4endl;
+  }
+
+  G4GDMLParser parser;
+  parser.Read(fileName, false);
+  G4VPhysicalVolume* world = parser.GetWorldVolume();
+  if (!world) {
+    TG4Globals::Warning("TG4GeometryCache", "Load",
+      "Reading geometry from " + TString(fileName.data()) + " failed.");
+    return 0;
+  }
+
+  // Get medium IDs from the volumes auxiliary information
+  const G4GDMLAuxMapType* auxMap = parser.GetAuxMap();
+  for (const auto& lvAux : *auxMap) {
+    for (const auto& aux : lvAux.second) {
+      if (aux.type != fgkMediumIdAuxType) continue;
+      fMediumIds[lvAux.first] = std::stoi(aux.value);
+    }
+  }
+
+  fIsLoaded = true;
+  return world;
+#else
+  TG4Globals::Warning("TG4GeometryCache", "Load",
+    "Geant4 was built without GDML." + TG4Globals::Endl() +
+      "Geometry cache is not supported.");
+  return 0;
+#endif
+}
+
+//_____________________________________________________________________________
+G4bool TG4GeometryCache::Save(
+  G4VPhysicalVolume* world, const TG4MediumMap* mediumMap)
+{
+  /// Save the Geant4 geometry and the medium IDs mapped to logical volumes
+  /// in the cache file matching the Root geometry hash.
+  /// The file is first written with a temporary name and then renamed,
+  /// so that jobs running in parallel never read a partially written file.
+
+#ifdef USE_GDML
+  G4String fileName = GetFileName();
+  if (!gSystem->AccessPathName(fileName.data())) return true;
+
+  gSystem->mkdir(fDirectory.data(), true);
+
+  G4GDMLParser parser;
+
+  // Save medium IDs as the volumes auxiliary information
+  G4LogicalVolumeStore* lvStore = G4LogicalVolumeStore::GetInstance();
+  for (G4int i = 0; i < G4int(lvStore->size()); i++) {
+    G4LogicalVolume* lv = (*lvStore)[i];
+    TG4Medium* medium = mediumMap->GetMedium(lv, false);
+    if (!medium) continue;
+
+    G4GDMLAuxStructType aux;
+    aux.type = fgkMediumIdAuxType;
+    aux.value = std::to_string(medium->GetID());
+    aux.unit = "";
+    aux.auxList = nullptr;
+    parser.AddVolumeAuxiliary(aux, lv);
+  }
+
+  G4String tmpFileName = fileName + "." + std::to_string(gSystem->GetPid());
+  parser.Write(tmpFileName, world);
+
+  if (gSystem->Rename(tmpFileName.data(), fileName.data()) != 0) {
+    TG4Globals::Warning("TG4GeometryCache", "Save",
+      "Cannot create geometry cache " + TString(fileName.data()));
+    gSystem->Unlink(tmpFileName.data());
+    return false;
+  }
+
+  if (VerboseLevel() > 0) {
+    G4cout << "Geant4 geometry saved in cache " << fileName << G4endl;
+  }
+  return true;
+#else
+  TG4Globals::Warning("TG4GeometryCache", "Save",
+    "Geant4 was built without GDML." + TG4Globals::Endl() +
+      "Geometry cache is not supported.");
+  return false;
+#endif
+}
+
+//_____________________________________________________________________________
+G4int TG4GeometryCache::GetMediumId(G4LogicalVolume* lv) const
+{
+  /// Return the medium ID loaded from the cache for the given logical volume
+  /// or -1 if not found
+
+  auto it = fMediumIds.find(lv);
+  if (it == fMediumIds.end()) return -1;
+
+  return it->second;
+}
+
+//_____________________________________________________________________________
+G4String TG4GeometryCache::GetFileName()
+{
+  /// Return the cache file name for the current Root geometry;
+  /// the geometry hash is computed with the first call
+
+  if (!fHash.size()) fHash = ComputeHash();
+
+  return fDirectory + "/g4geometry_" + fHash + ".gdml";
+}
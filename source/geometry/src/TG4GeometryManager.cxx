@@ -14,23 +14,32 @@
 
 #include "TG4GeometryManager.h"
 #include "TG4BiasingManager.h"
+#include "TG4EmDegradation.h"
 #include "TG4Field.h"
+#include "TG4FieldClassifier.h"
 #include "TG4MagneticField.h"
 #include "TG4FieldParameters.h"
+#include "TG4FieldTuner.h"
 #include "TG4G3ControlVector.h"
 #include "TG4G3CutVector.h"
 #include "TG4G3Units.h"
+#include "TG4GeometryCache.h"
 #include "TG4GeometryServices.h"
 #include "TG4Globals.h"
+#include "TG4ImportanceBiasingManager.h"
 #include "TG4Limits.h"
 #include "TG4MCGeometry.h"
 #include "TG4Medium.h"
 #include "TG4MediumMap.h"
 #include "TG4ModelConfigurationManager.h"
+#include "TG4NavigationControl.h"
 #include "TG4OpGeometryManager.h"
+#include "TG4OpticalDetectionMap.h"
+#include "TG4PlacementsOptimizer.h"
 #include "TG4RadiatorDescription.h"
 #include "TG4RootDetectorConstruction.h"
 #include "TG4SDManager.h"
+#include "TG4StartupPhase.h"
 #include "TG4StateManager.h"
 #include "TG4VUserPostDetConstruction.h"
 #include "TG4VUserRegionConstruction.h"
@@ -85,9 +94,17 @@ TG4GeometryManager::TG4GeometryManager(const TString& userGeometry)
     fMCGeometry(0),
     fRootDetectorConstruction(0),
     fOpManager(0),
+    fGeometryCache(0),
+    fPlacementsOptimizer(0),
+    fFieldClassifier(0),
+    fFieldTuner(0),
+    fNavigationControl(0),
+    fOpticalDetectionMap(0),
     fFastModelsManager(0),
     fEmModelsManager(0),
     fBiasingManager(0),
+    fImportanceBiasingManager(0),
+    fEmDegradation(0),
     fUserGeometry(userGeometry),
     fFieldParameters(),
     fUserRegionConstruction(0),
@@ -113,10 +130,18 @@ TG4GeometryManager::TG4GeometryManager(const TString& userGeometry)
   CreateMCGeometry();
 
   fOpManager = new TG4OpGeometryManager();
+  fGeometryCache = new TG4GeometryCache();
+  fPlacementsOptimizer = new TG4PlacementsOptimizer();
+  fFieldClassifier = new TG4FieldClassifier();
+  fFieldTuner = new TG4FieldTuner();
+  fNavigationControl = new TG4NavigationControl();
+  fOpticalDetectionMap = new TG4OpticalDetectionMap();
 
   fFastModelsManager = new TG4ModelConfigurationManager("fastSimulation");
   fEmModelsManager = new TG4ModelConfigurationManager("emModel");
   fBiasingManager = new TG4BiasingManager("biasing");
+  fImportanceBiasingManager = new TG4ImportanceBiasingManager();
+  fEmDegradation = new TG4EmDegradation();
 
   fgInstance = this;
 }
@@ -135,9 +160,17 @@ TG4GeometryManager::~TG4GeometryManager()
 
   delete fGeometryServices;
   delete fOpManager;
+  delete fGeometryCache;
+  delete fPlacementsOptimizer;
+  delete fFieldClassifier;
+  delete fFieldTuner;
+  delete fNavigationControl;
+  delete fOpticalDetectionMap;
   delete fFastModelsManager;
   delete fEmModelsManager;
   delete fBiasingManager;
+  delete fImportanceBiasingManager;
+  delete fEmDegradation;
 
   fgInstance = 0;
   fgFields = 0;
@@ -271,6 +304,22 @@ void TG4GeometryManager::ConstructG4GeometryViaVGM()
 #endif
 }
 
+//_____________________________________________________________________________
+G4bool TG4GeometryManager::ConstructG4GeometryFromCache()
+{
+  /// Load G4 geometry converted from Root geometry from the cache.
+  /// Return false if the cache for this Root geometry does not exist.
+
+  if (VerboseLevel() > 1)
+    G4cout << "TG4GeometryManager::ConstructG4GeometryFromCache" << G4endl;
+
+  G4VPhysicalVolume* g4World = fGeometryCache->Load();
+  if (!g4World) return false;
+
+  fGeometryServices->SetWorld(g4World);
+  return true;
+}
+
 //_____________________________________________________________________________
 void TG4GeometryManager::ConstructG4Geometry()
 {
@@ -326,8 +375,11 @@ void TG4GeometryManager::ConstructG4Geometry()
   // Build G4 geometry
   if (fUserGeometry == "VMCtoGeant4") ConstructG4GeometryViaVMC();
 
-  if (fUserGeometry == "RootToGeant4" || fUserGeometry == "VMC+RootToGeant4")
-    ConstructG4GeometryViaVGM();
+  if (fUserGeometry == "RootToGeant4" || fUserGeometry == "VMC+RootToGeant4") {
+    if (!fGeometryCache->IsActive() || !ConstructG4GeometryFromCache()) {
+      ConstructG4GeometryViaVGM();
+    }
+  }
 
   // print G4 geometry statistics
   if (VerboseLevel() > 0) {
@@ -469,7 +521,7 @@ void TG4GeometryManager::FillMediumMapFromRoot()
     Int_t mediumId = geoMedium->GetId();
     G4String mediumName = geoMedium->GetName();
 
-    // Int_t isvol  = (Int_t) geoMedium->GetParam(0);
+    Int_t isvol = (Int_t)geoMedium->GetParam(0);
     Int_t ifield = (Int_t)geoMedium->GetParam(1);
     // Double_t fieldm = geoMedium->GetParam(2);
     // Double_t tmaxfd = geoMedium->GetParam(3);
@@ -493,6 +545,7 @@ void TG4GeometryManager::FillMediumMapFromRoot()
     medium->SetName(mediumName);
     medium->SetLimits(limits);
     medium->SetIfield(ifield);
+    medium->SetIsvol(isvol);
 
     G4String matName = geoMedium->GetMaterial()->GetName();
     G4Material* material = G4Material::GetMaterial(matName);
@@ -508,6 +561,15 @@ void TG4GeometryManager::FillMediumMapFromRoot()
   for (G4int i = 0; i < G4int(lvStore->size()); i++) {
     G4LogicalVolume* lv = (*lvStore)[i];
 
+    // Use the medium ID from the geometry cache if available
+    if (fGeometryCache->IsLoaded()) {
+      G4int mediumID = fGeometryCache->GetMediumId(lv);
+      if (mediumID >= 0) {
+        mediumMap->MapMedium(lv, mediumID);
+        continue;
+      }
+    }
+
     TGeoVolume* geoVolume = nullptr;
 
     if (fRootDetectorConstruction == nullptr) {
@@ -778,6 +840,35 @@ void TG4GeometryManager::ConstructLocalFields()
   }
 }
 
+//_____________________________________________________________________________
+void TG4GeometryManager::ClassifyFieldVolumes()
+{
+  /// Classify volumes in the global magnetic field and attach the zero
+  /// and uniform field managers to them.
+
+  if (!gMC->GetMagField() || !fgFields) return;
+
+  if (VerboseLevel() > 1)
+    G4cout << "TG4GeometryManager::ClassifyFieldVolumes()" << G4endl;
+
+  // The monopole field setup uses the global field stepper
+  if (fFieldParameters[0]->GetIsMonopole()) {
+    TG4Globals::Warning("TG4GeometryManager", "ClassifyFieldVolumes",
+      "Field classification is not applied with monopole field setup.");
+    return;
+  }
+
+  G4MagneticField* magField =
+    dynamic_cast<G4MagneticField*>((*fgFields)[0]->GetG4Field());
+  if (!magField) {
+    TG4Globals::Warning("TG4GeometryManager", "ClassifyFieldVolumes",
+      "Field classification is applied only to magnetic field.");
+    return;
+  }
+
+  fFieldClassifier->Classify(magField, *fFieldParameters[0]);
+}
+
 //
 // public methods
 //
@@ -801,11 +892,35 @@ void TG4GeometryManager::ConstructGeometry()
 {
   /// Construct Geant4 geometry depending on user geometry source
 
+  TG4StartupPhase phase("constructGeometry");
+
   // Construct G4 geometry
+  TG4StartupProfiler::StartPhase("constructG4Geometry");
   ConstructG4Geometry();
+  TG4StartupProfiler::StopPhase("constructG4Geometry");
 
   // Fill medium map
+  TG4StartupProfiler::StartPhase("fillMediumMap");
   FillMediumMap();
+  TG4StartupProfiler::StopPhase("fillMediumMap");
+
+  // Save the converted geometry in the cache
+  if (fGeometryCache->IsActive() && !fGeometryCache->IsLoaded() &&
+      (fUserGeometry == "RootToGeant4" ||
+        fUserGeometry == "VMC+RootToGeant4")) {
+    fGeometryCache->Save(
+      fGeometryServices->GetWorld(), fGeometryServices->GetMediumMap());
+  }
+
+  // Replace regularly placed copies with parameterised volumes;
+  // the first copy number is chosen so that the copy numbers returned
+  // by TG4StepManager::CurrentVolID() are preserved
+  if (fUserGeometry == "VMCtoGeant4" || fUserGeometry == "RootToGeant4" ||
+      fUserGeometry == "VMC+RootToGeant4") {
+    G4int firstCopyNo = (fUserGeometry == "RootToGeant4") ? 1 : 0;
+    TG4StartupPhase optimizePhase("optimizePlacements");
+    fPlacementsOptimizer->Optimize(firstCopyNo);
+  }
 
   // VMC application construct geometry for optical processes
   TG4StateManager::Instance()->SetNewState(kConstructOpGeometry);
@@ -814,6 +929,12 @@ void TG4GeometryManager::ConstructGeometry()
 
   // Construct user regions
   if (fUserRegionConstruction) fUserRegionConstruction->Construct();
+
+  // Apply the user voxelisation settings
+  fNavigationControl->ApplySettings();
+
+  // Load the optical detection map (if set)
+  fOpticalDetectionMap->Initialize();
 }
 
 #include "TG4SDManager.h"
@@ -826,25 +947,50 @@ void TG4GeometryManager::ConstructSDandField()
   if (VerboseLevel() > 1)
     G4cout << "TG4GeometryManager::ConstructSDandField() " << G4endl;
 
+  TG4StartupPhase phase("constructSDandField");
+
   // Call user class for geometry customization
   if (fUserPostDetConstruction) fUserPostDetConstruction->Construct();
 
   // Construct regions with fast simulation and EM models
+  TG4StartupProfiler::StartPhase("createModelRegions");
   fFastModelsManager->CreateRegions();
   fEmModelsManager->CreateRegions();
+  TG4StartupProfiler::StopPhase("createModelRegions");
 
-  // Construct biasing operator
+  // Construct biasing operators
+  // (the importance operator first, as it delegates the physics biasing)
+  fImportanceBiasingManager->CreateImportanceOperator();
   fBiasingManager->CreateBiasingOperator();
 
   // Initialize SD manager (create SDs)
+  TG4StartupProfiler::StartPhase("constructSDs");
   TG4SDManager::Instance()->Initialize();
+  TG4StartupProfiler::StopPhase("constructSDs");
+
+  // Construct the precision and bulk regions
+  // (after SDs, as the sensitive volumes define the precision region)
+  fEmDegradation->CreateRegions();
 
   // Create global field
+  TG4StartupProfiler::StartPhase("constructFields");
   ConstructGlobalField();
 
   if (fIsLocalField) {
     ConstructLocalFields();
   }
+  TG4StartupProfiler::StopPhase("constructFields");
+
+  // Classify volumes in the global field
+  if (fFieldClassifier->IsActive()) {
+    ClassifyFieldVolumes();
+  }
+
+  // Replace the navigator for tracking in this thread with
+  // the profiling navigator
+  if (fNavigationControl->IsProfiling()) {
+    fNavigationControl->CreateProfilingNavigator();
+  }
 }
 
 //_____________________________________________________________________________
@@ -894,6 +1040,26 @@ void TG4GeometryManager::UpdateField()
   }
 }
 
+//_____________________________________________________________________________
+G4int TG4GeometryManager::GetNofFields() const
+{
+  /// Return the number of fields created in the current thread
+
+  if (!fgFields) return 0;
+
+  return G4int(fgFields->size());
+}
+
+//_____________________________________________________________________________
+TG4Field* TG4GeometryManager::GetField(G4int index) const
+{
+  /// Return the field with the given index created in the current thread
+
+  if (!fgFields || index < 0 || index >= G4int(fgFields->size())) return 0;
+
+  return fgFields->at(index);
+}
+
 //_____________________________________________________________________________
 void TG4GeometryManager::CreateFieldParameters(const G4String& fieldVolName)
 {
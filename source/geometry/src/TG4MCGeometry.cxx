@@ -298,6 +298,7 @@ void TG4MCGeometry::Medium(Int_t& kmed, const char* name, Int_t nmat,
   TG4Medium* medium = fGeometryServices->GetMediumMap()->AddMedium(kmed);
   medium->SetName(name);
   medium->SetIfield(ifield);
+  medium->SetIsvol(isvol);
 
   if (nbuf > 0) {
     TG4Globals::Warning("TG4MCGeometry", "Medium",
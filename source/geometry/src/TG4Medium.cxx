@@ -22,6 +22,7 @@
 
 const G4String TG4Medium::fgkUndefinedName = "UndefinedMediumName";
 const G4int TG4Medium::fgkDefaultIfield = 1;
+const G4int TG4Medium::fgkDefaultIsvol = 0;
 
 //_____________________________________________________________________________
 TG4Medium::TG4Medium(G4int id)
@@ -29,7 +30,8 @@ TG4Medium::TG4Medium(G4int id)
     fName(fgkUndefinedName),
     fMaterial(0),
     fLimits(0),
-    fIfield(fgkDefaultIfield)
+    fIfield(fgkDefaultIfield),
+    fIsvol(fgkDefaultIsvol)
 {
   /// Standard constructor from given id
 }
@@ -16,6 +16,7 @@
 #include "TG4GeometryServices.h"
 #include "TG4Globals.h"
 #include "TG4Medium.h"
+#include "TG4MemorySize.h"
 
 #include <G4LogicalVolume.hh>
 #include <G4Material.hh>
@@ -236,3 +237,18 @@ void TG4MediumMap::GetMedia(const G4String& namePattern,
       "No medium with name pattern " + TString(namePattern) + " was found.");
   }
 }
+
+//_____________________________________________________________________________
+std::size_t TG4MediumMap::GetMemorySize() const
+{
+  /// Return the estimated memory (in bytes) of the maps and the media
+
+  std::size_t size = TG4MemorySize::Of(fIdMap) + TG4MemorySize::Of(fLVMap) +
+                     TG4MemorySize::Of(fMaterialMap);
+
+  for (const auto& it : fIdMap) {
+    size += sizeof(TG4Medium) + TG4MemorySize::Of(it.second->GetName());
+  }
+
+  return size;
+}
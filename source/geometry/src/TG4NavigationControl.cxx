@@ -0,0 +1,273 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4NavigationControl.cxx
+/// \brief Implementation of the TG4NavigationControl class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4NavigationControl.h"
+#include "TG4Globals.h"
+#include "TG4ProfilingNavigator.h"
+
+#include <G4EventManager.hh>
+#include <G4GeometryManager.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4PropagatorInField.hh>
+#include <G4RunManager.hh>
+#include <G4SmartVoxelStat.hh>
+#include <G4SteppingManager.hh>
+#include <G4Threading.hh>
+#include <G4TrackingManager.hh>
+#include <G4TransportationManager.hh>
+
+#include <algorithm>
+#include <iomanip>
+#include <typeinfo>
+
+//_____________________________________________________________________________
+TG4NavigationControl::TG4NavigationControl()
+  : TG4Verbose("navigationControl"),
+    fMessenger(this),
+    fSmartless(),
+    fOptimisation(),
+    fIsApplied(false),
+    fIsProfiling(false),
+    fSamplingPeriod(100),
+    fNofProfiledVolumes(20)
+{
+  /// Default constructor
+}
+
+//_____________________________________________________________________________
+TG4NavigationControl::~TG4NavigationControl()
+{
+  /// Destructor
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+std::vector<G4LogicalVolume*> TG4NavigationControl::GetVolumes(
+  const G4String& namePattern) const
+{
+  /// Return the logical volumes with the given name or the name starting
+  /// with the given pattern (ABC*)
+
+  std::vector<G4LogicalVolume*> volumes;
+
+  G4String prefix = namePattern;
+  G4bool isPattern = false;
+  if (!prefix.empty() && prefix.back() == '*') {
+    prefix.pop_back();
+    isPattern = true;
+  }
+
+  for (auto volume : *G4LogicalVolumeStore::GetInstance()) {
+    const G4String& name = volume->GetName();
+    if ((isPattern && name.compare(0, prefix.size(), prefix) == 0) ||
+        (!isPattern && name == prefix)) {
+      volumes.push_back(volume);
+    }
+  }
+
+  if (volumes.empty()) {
+    TG4Globals::Warning("TG4NavigationControl", "GetVolumes",
+      "No volume matching " + TString(namePattern.data()) + " was found.");
+  }
+
+  return volumes;
+}
+
+//_____________________________________________________________________________
+void TG4NavigationControl::ApplySmartless(
+  const G4String& namePattern, G4double smartless) const
+{
+  /// Set the smartless value to the volumes matching the pattern
+
+  for (auto volume : GetVolumes(namePattern)) {
+    volume->SetSmartless(smartless);
+    if (VerboseLevel() > 1) {
+      G4cout << "Set smartless " << smartless << " to " << volume->GetName()
+             << G4endl;
+    }
+  }
+}
+
+//_____________________________________________________________________________
+void TG4NavigationControl::ApplyOptimisation(
+  const G4String& namePattern, G4bool optimisation) const
+{
+  /// Enable or disable the voxelisation of the volumes matching the pattern
+
+  for (auto volume : GetVolumes(namePattern)) {
+    volume->SetOptimisation(optimisation);
+    if (VerboseLevel() > 1) {
+      G4cout << "Set optimisation " << std::boolalpha << optimisation
+             << std::noboolalpha << " to " << volume->GetName() << G4endl;
+    }
+  }
+}
+
+//_____________________________________________________________________________
+void TG4NavigationControl::GeometryModified() const
+{
+  /// Notify the run manager to reoptimise the geometry at the next run
+
+  G4RunManager* runManager = G4RunManager::GetRunManager();
+  if (runManager) runManager->GeometryHasBeenModified();
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4NavigationControl::ApplySettings()
+{
+  /// Apply the voxelisation settings to the constructed geometry;
+  /// the logical volumes are shared, so it is done on master only
+
+  if (G4Threading::IsWorkerThread()) return;
+
+  for (const auto& it : fSmartless) {
+    ApplySmartless(it.first, it.second);
+  }
+  for (const auto& it : fOptimisation) {
+    ApplyOptimisation(it.first, it.second);
+  }
+  fIsApplied = true;
+}
+
+//_____________________________________________________________________________
+void TG4NavigationControl::CreateProfilingNavigator() const
+{
+  /// Replace the navigator for tracking in this thread with
+  /// TG4ProfilingNavigator; it must be called before the transportation
+  /// process is created
+
+  G4TransportationManager* transportationManager =
+    G4TransportationManager::GetTransportationManager();
+  G4Navigator* navigator = transportationManager->GetNavigatorForTracking();
+
+  if (typeid(*navigator) != typeid(G4Navigator)) {
+    TG4Globals::Warning("TG4NavigationControl", "CreateProfilingNavigator",
+      "The navigation profiling is available only with the Geant4 "
+      "navigator." +
+        TG4Globals::Endl() + "The profiling is not activated.");
+    return;
+  }
+
+  auto profilingNavigator =
+    new TG4ProfilingNavigator(fSamplingPeriod, fNofProfiledVolumes);
+  profilingNavigator->SetWorldVolume(navigator->GetWorldVolume());
+
+  transportationManager->SetNavigatorForTracking(profilingNavigator);
+  transportationManager->GetPropagatorInField()->SetNavigatorForPropagating(
+    profilingNavigator);
+  G4EventManager* eventManager = G4EventManager::GetEventManager();
+  if (eventManager) {
+    eventManager->GetTrackingManager()->GetSteppingManager()->SetNavigator(
+      profilingNavigator);
+  }
+  // the navigator is deleted with the transportation manager
+
+  if (VerboseLevel() > 0) {
+    G4cout << "### TG4ProfilingNavigator activated in thread "
+           << G4Threading::G4GetThreadId() << G4endl;
+  }
+}
+
+//_____________________________________________________________________________
+void TG4NavigationControl::PrintVoxels(G4int nofVolumes) const
+{
+  /// Print the voxels memory of the given number of volumes with the largest
+  /// voxels memory (all volumes if nofVolumes <= 0); the geometry is closed
+  /// (and optimised) if it is not yet closed
+
+  G4GeometryManager* geometryManager = G4GeometryManager::GetInstance();
+  if (!geometryManager->IsGeometryClosed()) {
+    geometryManager->CloseGeometry(true);
+  }
+
+  struct VolumeVoxels
+  {
+    const G4LogicalVolume* fVolume;
+    G4long fMemory;
+    G4long fNofHeaders;
+    G4long fNofNodes;
+  };
+
+  std::vector<VolumeVoxels> voxels;
+  G4long totalMemory = 0;
+  G4int nofOptimised = 0;
+  for (auto volume : *G4LogicalVolumeStore::GetInstance()) {
+    if (!volume->GetVoxelHeader()) continue;
+    G4SmartVoxelStat stat(volume, volume->GetVoxelHeader(), 0., 0.);
+    voxels.push_back({ volume, stat.GetMemoryUse(), stat.GetNumberHeaders(),
+      stat.GetNumberNodes() });
+    totalMemory += stat.GetMemoryUse();
+    ++nofOptimised;
+  }
+
+  std::sort(voxels.begin(), voxels.end(),
+    [](const VolumeVoxels& a, const VolumeVoxels& b) {
+      return a.fMemory > b.fMemory;
+    });
+
+  G4cout << "### Voxels of " << nofOptimised << " volumes, total memory "
+         << totalMemory / 1024. << " kB" << G4endl;
+  G4cout << std::setw(30) << std::left << "volume" << std::right
+         << std::setw(10) << "daughters" << std::setw(10) << "smartless"
+         << std::setw(10) << "headers" << std::setw(10) << "nodes"
+         << std::setw(12) << "memory[kB]" << G4endl;
+
+  G4int counter = 0;
+  for (const auto& it : voxels) {
+    if (nofVolumes > 0 && counter++ >= nofVolumes) break;
+    G4cout << std::setw(30) << std::left << it.fVolume->GetName()
+           << std::right << std::setw(10) << it.fVolume->GetNoDaughters()
+           << std::setw(10) << it.fVolume->GetSmartless() << std::setw(10)
+           << it.fNofHeaders << std::setw(10) << it.fNofNodes << std::setw(12)
+           << it.fMemory / 1024. << G4endl;
+  }
+}
+
+//_____________________________________________________________________________
+void TG4NavigationControl::SetSmartless(
+  const G4String& namePattern, G4double smartless)
+{
+  /// Set the smartless value to the volumes matching the pattern;
+  /// it is applied immediately if the geometry is already constructed
+
+  fSmartless.push_back(std::make_pair(namePattern, smartless));
+
+  if (fIsApplied) {
+    ApplySmartless(namePattern, smartless);
+    GeometryModified();
+  }
+}
+
+//_____________________________________________________________________________
+void TG4NavigationControl::SetOptimisation(
+  const G4String& namePattern, G4bool optimisation)
+{
+  /// Enable or disable the voxelisation of the volumes matching the pattern;
+  /// it is applied immediately if the geometry is already constructed
+
+  fOptimisation.push_back(std::make_pair(namePattern, optimisation));
+
+  if (fIsApplied) {
+    ApplyOptimisation(namePattern, optimisation);
+    GeometryModified();
+  }
+}
@@ -0,0 +1,182 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4NavigationControlMessenger.cxx
+/// \brief Implementation of the TG4NavigationControlMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4NavigationControlMessenger.h"
+#include "TG4NavigationControl.h"
+
+#include <G4AnalysisUtilities.hh>
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIdirectory.hh>
+
+//______________________________________________________________________________
+TG4NavigationControlMessenger::TG4NavigationControlMessenger(
+  TG4NavigationControl* navigationControl)
+  : G4UImessenger(),
+    fNavigationControl(navigationControl),
+    fDirectory(0),
+    fSetSmartlessCmd(0),
+    fSetOptimisationCmd(0),
+    fPrintVoxelsCmd(0),
+    fSetProfilingCmd(0),
+    fSetSamplingPeriodCmd(0),
+    fSetNofProfiledVolumesCmd(0)
+{
+  /// Standard constructor
+
+  fDirectory = new G4UIdirectory("/mcDet/navigation/");
+  fDirectory->SetGuidance("Navigation voxelisation and profiling commands.");
+
+  CreateSetSmartlessCmd();
+  CreateSetOptimisationCmd();
+
+  fPrintVoxelsCmd =
+    new G4UIcmdWithAnInteger("/mcDet/navigation/printVoxels", this);
+  fPrintVoxelsCmd->SetGuidance(
+    "Print the voxels memory of the given number of volumes with");
+  fPrintVoxelsCmd->SetGuidance(
+    "the largest voxels memory (all volumes if 0).");
+  fPrintVoxelsCmd->SetParameterName("NofVolumes", true);
+  fPrintVoxelsCmd->SetDefaultValue(20);
+  fPrintVoxelsCmd->SetRange("NofVolumes >= 0");
+  fPrintVoxelsCmd->AvailableForStates(G4State_Idle);
+  fPrintVoxelsCmd->SetToBeBroadcasted(false);
+
+  fSetProfilingCmd =
+    new G4UIcmdWithABool("/mcDet/navigation/setProfiling", this);
+  fSetProfilingCmd->SetGuidance(
+    "(In)activate the navigation profiling per logical volume.");
+  fSetProfilingCmd->SetParameterName("Profiling", false);
+  fSetProfilingCmd->AvailableForStates(G4State_PreInit);
+
+  fSetSamplingPeriodCmd =
+    new G4UIcmdWithAnInteger("/mcDet/navigation/setSamplingPeriod", this);
+  fSetSamplingPeriodCmd->SetGuidance(
+    "Set the period of the navigation calls with the time sampling.");
+  fSetSamplingPeriodCmd->SetParameterName("SamplingPeriod", false);
+  fSetSamplingPeriodCmd->SetRange("SamplingPeriod > 0");
+  fSetSamplingPeriodCmd->AvailableForStates(G4State_PreInit);
+
+  fSetNofProfiledVolumesCmd =
+    new G4UIcmdWithAnInteger("/mcDet/navigation/setNofProfiledVolumes", this);
+  fSetNofProfiledVolumesCmd->SetGuidance(
+    "Set the number of volumes printed in the navigation profile");
+  fSetNofProfiledVolumesCmd->SetGuidance("(all volumes if 0).");
+  fSetNofProfiledVolumesCmd->SetParameterName("NofVolumes", false);
+  fSetNofProfiledVolumesCmd->SetRange("NofVolumes >= 0");
+  fSetNofProfiledVolumesCmd->AvailableForStates(G4State_PreInit);
+}
+
+//______________________________________________________________________________
+TG4NavigationControlMessenger::~TG4NavigationControlMessenger()
+{
+  /// Destructor
+
+  delete fDirectory;
+  delete fSetSmartlessCmd;
+  delete fSetOptimisationCmd;
+  delete fPrintVoxelsCmd;
+  delete fSetProfilingCmd;
+  delete fSetSamplingPeriodCmd;
+  delete fSetNofProfiledVolumesCmd;
+}
+
+//
+// private methods
+//
+
+//______________________________________________________________________________
+void TG4NavigationControlMessenger::CreateSetSmartlessCmd()
+{
+  /// Create setSmartless command
+
+  auto volumeName = new G4UIparameter("volumeName", 's', false);
+  volumeName->SetGuidance("Volume name or name pattern (ABC*).");
+
+  auto smartless = new G4UIparameter("smartless", 'd', false);
+  smartless->SetGuidance("Average number of slices per contained volume.");
+  smartless->SetParameterRange("smartless > 0");
+
+  fSetSmartlessCmd = new G4UIcommand("/mcDet/navigation/setSmartless", this);
+  fSetSmartlessCmd->SetGuidance(
+    "Set the voxelisation smartless parameter to the selected volumes.");
+  fSetSmartlessCmd->SetParameter(volumeName);
+  fSetSmartlessCmd->SetParameter(smartless);
+  fSetSmartlessCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  fSetSmartlessCmd->SetToBeBroadcasted(false);
+}
+
+//______________________________________________________________________________
+void TG4NavigationControlMessenger::CreateSetOptimisationCmd()
+{
+  /// Create setOptimisation command
+
+  auto volumeName = new G4UIparameter("volumeName", 's', false);
+  volumeName->SetGuidance("Volume name or name pattern (ABC*).");
+
+  auto optimisation = new G4UIparameter("optimisation", 'b', false);
+  optimisation->SetGuidance("Enable (true) or disable (false) voxelisation.");
+
+  fSetOptimisationCmd =
+    new G4UIcommand("/mcDet/navigation/setOptimisation", this);
+  fSetOptimisationCmd->SetGuidance(
+    "Enable or disable the voxelisation of the selected volumes.");
+  fSetOptimisationCmd->SetParameter(volumeName);
+  fSetOptimisationCmd->SetParameter(optimisation);
+  fSetOptimisationCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  fSetOptimisationCmd->SetToBeBroadcasted(false);
+}
+
+//
+// public methods
+//
+
+//______________________________________________________________________________
+void TG4NavigationControlMessenger::SetNewValue(
+  G4UIcommand* command, G4String newValue)
+{
+  /// Apply command to the associated object.
+
+  if (command == fSetSmartlessCmd) {
+    // tokenize parameters in a vector
+    std::vector<G4String> parameters;
+    G4Analysis::Tokenize(newValue, parameters);
+
+    fNavigationControl->SetSmartless(
+      parameters[0], G4UIcommand::ConvertToDouble(parameters[1]));
+  }
+  else if (command == fSetOptimisationCmd) {
+    // tokenize parameters in a vector
+    std::vector<G4String> parameters;
+    G4Analysis::Tokenize(newValue, parameters);
+
+    fNavigationControl->SetOptimisation(
+      parameters[0], G4UIcommand::ConvertToBool(parameters[1]));
+  }
+  else if (command == fPrintVoxelsCmd) {
+    fNavigationControl->PrintVoxels(fPrintVoxelsCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fSetProfilingCmd) {
+    fNavigationControl->SetIsProfiling(
+      fSetProfilingCmd->GetNewBoolValue(newValue));
+  }
+  else if (command == fSetSamplingPeriodCmd) {
+    fNavigationControl->SetSamplingPeriod(
+      fSetSamplingPeriodCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fSetNofProfiledVolumesCmd) {
+    fNavigationControl->SetNofProfiledVolumes(
+      fSetNofProfiledVolumesCmd->GetNewIntValue(newValue));
+  }
+}
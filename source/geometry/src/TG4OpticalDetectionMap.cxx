@@ -0,0 +1,653 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4OpticalDetectionMap.cxx
+/// \brief Implementation of the TG4OpticalDetectionMap class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4OpticalDetectionMap.h"
+#include "TG4Globals.h"
+
+#include <G4AffineTransform.hh>
+#include <G4AutoLock.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4NavigationHistory.hh>
+#include <G4OpticalPhoton.hh>
+#include <G4PhysicalConstants.hh>
+#include <G4PhysicalVolumeStore.hh>
+#include <G4Step.hh>
+#include <G4SystemOfUnits.hh>
+#include <G4Threading.hh>
+#include <G4Track.hh>
+#include <G4VPhysicalVolume.hh>
+#include <G4VProcess.hh>
+#include <G4VSolid.hh>
+#include <G4VTouchable.hh>
+#include <Randomize.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+
+// static data members
+G4ThreadLocal TG4OpticalDetectionMap::ThreadData*
+  TG4OpticalDetectionMap::fgThreadData = 0;
+
+namespace
+{
+// Mutex to lock merging the calibration entries
+G4Mutex opticalDetectionMapMutex = G4MUTEX_INITIALIZER;
+
+// The file identification
+const char kMagic[8] = { 'T', 'G', '4', 'O', 'P', 'M', 'A', 'P' };
+const G4int kVersion = 2;
+
+// The FNV-1a hash initial value
+const std::uint64_t kHashBasis = 14695981039346656037ULL;
+
+// Add the value to the FNV-1a hash
+void AddToHash(std::uint64_t& hash, std::uint64_t value)
+{
+  hash ^= value;
+  hash *= 1099511628211ULL;
+}
+
+template <typename T>
+void WriteValue(std::ofstream& file, const T& value)
+{
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+G4bool ReadValue(std::ifstream& file, T& value)
+{
+  file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return G4bool(file);
+}
+
+} // namespace
+
+//_____________________________________________________________________________
+TG4OpticalDetectionMap::TG4OpticalDetectionMap()
+  : TG4Verbose("opticalDetectionMap"),
+    fMessenger(this),
+    fSensorNames(),
+    fEntries(),
+    fCalibrationFileName(),
+    fProductionFileName(),
+    fIsInitialized(false),
+    fIsLoaded(false),
+    fNofVoxels(5),
+    fNofWavelengthBins(10),
+    fMinWavelength(200. * nm),
+    fMaxWavelength(700. * nm),
+    fNofTimeBins(100),
+    fMaxTime(100. * ns)
+{
+  /// Default constructor
+}
+
+//_____________________________________________________________________________
+TG4OpticalDetectionMap::~TG4OpticalDetectionMap()
+{
+  /// Destructor
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+TG4OpticalDetectionMap::ThreadData&
+TG4OpticalDetectionMap::GetThreadData() const
+{
+  /// Return the data of this thread (create them if they do not yet exist)
+
+  if (!fgThreadData) fgThreadData = new ThreadData();
+  return *fgThreadData;
+}
+
+//_____________________________________________________________________________
+G4bool TG4OpticalDetectionMap::IsMappedPhoton(const G4Track* track) const
+{
+  /// Return true if the track is an optical photon produced by
+  /// the Cerenkov or scintillation process
+
+  if (track->GetDefinition() != G4OpticalPhoton::Definition()) return false;
+
+  const G4VProcess* process = track->GetCreatorProcess();
+  if (!process) return false;
+
+  const G4String& processName = process->GetProcessName();
+  return processName == "Cerenkov" || processName == "Scintillation";
+}
+
+//_____________________________________________________________________________
+G4int TG4OpticalDetectionMap::GetWavelengthBin(G4double wavelength) const
+{
+  /// Return the wavelength bin or -1 if the wavelength is out of range
+
+  if (wavelength < fMinWavelength || wavelength >= fMaxWavelength) return -1;
+
+  return G4int((wavelength - fMinWavelength) /
+               (fMaxWavelength - fMinWavelength) * fNofWavelengthBins);
+}
+
+//_____________________________________________________________________________
+G4long TG4OpticalDetectionMap::GetPlacementKey(
+  const G4VTouchable* touchable) const
+{
+  /// Return the hash of the physical volumes indices and replica numbers
+  /// of the touchable history
+
+  auto& physicalVolumes = GetThreadData().fPhysicalVolumes;
+  std::uint64_t hash = kHashBasis;
+  for (G4int i = 0; i <= touchable->GetHistoryDepth(); ++i) {
+    const G4VPhysicalVolume* physicalVolume = touchable->GetVolume(i);
+    auto it = physicalVolumes.find(physicalVolume);
+    if (it == physicalVolumes.end()) {
+      auto store = G4PhysicalVolumeStore::GetInstance();
+      G4int index = G4int(
+        std::find(store->begin(), store->end(), physicalVolume) -
+        store->begin());
+      it = physicalVolumes.insert(std::make_pair(physicalVolume, index)).first;
+    }
+    AddToHash(hash, std::uint64_t(it->second));
+    AddToHash(hash, std::uint64_t(touchable->GetReplicaNumber(i)));
+  }
+
+  return G4long(hash);
+}
+
+//_____________________________________________________________________________
+G4bool TG4OpticalDetectionMap::GetKey(const G4Track* track, Key& key) const
+{
+  /// Compute the map key from the placement and the (volume, voxel,
+  /// wavelength bin) of the track start; return false if the wavelength
+  /// is out of range
+
+  const G4VTouchable* touchable = track->GetTouchable();
+  if (!touchable || !touchable->GetVolume()) return false;
+
+  G4double wavelength = h_Planck * c_light / track->GetKineticEnergy();
+  G4int wavelengthBin = GetWavelengthBin(wavelength);
+  if (wavelengthBin < 0) return false;
+
+  // Get the volume index and bounding box (cached per thread)
+  const G4LogicalVolume* logicalVolume =
+    touchable->GetVolume()->GetLogicalVolume();
+  Volume& volume = GetThreadData().fVolumes[logicalVolume];
+  if (volume.fIndex < 0) {
+    auto store = G4LogicalVolumeStore::GetInstance();
+    volume.fIndex = G4int(
+      std::find(store->begin(), store->end(), logicalVolume) - store->begin());
+    logicalVolume->GetSolid()->BoundingLimits(volume.fMin, volume.fMax);
+  }
+
+  // Get the voxel from the position in the volume frame
+  G4ThreeVector localPosition =
+    touchable->GetHistory()->GetTopTransform().TransformPoint(
+      track->GetPosition());
+  G4int voxel = 0;
+  for (G4int i = 0; i < 3; ++i) {
+    G4double size = volume.fMax[i] - volume.fMin[i];
+    G4int index = (size > 0.)
+      ? G4int((localPosition[i] - volume.fMin[i]) / size * fNofVoxels) : 0;
+    index = std::max(0, std::min(index, fNofVoxels - 1));
+    voxel = voxel * fNofVoxels + index;
+  }
+
+  G4long nofVoxels = G4long(fNofVoxels) * fNofVoxels * fNofVoxels;
+  key.first = GetPlacementKey(touchable);
+  key.second = (volume.fIndex * nofVoxels + voxel) * fNofWavelengthBins +
+               wavelengthBin;
+
+  return true;
+}
+
+//_____________________________________________________________________________
+G4int TG4OpticalDetectionMap::GetSensorIndex(
+  const G4LogicalVolume* volume) const
+{
+  /// Return the sensor index of the given volume or -1 if it is not
+  /// a sensor
+
+  ThreadData& threadData = GetThreadData();
+  if (!threadData.fIsSensorVolumesSet) {
+    for (G4int i = 0; i < G4int(fSensorNames.size()); ++i) {
+      auto sensorVolume =
+        G4LogicalVolumeStore::GetInstance()->GetVolume(fSensorNames[i], false);
+      if (!sensorVolume) {
+        TG4Globals::Warning("TG4OpticalDetectionMap", "GetSensorIndex",
+          "Sensor volume " + TString(fSensorNames[i].data()) +
+            " was not found.");
+        continue;
+      }
+      threadData.fSensorVolumes[sensorVolume] = i;
+    }
+    threadData.fIsSensorVolumesSet = true;
+  }
+
+  auto it = threadData.fSensorVolumes.find(volume);
+  return (it != threadData.fSensorVolumes.end()) ? it->second : -1;
+}
+
+//_____________________________________________________________________________
+G4long TG4OpticalDetectionMap::GetGeometryKey() const
+{
+  /// Return the hash (FNV-1a) of the logical volumes names and
+  /// their numbers of daughters
+
+  std::uint64_t hash = kHashBasis;
+  for (auto volume : *G4LogicalVolumeStore::GetInstance()) {
+    for (auto character : volume->GetName()) {
+      AddToHash(hash, std::uint64_t(character));
+    }
+    AddToHash(hash, std::uint64_t(volume->GetNoDaughters()));
+  }
+
+  return G4long(hash);
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4OpticalDetectionMap::Initialize()
+{
+  /// Load the production map if it was set before the geometry construction
+
+  fIsInitialized = true;
+
+  if (!fProductionFileName.empty() && !fIsLoaded) Read();
+}
+
+//_____________________________________________________________________________
+void TG4OpticalDetectionMap::BeginPhoton(const G4Track* track)
+{
+  /// Record the photon origin in the calibration run
+
+  ThreadData& threadData = GetThreadData();
+  Origin& origin = threadData.fOrigin;
+
+  origin.fIsValid = IsMappedPhoton(track) && GetKey(track, origin.fKey);
+  if (!origin.fIsValid) return;
+
+  origin.fTime = track->GetGlobalTime();
+  ++threadData.fEntries[origin.fKey].fNofPhotons;
+}
+
+//_____________________________________________________________________________
+void TG4OpticalDetectionMap::EndPhoton(const G4Track* track)
+{
+  /// Record the photon detection in the calibration run if the photon
+  /// ended in a photosensor
+
+  ThreadData& threadData = GetThreadData();
+  Origin& origin = threadData.fOrigin;
+  if (!origin.fIsValid) return;
+  origin.fIsValid = false;
+
+  const G4Step* step = track->GetStep();
+  if (!step || !step->GetPostStepPoint()->GetPhysicalVolume()) return;
+
+  const G4StepPoint* point = step->GetPostStepPoint();
+  G4int sensorIndex =
+    GetSensorIndex(point->GetPhysicalVolume()->GetLogicalVolume());
+  if (sensorIndex < 0) return;
+
+  G4int copyNo = point->GetTouchable()->GetCopyNumber();
+  G4int timeBin =
+    G4int((point->GetGlobalTime() - origin.fTime) / fMaxTime * fNofTimeBins);
+  timeBin = std::max(0, std::min(timeBin, fNofTimeBins - 1));
+
+  Entry& entry = threadData.fEntries[origin.fKey];
+  auto it = std::find_if(entry.fSensors.begin(), entry.fSensors.end(),
+    [sensorIndex, copyNo](const Sensor& sensor) {
+      return sensor.fIndex == sensorIndex && sensor.fCopyNo == copyNo;
+    });
+  if (it == entry.fSensors.end()) {
+    Sensor sensor;
+    sensor.fIndex = sensorIndex;
+    sensor.fCopyNo = copyNo;
+    sensor.fTimeCounts.resize(fNofTimeBins);
+    it = entry.fSensors.insert(entry.fSensors.end(), sensor);
+  }
+  ++it->fNofDetected;
+  ++it->fTimeCounts[timeBin];
+}
+
+//_____________________________________________________________________________
+G4bool TG4OpticalDetectionMap::SamplePhoton(const G4Track* track)
+{
+  /// Sample the photon detection from the production map and kill
+  /// the photon track; return false if the photon is not covered by the map
+  /// and has to be tracked
+
+  if (!IsMappedPhoton(track)) return false;
+
+  ThreadData& threadData = GetThreadData();
+
+  Key key;
+  auto it = fEntries.end();
+  if (GetKey(track, key)) it = fEntries.find(key);
+  if (it == fEntries.end() || it->second.fNofPhotons == 0) {
+    ++threadData.fNofNotMapped;
+    return false;
+  }
+  ++threadData.fNofSampled;
+
+  // Select the sensor (or no detection)
+  const Entry& entry = it->second;
+  G4double random = G4UniformRand() * entry.fNofPhotons;
+  G4long cumulative = 0;
+  const Sensor* sensor = 0;
+  for (const auto& candidate : entry.fSensors) {
+    cumulative += candidate.fNofDetected;
+    if (random < cumulative) {
+      sensor = &candidate;
+      break;
+    }
+  }
+
+  if (sensor) {
+    // Sample the time of flight
+    random = G4UniformRand() * sensor->fNofDetected;
+    cumulative = 0;
+    G4int timeBin = 0;
+    while (timeBin < fNofTimeBins - 1) {
+      cumulative += sensor->fTimeCounts[timeBin];
+      if (random < cumulative) break;
+      ++timeBin;
+    }
+
+    DetectedPhoton photon;
+    photon.fSensorIndex = sensor->fIndex;
+    photon.fCopyNo = sensor->fCopyNo;
+    photon.fTime = track->GetGlobalTime() +
+                   (timeBin + G4UniformRand()) * fMaxTime / fNofTimeBins;
+    photon.fWavelength = h_Planck * c_light / track->GetKineticEnergy();
+    threadData.fDetectedPhotons.push_back(photon);
+    ++threadData.fNofDetected;
+  }
+
+  const_cast<G4Track*>(track)->SetTrackStatus(fStopAndKill);
+  return true;
+}
+
+//_____________________________________________________________________________
+void TG4OpticalDetectionMap::Merge()
+{
+  /// Merge the calibration entries of this thread in the shared entries
+
+  if (!fgThreadData || fgThreadData->fEntries.empty()) return;
+
+  G4AutoLock lm(&opticalDetectionMapMutex);
+
+  for (auto& it : fgThreadData->fEntries) {
+    Entry& entry = fEntries[it.first];
+    entry.fNofPhotons += it.second.fNofPhotons;
+    for (const auto& sensor : it.second.fSensors) {
+      auto itSensor = std::find_if(entry.fSensors.begin(),
+        entry.fSensors.end(), [&sensor](const Sensor& other) {
+          return other.fIndex == sensor.fIndex &&
+                 other.fCopyNo == sensor.fCopyNo;
+        });
+      if (itSensor == entry.fSensors.end()) {
+        entry.fSensors.push_back(sensor);
+        continue;
+      }
+      itSensor->fNofDetected += sensor.fNofDetected;
+      for (G4int i = 0; i < fNofTimeBins; ++i) {
+        itSensor->fTimeCounts[i] += sensor.fTimeCounts[i];
+      }
+    }
+  }
+  fgThreadData->fEntries.clear();
+}
+
+//_____________________________________________________________________________
+G4bool TG4OpticalDetectionMap::Write() const
+{
+  /// Write the merged calibration entries in the binary file
+
+  std::ofstream file(fCalibrationFileName, std::ios::binary);
+  if (!file) {
+    TG4Globals::Warning("TG4OpticalDetectionMap", "Write",
+      "Cannot open file " + TString(fCalibrationFileName.data()));
+    return false;
+  }
+
+  file.write(kMagic, sizeof(kMagic));
+  WriteValue(file, kVersion);
+  WriteValue(file, GetGeometryKey());
+  WriteValue(file, fNofVoxels);
+  WriteValue(file, fNofWavelengthBins);
+  WriteValue(file, fMinWavelength);
+  WriteValue(file, fMaxWavelength);
+  WriteValue(file, fNofTimeBins);
+  WriteValue(file, fMaxTime);
+
+  WriteValue(file, G4int(fSensorNames.size()));
+  for (const auto& name : fSensorNames) {
+    WriteValue(file, G4int(name.size()));
+    file.write(name.data(), name.size());
+  }
+
+  WriteValue(file, G4long(fEntries.size()));
+  for (const auto& it : fEntries) {
+    WriteValue(file, it.first.first);
+    WriteValue(file, it.first.second);
+    WriteValue(file, it.second.fNofPhotons);
+    WriteValue(file, G4int(it.second.fSensors.size()));
+    for (const auto& sensor : it.second.fSensors) {
+      WriteValue(file, sensor.fIndex);
+      WriteValue(file, sensor.fCopyNo);
+      WriteValue(file, sensor.fNofDetected);
+      for (auto count : sensor.fTimeCounts) {
+        WriteValue(file, std::uint32_t(count));
+      }
+    }
+  }
+
+  if (VerboseLevel() > 0) {
+    G4cout << "### Optical detection map with " << fEntries.size()
+           << " entries written in " << fCalibrationFileName << G4endl;
+  }
+
+  return true;
+}
+
+//_____________________________________________________________________________
+G4bool TG4OpticalDetectionMap::Read()
+{
+  /// Read the production map from the binary file; the map is not loaded
+  /// if it was calibrated with another geometry
+
+  std::ifstream file(fProductionFileName, std::ios::binary);
+  if (!file) {
+    TG4Globals::Warning("TG4OpticalDetectionMap", "Read",
+      "Cannot open file " + TString(fProductionFileName.data()));
+    return false;
+  }
+
+  char magic[sizeof(kMagic)];
+  G4int version = 0;
+  G4long geometryKey = 0;
+  file.read(magic, sizeof(magic));
+  if (!file || !std::equal(magic, magic + sizeof(magic), kMagic) ||
+      !ReadValue(file, version) || version != kVersion ||
+      !ReadValue(file, geometryKey)) {
+    TG4Globals::Warning("TG4OpticalDetectionMap", "Read",
+      "File " + TString(fProductionFileName.data()) +
+        " is not an optical detection map.");
+    return false;
+  }
+
+  if (geometryKey != GetGeometryKey()) {
+    TG4Globals::Warning("TG4OpticalDetectionMap", "Read",
+      "The map in " + TString(fProductionFileName.data()) +
+        " was calibrated with another geometry." + TG4Globals::Endl() +
+        "The map is not loaded.");
+    return false;
+  }
+
+  ReadValue(file, fNofVoxels);
+  ReadValue(file, fNofWavelengthBins);
+  ReadValue(file, fMinWavelength);
+  ReadValue(file, fMaxWavelength);
+  ReadValue(file, fNofTimeBins);
+  ReadValue(file, fMaxTime);
+
+  G4int nofSensors = 0;
+  ReadValue(file, nofSensors);
+  fSensorNames.clear();
+  for (G4int i = 0; i < nofSensors && file; ++i) {
+    G4int size = 0;
+    ReadValue(file, size);
+    std::string name(size, ' ');
+    file.read(&name[0], size);
+    fSensorNames.push_back(name);
+  }
+
+  G4long nofEntries = 0;
+  ReadValue(file, nofEntries);
+  fEntries.clear();
+  for (G4long i = 0; i < nofEntries && file; ++i) {
+    Key key;
+    G4int nofEntrySensors = 0;
+    ReadValue(file, key.first);
+    ReadValue(file, key.second);
+    Entry& entry = fEntries[key];
+    ReadValue(file, entry.fNofPhotons);
+    ReadValue(file, nofEntrySensors);
+    entry.fSensors.resize(std::max(nofEntrySensors, 0));
+    for (auto& sensor : entry.fSensors) {
+      ReadValue(file, sensor.fIndex);
+      ReadValue(file, sensor.fCopyNo);
+      ReadValue(file, sensor.fNofDetected);
+      sensor.fTimeCounts.resize(fNofTimeBins);
+      for (auto& count : sensor.fTimeCounts) {
+        std::uint32_t value = 0;
+        ReadValue(file, value);
+        count = value;
+      }
+    }
+  }
+
+  if (!file) {
+    TG4Globals::Warning("TG4OpticalDetectionMap", "Read",
+      "Failed reading " + TString(fProductionFileName.data()) +
+        ", the map is not loaded.");
+    fEntries.clear();
+    return false;
+  }
+
+  fIsLoaded = true;
+
+  if (VerboseLevel() > 0) {
+    G4cout << "### Optical detection map with " << fEntries.size()
+           << " entries loaded from " << fProductionFileName << G4endl;
+  }
+
+  return true;
+}
+
+//_____________________________________________________________________________
+void TG4OpticalDetectionMap::ClearDetectedPhotons()
+{
+  /// Clear the photons detected in this thread
+
+  GetThreadData().fDetectedPhotons.clear();
+}
+
+//_____________________________________________________________________________
+void TG4OpticalDetectionMap::PrintStatistics() const
+{
+  /// Print the production statistics in this thread
+
+  const ThreadData& threadData = GetThreadData();
+  G4cout << "### Optical detection map in thread "
+         << G4Threading::G4GetThreadId() << ": " << threadData.fNofSampled
+         << " photons sampled, " << threadData.fNofDetected << " detected, "
+         << threadData.fNofNotMapped << " not mapped (tracked)" << G4endl;
+}
+
+//_____________________________________________________________________________
+void TG4OpticalDetectionMap::ResetStatistics()
+{
+  /// Reset the production statistics in this thread
+
+  ThreadData& threadData = GetThreadData();
+  threadData.fNofSampled = 0;
+  threadData.fNofDetected = 0;
+  threadData.fNofNotMapped = 0;
+}
+
+//_____________________________________________________________________________
+void TG4OpticalDetectionMap::AddSensor(const G4String& volumeName)
+{
+  /// Add the photosensor volume
+
+  if (std::find(fSensorNames.begin(), fSensorNames.end(), volumeName) !=
+      fSensorNames.end()) {
+    return;
+  }
+  fSensorNames.push_back(volumeName);
+}
+
+//_____________________________________________________________________________
+void TG4OpticalDetectionMap::SetCalibration(const G4String& fileName)
+{
+  /// Activate the calibration run with the map written in the given file
+
+  if (fIsLoaded) {
+    TG4Globals::Warning("TG4OpticalDetectionMap", "SetCalibration",
+      "The production map is loaded, the calibration is not activated.");
+    return;
+  }
+
+  if (fSensorNames.empty()) {
+    TG4Globals::Warning("TG4OpticalDetectionMap", "SetCalibration",
+      "No photosensor volume is defined.");
+  }
+
+  fCalibrationFileName = fileName;
+}
+
+//_____________________________________________________________________________
+void TG4OpticalDetectionMap::SetProduction(const G4String& fileName)
+{
+  /// Set the production map file; it is loaded after the geometry
+  /// construction or immediately if the geometry is already constructed
+
+  if (IsCalibration()) {
+    TG4Globals::Warning("TG4OpticalDetectionMap", "SetProduction",
+      "The calibration is activated, the production map is not loaded.");
+    return;
+  }
+
+  fProductionFileName = fileName;
+  fIsLoaded = false;
+
+  if (fIsInitialized) Read();
+}
+
+//_____________________________________________________________________________
+const std::vector<TG4OpticalDetectionMap::DetectedPhoton>&
+TG4OpticalDetectionMap::GetDetectedPhotons() const
+{
+  /// Return the photons detected in the current event in this thread
+
+  return GetThreadData().fDetectedPhotons;
+}
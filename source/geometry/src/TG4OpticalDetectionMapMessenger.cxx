@@ -0,0 +1,184 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4OpticalDetectionMapMessenger.cxx
+/// \brief Implementation of the TG4OpticalDetectionMapMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4OpticalDetectionMapMessenger.h"
+#include "TG4OpticalDetectionMap.h"
+
+#include <G4UIcmdWithADoubleAndUnit.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIdirectory.hh>
+
+//______________________________________________________________________________
+TG4OpticalDetectionMapMessenger::TG4OpticalDetectionMapMessenger(
+  TG4OpticalDetectionMap* detectionMap)
+  : G4UImessenger(),
+    fDetectionMap(detectionMap),
+    fDirectory(0),
+    fAddSensorCmd(0),
+    fSetNofVoxelsCmd(0),
+    fSetNofWavelengthBinsCmd(0),
+    fSetMinWavelengthCmd(0),
+    fSetMaxWavelengthCmd(0),
+    fSetNofTimeBinsCmd(0),
+    fSetMaxTimeCmd(0),
+    fCalibrateCmd(0),
+    fLoadCmd(0)
+{
+  /// Standard constructor
+
+  fDirectory = new G4UIdirectory("/mcDet/opticalMap/");
+  fDirectory->SetGuidance("Optical photon detection map commands.");
+
+  fAddSensorCmd = new G4UIcmdWithAString("/mcDet/opticalMap/addSensor", this);
+  fAddSensorCmd->SetGuidance("Add the photosensor volume.");
+  fAddSensorCmd->SetParameterName("VolumeName", false);
+  fAddSensorCmd->AvailableForStates(G4State_PreInit);
+  fAddSensorCmd->SetToBeBroadcasted(false);
+
+  fSetNofVoxelsCmd =
+    new G4UIcmdWithAnInteger("/mcDet/opticalMap/setNofVoxels", this);
+  fSetNofVoxelsCmd->SetGuidance(
+    "Set the number of the position voxels per axis.");
+  fSetNofVoxelsCmd->SetParameterName("NofVoxels", false);
+  fSetNofVoxelsCmd->SetRange("NofVoxels > 0");
+  fSetNofVoxelsCmd->AvailableForStates(G4State_PreInit);
+  fSetNofVoxelsCmd->SetToBeBroadcasted(false);
+
+  fSetNofWavelengthBinsCmd =
+    new G4UIcmdWithAnInteger("/mcDet/opticalMap/setNofWavelengthBins", this);
+  fSetNofWavelengthBinsCmd->SetGuidance("Set the number of wavelength bins.");
+  fSetNofWavelengthBinsCmd->SetParameterName("NofBins", false);
+  fSetNofWavelengthBinsCmd->SetRange("NofBins > 0");
+  fSetNofWavelengthBinsCmd->AvailableForStates(G4State_PreInit);
+  fSetNofWavelengthBinsCmd->SetToBeBroadcasted(false);
+
+  fSetMinWavelengthCmd = new G4UIcmdWithADoubleAndUnit(
+    "/mcDet/opticalMap/setMinWavelength", this);
+  fSetMinWavelengthCmd->SetGuidance("Set the wavelength range minimum.");
+  fSetMinWavelengthCmd->SetParameterName("MinWavelength", false);
+  fSetMinWavelengthCmd->SetDefaultUnit("nm");
+  fSetMinWavelengthCmd->SetUnitCategory("Length");
+  fSetMinWavelengthCmd->AvailableForStates(G4State_PreInit);
+  fSetMinWavelengthCmd->SetToBeBroadcasted(false);
+
+  fSetMaxWavelengthCmd = new G4UIcmdWithADoubleAndUnit(
+    "/mcDet/opticalMap/setMaxWavelength", this);
+  fSetMaxWavelengthCmd->SetGuidance("Set the wavelength range maximum.");
+  fSetMaxWavelengthCmd->SetParameterName("MaxWavelength", false);
+  fSetMaxWavelengthCmd->SetDefaultUnit("nm");
+  fSetMaxWavelengthCmd->SetUnitCategory("Length");
+  fSetMaxWavelengthCmd->AvailableForStates(G4State_PreInit);
+  fSetMaxWavelengthCmd->SetToBeBroadcasted(false);
+
+  fSetNofTimeBinsCmd =
+    new G4UIcmdWithAnInteger("/mcDet/opticalMap/setNofTimeBins", this);
+  fSetNofTimeBinsCmd->SetGuidance(
+    "Set the number of the time of flight bins.");
+  fSetNofTimeBinsCmd->SetParameterName("NofBins", false);
+  fSetNofTimeBinsCmd->SetRange("NofBins > 0");
+  fSetNofTimeBinsCmd->AvailableForStates(G4State_PreInit);
+  fSetNofTimeBinsCmd->SetToBeBroadcasted(false);
+
+  fSetMaxTimeCmd =
+    new G4UIcmdWithADoubleAndUnit("/mcDet/opticalMap/setMaxTime", this);
+  fSetMaxTimeCmd->SetGuidance(
+    "Set the time of flight range maximum; the later detections");
+  fSetMaxTimeCmd->SetGuidance("are accounted in the last bin.");
+  fSetMaxTimeCmd->SetParameterName("MaxTime", false);
+  fSetMaxTimeCmd->SetDefaultUnit("ns");
+  fSetMaxTimeCmd->SetUnitCategory("Time");
+  fSetMaxTimeCmd->SetRange("MaxTime > 0");
+  fSetMaxTimeCmd->AvailableForStates(G4State_PreInit);
+  fSetMaxTimeCmd->SetToBeBroadcasted(false);
+
+  fCalibrateCmd = new G4UIcmdWithAString("/mcDet/opticalMap/calibrate", this);
+  fCalibrateCmd->SetGuidance(
+    "Activate the map calibration; the map is written in the file");
+  fCalibrateCmd->SetGuidance("with the given name at the end of each run.");
+  fCalibrateCmd->SetParameterName("FileName", true);
+  fCalibrateCmd->SetDefaultValue("opticalMap.bin");
+  fCalibrateCmd->AvailableForStates(G4State_PreInit);
+  fCalibrateCmd->SetToBeBroadcasted(false);
+
+  fLoadCmd = new G4UIcmdWithAString("/mcDet/opticalMap/load", this);
+  fLoadCmd->SetGuidance(
+    "Load the map from the file with the given name; the Cerenkov and");
+  fLoadCmd->SetGuidance(
+    "scintillation photons detection is then sampled from the map.");
+  fLoadCmd->SetParameterName("FileName", true);
+  fLoadCmd->SetDefaultValue("opticalMap.bin");
+  fLoadCmd->AvailableForStates(G4State_PreInit);
+  fLoadCmd->SetToBeBroadcasted(false);
+}
+
+//______________________________________________________________________________
+TG4OpticalDetectionMapMessenger::~TG4OpticalDetectionMapMessenger()
+{
+  /// Destructor
+
+  delete fDirectory;
+  delete fAddSensorCmd;
+  delete fSetNofVoxelsCmd;
+  delete fSetNofWavelengthBinsCmd;
+  delete fSetMinWavelengthCmd;
+  delete fSetMaxWavelengthCmd;
+  delete fSetNofTimeBinsCmd;
+  delete fSetMaxTimeCmd;
+  delete fCalibrateCmd;
+  delete fLoadCmd;
+}
+
+//
+// public methods
+//
+
+//______________________________________________________________________________
+void TG4OpticalDetectionMapMessenger::SetNewValue(
+  G4UIcommand* command, G4String newValue)
+{
+  /// Apply command to the associated object.
+
+  if (command == fAddSensorCmd) {
+    fDetectionMap->AddSensor(newValue);
+  }
+  else if (command == fSetNofVoxelsCmd) {
+    fDetectionMap->SetNofVoxels(fSetNofVoxelsCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fSetNofWavelengthBinsCmd) {
+    fDetectionMap->SetNofWavelengthBins(
+      fSetNofWavelengthBinsCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fSetMinWavelengthCmd) {
+    fDetectionMap->SetMinWavelength(
+      fSetMinWavelengthCmd->GetNewDoubleValue(newValue));
+  }
+  else if (command == fSetMaxWavelengthCmd) {
+    fDetectionMap->SetMaxWavelength(
+      fSetMaxWavelengthCmd->GetNewDoubleValue(newValue));
+  }
+  else if (command == fSetNofTimeBinsCmd) {
+    fDetectionMap->SetNofTimeBins(
+      fSetNofTimeBinsCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fSetMaxTimeCmd) {
+    fDetectionMap->SetMaxTime(fSetMaxTimeCmd->GetNewDoubleValue(newValue));
+  }
+  else if (command == fCalibrateCmd) {
+    fDetectionMap->SetCalibration(newValue);
+  }
+  else if (command == fLoadCmd) {
+    fDetectionMap->SetProduction(newValue);
+  }
+}
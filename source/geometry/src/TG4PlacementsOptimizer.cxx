@@ -0,0 +1,220 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4PlacementsOptimizer.cxx
+/// \brief Implementation of the TG4PlacementsOptimizer class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4PlacementsOptimizer.h"
+#include "TG4RegularParameterisation.h"
+
+#include <G4GeometryTolerance.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4PVParameterised.hh>
+#include <G4VPhysicalVolume.hh>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+G4bool IsEqual(
+  const G4RotationMatrix& lhs, const G4RotationMatrix& rhs, G4double tolerance)
+{
+  return std::fabs(lhs.xx() - rhs.xx()) < tolerance &&
+         std::fabs(lhs.xy() - rhs.xy()) < tolerance &&
+         std::fabs(lhs.xz() - rhs.xz()) < tolerance &&
+         std::fabs(lhs.yx() - rhs.yx()) < tolerance &&
+         std::fabs(lhs.yy() - rhs.yy()) < tolerance &&
+         std::fabs(lhs.yz() - rhs.yz()) < tolerance &&
+         std::fabs(lhs.zx() - rhs.zx()) < tolerance &&
+         std::fabs(lhs.zy() - rhs.zy()) < tolerance &&
+         std::fabs(lhs.zz() - rhs.zz()) < tolerance;
+}
+
+} // namespace
+
+const G4int TG4PlacementsOptimizer::fgkDefaultMinNofCopies = 10;
+const G4double TG4PlacementsOptimizer::fgkRotationTolerance = 1e-9;
+
+//_____________________________________________________________________________
+TG4PlacementsOptimizer::TG4PlacementsOptimizer()
+  : TG4Verbose("placementsOptimizer"),
+    fIsActive(false),
+    fMinNofCopies(fgkDefaultMinNofCopies),
+    fParameterisations()
+{
+  /// Default constructor
+}
+
+//_____________________________________________________________________________
+TG4PlacementsOptimizer::~TG4PlacementsOptimizer()
+{
+  /// Destructor
+
+  for (auto parameterisation : fParameterisations) {
+    delete parameterisation;
+  }
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+G4bool TG4PlacementsOptimizer::GetDaughters(G4LogicalVolume* motherLV,
+  G4int firstCopyNo, std::vector<G4VPhysicalVolume*>& daughters) const
+{
+  /// Fill the daughters of the given mother ordered by their copy number;
+  /// return false if the daughters cannot be replaced with a parameterised
+  /// volume
+
+  G4int nofDaughters = motherLV->GetNoDaughters();
+  if (nofDaughters < std::max(fMinNofCopies, 2)) return false;
+
+  G4LogicalVolume* lv = motherLV->GetDaughter(0)->GetLogicalVolume();
+  daughters.assign(nofDaughters, 0);
+
+  for (G4int i = 0; i < nofDaughters; ++i) {
+    G4VPhysicalVolume* pv = motherLV->GetDaughter(i);
+    if (pv->VolumeType() != kNormal || pv->GetLogicalVolume() != lv) {
+      return false;
+    }
+
+    // the copy numbers must map on the parameterised volume copy numbers
+    G4int index = pv->GetCopyNo() - firstCopyNo;
+    if (index < 0 || index >= nofDaughters || daughters[index]) return false;
+
+    daughters[index] = pv;
+  }
+
+  return true;
+}
+
+//_____________________________________________________________________________
+G4VPVParameterisation* TG4PlacementsOptimizer::CreateParameterisation(
+  const std::vector<G4VPhysicalVolume*>& daughters) const
+{
+  /// Create the parameterisation if the daughters follow the translation
+  /// or the rotation pattern; return 0 otherwise
+
+  G4double tolerance =
+    G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+
+  G4int nofCopies = daughters.size();
+  G4ThreeVector origin = daughters[0]->GetObjectTranslation();
+  G4RotationMatrix rotation = daughters[0]->GetObjectRotationValue();
+
+  // translation pattern
+  G4ThreeVector step = daughters[1]->GetObjectTranslation() - origin;
+  G4bool isTranslation = step.mag() > tolerance;
+  for (G4int i = 1; i < nofCopies && isTranslation; ++i) {
+    G4ThreeVector translation = origin + i * step;
+    isTranslation =
+      IsEqual(daughters[i]->GetObjectRotationValue(), rotation,
+        fgkRotationTolerance) &&
+      (daughters[i]->GetObjectTranslation() - translation).mag() < tolerance;
+  }
+  if (isTranslation) {
+    return new TG4RegularParameterisation(origin, step, rotation);
+  }
+
+  // rotation pattern around the mother z axis
+  G4RotationMatrix delta =
+    daughters[1]->GetObjectRotationValue() * rotation.inverse();
+  if (std::fabs(delta.zz() - 1.) > fgkRotationTolerance) return 0;
+
+  G4double phiStep = std::atan2(delta.yx(), delta.xx());
+  if (std::fabs(phiStep) < fgkRotationTolerance) return 0;
+
+  for (G4int i = 1; i < nofCopies; ++i) {
+    G4RotationMatrix expectedRotation = rotation;
+    expectedRotation.rotateZ(i * phiStep);
+    G4ThreeVector translation = origin;
+    translation.rotateZ(i * phiStep);
+
+    if (!IsEqual(daughters[i]->GetObjectRotationValue(), expectedRotation,
+          fgkRotationTolerance) ||
+        (daughters[i]->GetObjectTranslation() - translation).mag() >=
+          tolerance) {
+      return 0;
+    }
+  }
+
+  return new TG4RegularParameterisation(origin, phiStep, rotation, nofCopies);
+}
+
+//_____________________________________________________________________________
+void TG4PlacementsOptimizer::Replace(G4LogicalVolume* motherLV,
+  const std::vector<G4VPhysicalVolume*>& daughters,
+  G4VPVParameterisation* parameterisation)
+{
+  /// Replace the daughters placements with the parameterised volume
+
+  G4String name = daughters[0]->GetName();
+  G4LogicalVolume* lv = daughters[0]->GetLogicalVolume();
+  G4int nofCopies = daughters.size();
+
+  // the physical volume is removed from the store in its destructor
+  for (auto pv : daughters) {
+    motherLV->RemoveDaughter(pv);
+    delete pv;
+  }
+
+  new G4PVParameterised(
+    name, lv, motherLV, kUndefined, nofCopies, parameterisation);
+  fParameterisations.push_back(parameterisation);
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4PlacementsOptimizer::Optimize(G4int firstCopyNo)
+{
+  /// Replace the regularly placed copies of identical volumes with
+  /// parameterised volumes.
+  /// \param firstCopyNo  The copy number of the first copy which is mapped
+  ///                     on the first copy of the parameterised volume
+
+  if (!fIsActive) return;
+
+  G4int nofPlacements = 0;
+  G4int nofParameterised = 0;
+
+  G4LogicalVolumeStore* lvStore = G4LogicalVolumeStore::GetInstance();
+  for (auto motherLV : *lvStore) {
+    std::vector<G4VPhysicalVolume*> daughters;
+    if (!GetDaughters(motherLV, firstCopyNo, daughters)) continue;
+
+    G4VPVParameterisation* parameterisation =
+      CreateParameterisation(daughters);
+    if (!parameterisation) continue;
+
+    if (VerboseLevel() > 1) {
+      G4cout << "Replacing " << daughters.size() << " copies of "
+             << daughters[0]->GetName() << " in " << motherLV->GetName()
+             << " with a parameterised volume" << G4endl;
+    }
+
+    nofPlacements += daughters.size();
+    ++nofParameterised;
+    Replace(motherLV, daughters, parameterisation);
+  }
+
+  if (VerboseLevel() > 0) {
+    G4cout << "### Placements optimizer: replaced " << nofPlacements
+           << " placements with " << nofParameterised
+           << " parameterised volumes" << G4endl;
+  }
+}
@@ -0,0 +1,192 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ProfilingNavigator.cxx
+/// \brief Implementation of the TG4ProfilingNavigator class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4ProfilingNavigator.h"
+
+#include <G4LogicalVolume.hh>
+#include <G4Threading.hh>
+#include <G4VPhysicalVolume.hh>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+// static data members
+G4ThreadLocal TG4ProfilingNavigator* TG4ProfilingNavigator::fgInstance = 0;
+
+namespace
+{
+
+G4double Now()
+{
+  return std::chrono::duration<G4double>(
+    std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+} // namespace
+
+//_____________________________________________________________________________
+TG4ProfilingNavigator::TG4ProfilingNavigator(
+  G4int samplingPeriod, G4int nofPrintedVolumes)
+  : G4Navigator(),
+    fSamplingPeriod(samplingPeriod > 0 ? samplingPeriod : 1),
+    fNofPrintedVolumes(nofPrintedVolumes),
+    fNofCalls(0),
+    fStatistics(),
+    fLastVolume(0),
+    fLastStatistics(0)
+{
+  /// Standard constructor
+
+  fgInstance = this;
+}
+
+//_____________________________________________________________________________
+TG4ProfilingNavigator::~TG4ProfilingNavigator()
+{
+  /// Destructor
+
+  fgInstance = 0;
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+TG4ProfilingNavigator::Statistics& TG4ProfilingNavigator::GetStatistics()
+{
+  /// Return the statistics of the current volume
+
+  G4VPhysicalVolume* physicalVolume = fHistory.GetTopVolume();
+  const G4LogicalVolume* volume =
+    physicalVolume ? physicalVolume->GetLogicalVolume() : 0;
+
+  if (!fLastStatistics || volume != fLastVolume) {
+    fLastVolume = volume;
+    fLastStatistics = &fStatistics[volume];
+  }
+  return *fLastStatistics;
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+G4double TG4ProfilingNavigator::ComputeStep(const G4ThreeVector& globalPoint,
+  const G4ThreeVector& direction, const G4double proposedStepLength,
+  G4double& newSafety)
+{
+  /// Count the call in the current volume and sample its time
+
+  Statistics& statistics = GetStatistics();
+  ++statistics.fNofStepCalls;
+
+  if (++fNofCalls % fSamplingPeriod != 0) {
+    return G4Navigator::ComputeStep(
+      globalPoint, direction, proposedStepLength, newSafety);
+  }
+
+  G4double startTime = Now();
+  G4double step = G4Navigator::ComputeStep(
+    globalPoint, direction, proposedStepLength, newSafety);
+  statistics.fSampledStepTime += Now() - startTime;
+  ++statistics.fNofSampledStepCalls;
+
+  return step;
+}
+
+//_____________________________________________________________________________
+G4double TG4ProfilingNavigator::ComputeSafety(const G4ThreeVector& globalPoint,
+  const G4double proposedMaxLength, const G4bool keepState)
+{
+  /// Count the call in the current volume and sample its time
+
+  Statistics& statistics = GetStatistics();
+  ++statistics.fNofSafetyCalls;
+
+  if (++fNofCalls % fSamplingPeriod != 0) {
+    return G4Navigator::ComputeSafety(
+      globalPoint, proposedMaxLength, keepState);
+  }
+
+  G4double startTime = Now();
+  G4double safety =
+    G4Navigator::ComputeSafety(globalPoint, proposedMaxLength, keepState);
+  statistics.fSampledSafetyTime += Now() - startTime;
+  ++statistics.fNofSampledSafetyCalls;
+
+  return safety;
+}
+
+//_____________________________________________________________________________
+void TG4ProfilingNavigator::PrintStatistics() const
+{
+  /// Print the profile of the volumes with the largest estimated time
+
+  // Estimate the total time per volume from the sampled calls
+  auto estimate = [](G4long nofCalls, G4long nofSampled, G4double time) {
+    return nofSampled > 0 ? time / nofSampled * nofCalls : 0.;
+  };
+
+  std::vector<std::pair<G4double, const G4LogicalVolume*>> volumes;
+  G4double totalTime = 0.;
+  for (const auto& it : fStatistics) {
+    const Statistics& statistics = it.second;
+    G4double time = estimate(statistics.fNofStepCalls,
+                      statistics.fNofSampledStepCalls,
+                      statistics.fSampledStepTime) +
+                    estimate(statistics.fNofSafetyCalls,
+                      statistics.fNofSampledSafetyCalls,
+                      statistics.fSampledSafetyTime);
+    volumes.push_back(std::make_pair(time, it.first));
+    totalTime += time;
+  }
+  std::sort(volumes.begin(), volumes.end(),
+    [](const std::pair<G4double, const G4LogicalVolume*>& a,
+      const std::pair<G4double, const G4LogicalVolume*>& b) {
+      return a.first > b.first;
+    });
+
+  G4int threadId = G4Threading::G4GetThreadId();
+  G4cout << "### Navigation profile in thread " << threadId << ": "
+         << fNofCalls << " calls in " << fStatistics.size()
+         << " volumes, estimated time " << totalTime << " s" << G4endl;
+
+  G4int counter = 0;
+  for (const auto& it : volumes) {
+    if (fNofPrintedVolumes > 0 && counter++ >= fNofPrintedVolumes) break;
+
+    const Statistics& statistics = fStatistics.at(it.second);
+    G4String name = it.second ? it.second->GetName() : G4String("outside");
+    G4cout << "NavProfile " << name << " thread " << threadId
+           << " computeStepCalls " << statistics.fNofStepCalls
+           << " computeSafetyCalls " << statistics.fNofSafetyCalls
+           << " timeMs " << it.first * 1.e3 << " timeFraction "
+           << (totalTime > 0. ? it.first / totalTime : 0.) << G4endl;
+  }
+}
+
+//_____________________________________________________________________________
+void TG4ProfilingNavigator::ResetStatistics()
+{
+  /// Reset the accumulated statistics
+
+  fStatistics.clear();
+  fNofCalls = 0;
+  fLastVolume = 0;
+  fLastStatistics = 0;
+}
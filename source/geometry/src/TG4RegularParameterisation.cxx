@@ -0,0 +1,82 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4RegularParameterisation.cxx
+/// \brief Implementation of the TG4RegularParameterisation class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4RegularParameterisation.h"
+
+#include <G4VPhysicalVolume.hh>
+
+//_____________________________________________________________________________
+TG4RegularParameterisation::TG4RegularParameterisation(
+  const G4ThreeVector& origin, const G4ThreeVector& step,
+  const G4RotationMatrix& objectRotation)
+  : G4VPVParameterisation(),
+    fOrigin(origin),
+    fStep(step),
+    fPhiStep(0.),
+    fIsRotation(false),
+    fIsIdentity(objectRotation.isIdentity()),
+    fRotations(1, objectRotation.inverse())
+{
+  /// Standard constructor for the translation pattern
+}
+
+//_____________________________________________________________________________
+TG4RegularParameterisation::TG4RegularParameterisation(
+  const G4ThreeVector& origin, G4double phiStep,
+  const G4RotationMatrix& objectRotation, G4int nofCopies)
+  : G4VPVParameterisation(),
+    fOrigin(origin),
+    fStep(),
+    fPhiStep(phiStep),
+    fIsRotation(true),
+    fIsIdentity(false),
+    fRotations()
+{
+  /// Standard constructor for the rotation pattern
+
+  fRotations.reserve(nofCopies);
+  for (G4int i = 0; i < nofCopies; ++i) {
+    G4RotationMatrix rotation = objectRotation;
+    rotation.rotateZ(i * fPhiStep);
+    fRotations.push_back(rotation.inverse());
+  }
+}
+
+//_____________________________________________________________________________
+TG4RegularParameterisation::~TG4RegularParameterisation()
+{
+  /// Destructor
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4RegularParameterisation::ComputeTransformation(
+  const G4int copyNo, G4VPhysicalVolume* physVol) const
+{
+  /// Set the translation and rotation of the copy with the given number
+
+  if (!fIsRotation) {
+    physVol->SetTranslation(fOrigin + copyNo * fStep);
+    physVol->SetRotation(fIsIdentity ? 0 : &fRotations[0]);
+    return;
+  }
+
+  G4ThreeVector translation = fOrigin;
+  translation.rotateZ(copyNo * fPhiStep);
+  physVol->SetTranslation(translation);
+  physVol->SetRotation(&fRotations[copyNo]);
+}
@@ -0,0 +1,121 @@
+#ifndef TG4_MT_PROFILER_H
+#define TG4_MT_PROFILER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4MTProfiler.h
+/// \brief Definition of the TG4MTProfiler class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4AutoLock.hh>
+#include <globals.hh>
+
+#include <map>
+
+/// \ingroup global
+/// \brief The profiler of the multi-threaded run
+///
+/// When activated (with /mcControl/profileMT command), it collects
+/// - the time of events per thread,
+/// - the time spent in waiting for the Geant4 VMC owned mutexes per
+///   locking site,
+/// - the time of the VMC phases of the threads initialization and
+///   merging (per phase: number of calls, total and maximum time).
+///
+/// The data are accumulated since the profiler activation and
+/// printed at the end of each run on master in the lines starting with
+/// "MTProfile", which can be processed by the examples/mt_scaling.sh
+/// script. All collecting methods are static and do nothing when the
+/// profiler does not exist or it is not active.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4MTProfiler
+{
+ public:
+  TG4MTProfiler();
+  ~TG4MTProfiler();
+
+  // static access method
+  static TG4MTProfiler* Instance();
+
+  // static methods
+  static void Lock(G4AutoLock& lock, const char* site);
+  static G4double StartTimer();
+  static void AddPhaseTime(const char* phase, G4double startTime);
+  static void StartEvent();
+  static void EndEvent();
+
+  // methods
+  void Print() const;
+
+  // set methods
+  void SetIsActive(G4bool isActive);
+
+  // get methods
+  G4bool IsActive() const;
+
+ private:
+  /// The accumulated timing data
+  struct Stat
+  {
+    G4long fCount = 0;      ///< the number of measurements
+    G4double fTime = 0.;    ///< the total time (s)
+    G4double fMaxTime = 0.; ///< the maximum time (s)
+  };
+
+  /// Not implemented
+  TG4MTProfiler(const TG4MTProfiler& right);
+  /// Not implemented
+  TG4MTProfiler& operator=(const TG4MTProfiler& right);
+
+  // static methods
+  static G4double Now();
+  static void Add(Stat& stat, G4double time);
+
+  // static data members
+  /// this instance
+  static TG4MTProfiler* fgInstance;
+  /// the start time of the current event in this thread
+  static G4ThreadLocal G4double fgEventStartTime;
+
+  // data members
+  /// Option to activate collecting the data
+  G4bool fIsActive;
+  /// The mutex waiting time per locking site
+  std::map<G4String, Stat> fLockStats;
+  /// The phase time per phase name
+  std::map<G4String, Stat> fPhaseStats;
+  /// The event time per thread Id
+  std::map<G4int, Stat> fEventStats;
+};
+
+// inline functions
+
+inline TG4MTProfiler* TG4MTProfiler::Instance()
+{
+  /// Return this instance
+  return fgInstance;
+}
+
+inline void TG4MTProfiler::SetIsActive(G4bool isActive)
+{
+  /// (In)Activate collecting the profiling data
+  fIsActive = isActive;
+}
+
+inline G4bool TG4MTProfiler::IsActive() const
+{
+  /// Return true if collecting the profiling data is activated
+  return fIsActive;
+}
+
+#endif // TG4_MT_PROFILER_H
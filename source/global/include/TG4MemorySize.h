@@ -0,0 +1,148 @@
+#ifndef TG4_MEMORY_SIZE_H
+#define TG4_MEMORY_SIZE_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4MemorySize.h
+/// \brief Definition of the TG4MemorySize class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <globals.hh>
+
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/// \ingroup global
+/// \brief Estimates of the heap memory owned by the standard containers
+///
+/// The static functions return the estimated size (in bytes) of the heap
+/// memory allocated by the given container, including the memory owned
+/// by its string elements, but not the memory of the objects pointed
+/// to by the elements. The node overhead is estimated for the usual
+/// implementations of the standard library.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4MemorySize
+{
+ public:
+  // static methods
+  static std::size_t Of(const G4String& string);
+
+  template <typename T>
+  static std::size_t Of(const T& value);
+
+  template <typename T1, typename T2>
+  static std::size_t Of(const std::pair<T1, T2>& pair);
+
+  template <typename T, typename A>
+  static std::size_t Of(const std::vector<T, A>& vector);
+
+  template <typename K, typename C, typename A>
+  static std::size_t Of(const std::set<K, C, A>& set);
+
+  template <typename K, typename V, typename C, typename A>
+  static std::size_t Of(const std::map<K, V, C, A>& map);
+
+  template <typename K, typename V, typename H, typename E, typename A>
+  static std::size_t Of(const std::unordered_map<K, V, H, E, A>& map);
+
+ private:
+  /// The tree node overhead (three pointers and colour)
+  static constexpr std::size_t fgkTreeNodeOverhead = 4 * sizeof(void*);
+  /// The hash node overhead (next pointer and cached hash)
+  static constexpr std::size_t fgkHashNodeOverhead = 2 * sizeof(void*);
+  /// The size of the string local buffer
+  static constexpr std::size_t fgkStringLocalCapacity = 15;
+};
+
+// inline functions
+
+inline std::size_t TG4MemorySize::Of(const G4String& string)
+{
+  /// Return the heap memory allocated by the string
+
+  return (string.capacity() > fgkStringLocalCapacity) ? string.capacity() + 1
+                                                       : 0;
+}
+
+template <typename T>
+inline std::size_t TG4MemorySize::Of(const T& /*value*/)
+{
+  /// Return the heap memory owned by a value of a trivial type (none)
+
+  return 0;
+}
+
+template <typename T1, typename T2>
+inline std::size_t TG4MemorySize::Of(const std::pair<T1, T2>& pair)
+{
+  /// Return the heap memory owned by the pair elements
+
+  return Of(pair.first) + Of(pair.second);
+}
+
+template <typename T, typename A>
+inline std::size_t TG4MemorySize::Of(const std::vector<T, A>& vector)
+{
+  /// Return the heap memory allocated by the vector
+
+  std::size_t size = vector.capacity() * sizeof(T);
+  for (const auto& it : vector) {
+    size += Of(it);
+  }
+  return size;
+}
+
+template <typename K, typename C, typename A>
+inline std::size_t TG4MemorySize::Of(const std::set<K, C, A>& set)
+{
+  /// Return the heap memory allocated by the set
+
+  std::size_t size = set.size() * (sizeof(K) + fgkTreeNodeOverhead);
+  for (const auto& it : set) {
+    size += Of(it);
+  }
+  return size;
+}
+
+template <typename K, typename V, typename C, typename A>
+inline std::size_t TG4MemorySize::Of(const std::map<K, V, C, A>& map)
+{
+  /// Return the heap memory allocated by the map
+
+  std::size_t size =
+    map.size() * (sizeof(std::pair<const K, V>) + fgkTreeNodeOverhead);
+  for (const auto& it : map) {
+    size += Of(it.first) + Of(it.second);
+  }
+  return size;
+}
+
+template <typename K, typename V, typename H, typename E, typename A>
+inline std::size_t TG4MemorySize::Of(
+  const std::unordered_map<K, V, H, E, A>& map)
+{
+  /// Return the heap memory allocated by the unordered map
+
+  std::size_t size =
+    map.size() * (sizeof(std::pair<const K, V>) + fgkHashNodeOverhead) +
+    map.bucket_count() * sizeof(void*);
+  for (const auto& it : map) {
+    size += Of(it.first) + Of(it.second);
+  }
+  return size;
+}
+
+#endif // TG4_MEMORY_SIZE_H
@@ -55,6 +55,7 @@ class TG4ProcessMap
   TG4G3Control GetControl(const G4VProcess* process) const;
   G4String GetMCProcessName(const G4VProcess* process) const;
   G4String GetControlName(const G4VProcess* process) const;
+  std::size_t GetMemorySize() const;
 
  private:
   // methods
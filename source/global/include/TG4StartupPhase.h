@@ -0,0 +1,63 @@
+#ifndef TG4_STARTUP_PHASE_H
+#define TG4_STARTUP_PHASE_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4StartupPhase.h
+/// \brief Definition of the TG4StartupPhase class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4StartupProfiler.h"
+
+#include <globals.hh>
+
+/// \ingroup global
+/// \brief The scoped timer of an initialization phase
+///
+/// The phase with the given name is started in the constructor and
+/// stopped in the destructor of this object; see TG4StartupProfiler.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4StartupPhase
+{
+ public:
+  TG4StartupPhase(const G4String& name);
+  ~TG4StartupPhase();
+
+ private:
+  /// Not implemented
+  TG4StartupPhase();
+  /// Not implemented
+  TG4StartupPhase(const TG4StartupPhase& right);
+  /// Not implemented
+  TG4StartupPhase& operator=(const TG4StartupPhase& right);
+
+  // data members
+  /// The phase name
+  G4String fName;
+};
+
+// inline functions
+
+inline TG4StartupPhase::TG4StartupPhase(const G4String& name) : fName(name)
+{
+  /// Standard constructor: start the phase
+  TG4StartupProfiler::StartPhase(fName);
+}
+
+inline TG4StartupPhase::~TG4StartupPhase()
+{
+  /// Destructor: stop the phase
+  TG4StartupProfiler::StopPhase(fName);
+}
+
+#endif // TG4_STARTUP_PHASE_H
@@ -0,0 +1,137 @@
+#ifndef TG4_STARTUP_PROFILER_H
+#define TG4_STARTUP_PROFILER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4StartupProfiler.h
+/// \brief Definition of the TG4StartupProfiler class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <globals.hh>
+
+#include <map>
+#include <vector>
+
+/// \ingroup global
+/// \brief The profiler of the initialization phases
+///
+/// It collects the wall time and the change of the process resident
+/// memory (RSS) of the initialization phases, which are defined with the
+/// StartPhase() and StopPhase() calls or with the TG4StartupPhase scoped
+/// object. The phases started within another phase are recorded as its
+/// sub-phases and the phases are recorded separately for master and for
+/// each worker thread. The RSS is measured for the whole process, so
+/// the RSS changes of the phases running in parallel on several workers
+/// are not separated.
+///
+/// The data are always collected (the overhead is negligible) and, when
+/// activated with /mcControl/profileStartup command, they are printed
+/// at the end of each run on master as a hierarchical report and
+/// optionally written in a JSON file (/mcControl/profileStartupFile).
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4StartupProfiler
+{
+ public:
+  TG4StartupProfiler();
+  ~TG4StartupProfiler();
+
+  // static access method
+  static TG4StartupProfiler* Instance();
+
+  // static methods
+  static void StartPhase(const G4String& name);
+  static void StopPhase(const G4String& name);
+
+  // methods
+  void Print() const;
+  void WriteJson(const G4String& fileName) const;
+  void Report() const;
+
+  // set methods
+  void SetIsPrint(G4bool isPrint);
+  void SetFileName(const G4String& fileName);
+
+  // get methods
+  G4bool IsPrint() const;
+
+ private:
+  /// The started phase
+  struct Frame
+  {
+    G4String fName;         ///< the phase name
+    G4double fStartTime;    ///< the start time (s)
+    G4long fStartRss;       ///< the RSS at start (kB)
+  };
+
+  /// The accumulated phase data
+  struct Record
+  {
+    G4String fPath;         ///< the phase path (with parent phases)
+    G4int fDepth = 0;       ///< the number of parent phases
+    G4long fCount = 0;      ///< the number of calls
+    G4double fTime = 0.;    ///< the total time (s)
+    G4long fRssDelta = 0;   ///< the total RSS change (kB)
+  };
+
+  /// Not implemented
+  TG4StartupProfiler(const TG4StartupProfiler& right);
+  /// Not implemented
+  TG4StartupProfiler& operator=(const TG4StartupProfiler& right);
+
+  // static methods
+  static G4double Now();
+  static G4long CurrentRss();
+  static G4String ThreadName(G4int threadId);
+
+  // static data members
+  /// this instance
+  static TG4StartupProfiler* fgInstance;
+
+  // data members
+  /// Option to print the profile at the end of run
+  G4bool fIsPrint;
+  /// The JSON output file name (no file is written if empty)
+  G4String fFileName;
+  /// The stacks of started phases per thread Id
+  std::map<G4int, std::vector<Frame>> fStacks;
+  /// The phase records per thread Id (in the order of the first start)
+  std::map<G4int, std::vector<Record>> fRecords;
+};
+
+// inline functions
+
+inline TG4StartupProfiler* TG4StartupProfiler::Instance()
+{
+  /// Return this instance
+  return fgInstance;
+}
+
+inline void TG4StartupProfiler::SetIsPrint(G4bool isPrint)
+{
+  /// (In)Activate printing the profile at the end of run
+  fIsPrint = isPrint;
+}
+
+inline void TG4StartupProfiler::SetFileName(const G4String& fileName)
+{
+  /// Set the JSON output file name
+  fFileName = fileName;
+}
+
+inline G4bool TG4StartupProfiler::IsPrint() const
+{
+  /// Return true if printing the profile is activated
+  return fIsPrint;
+}
+
+#endif // TG4_STARTUP_PROFILER_H
@@ -0,0 +1,182 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4MTProfiler.cxx
+/// \brief Implementation of the TG4MTProfiler class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4MTProfiler.h"
+#include "TG4Globals.h"
+
+#include <G4Threading.hh>
+
+#include <chrono>
+
+namespace
+{
+// Mutex to lock updating the profiling data
+G4Mutex profilerMutex = G4MUTEX_INITIALIZER;
+} // namespace
+
+// static data members
+TG4MTProfiler* TG4MTProfiler::fgInstance = 0;
+G4ThreadLocal G4double TG4MTProfiler::fgEventStartTime = 0.;
+
+//_____________________________________________________________________________
+TG4MTProfiler::TG4MTProfiler()
+  : fIsActive(false),
+    fLockStats(),
+    fPhaseStats(),
+    fEventStats()
+{
+  /// Default constructor
+
+  if (fgInstance) {
+    TG4Globals::Exception("TG4MTProfiler", "TG4MTProfiler",
+      "Cannot create two instances of singleton.");
+  }
+
+  fgInstance = this;
+}
+
+//_____________________________________________________________________________
+TG4MTProfiler::~TG4MTProfiler()
+{
+  /// Destructor
+
+  fgInstance = 0;
+}
+
+//
+// private static methods
+//
+
+//_____________________________________________________________________________
+G4double TG4MTProfiler::Now()
+{
+  /// Return the current time (s) of the monotonic clock
+
+  return std::chrono::duration<G4double>(
+    std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+//_____________________________________________________________________________
+void TG4MTProfiler::Add(Stat& stat, G4double time)
+{
+  /// Add the given time in the statistics.
+  /// The profiler mutex must be locked by the caller.
+
+  ++stat.fCount;
+  stat.fTime += time;
+  if (time > stat.fMaxTime) stat.fMaxTime = time;
+}
+
+//
+// public static methods
+//
+
+//_____________________________________________________________________________
+void TG4MTProfiler::Lock(G4AutoLock& lock, const char* site)
+{
+  /// Lock the given lock (created with std::defer_lock) and record
+  /// the waiting time for the given locking site if profiling is active
+
+  if (!fgInstance || !fgInstance->fIsActive) {
+    lock.lock();
+    return;
+  }
+
+  G4double start = Now();
+  lock.lock();
+  G4double time = Now() - start;
+
+  G4AutoLock lm(&profilerMutex);
+  Add(fgInstance->fLockStats[site], time);
+}
+
+//_____________________________________________________________________________
+G4double TG4MTProfiler::StartTimer()
+{
+  /// Return the start time for the AddPhaseTime() call,
+  /// or 0 if profiling is not active
+
+  if (!fgInstance || !fgInstance->fIsActive) return 0.;
+
+  return Now();
+}
+
+//_____________________________________________________________________________
+void TG4MTProfiler::AddPhaseTime(const char* phase, G4double startTime)
+{
+  /// Record the time elapsed since the given start time
+  /// (obtained with StartTimer()) for the given phase
+
+  if (!fgInstance || !fgInstance->fIsActive || startTime == 0.) return;
+
+  G4double time = Now() - startTime;
+
+  G4AutoLock lm(&profilerMutex);
+  Add(fgInstance->fPhaseStats[phase], time);
+}
+
+//_____________________________________________________________________________
+void TG4MTProfiler::StartEvent()
+{
+  /// Start the event timer in this thread
+
+  fgEventStartTime = StartTimer();
+}
+
+//_____________________________________________________________________________
+void TG4MTProfiler::EndEvent()
+{
+  /// Record the event time in this thread
+
+  if (!fgInstance || !fgInstance->fIsActive || fgEventStartTime == 0.) return;
+
+  G4double time = Now() - fgEventStartTime;
+  fgEventStartTime = 0.;
+
+  G4AutoLock lm(&profilerMutex);
+  Add(fgInstance->fEventStats[G4Threading::G4GetThreadId()], time);
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4MTProfiler::Print() const
+{
+  /// Print the accumulated profiling data
+
+  G4AutoLock lm(&profilerMutex);
+
+  G4cout << "### MT profile (accumulated since activation)" << G4endl;
+
+  for (const auto& it : fEventStats) {
+    G4cout << "MTProfile thread " << it.first << " events " << it.second.fCount
+           << " eventTime " << it.second.fTime << " maxEventTime "
+           << it.second.fMaxTime << G4endl;
+  }
+
+  for (const auto& it : fLockStats) {
+    G4cout << "MTProfile lock " << it.first << " count " << it.second.fCount
+           << " waitTime " << it.second.fTime << " maxWaitTime "
+           << it.second.fMaxTime << G4endl;
+  }
+
+  for (const auto& it : fPhaseStats) {
+    G4cout << "MTProfile phase " << it.first << " count " << it.second.fCount
+           << " time " << it.second.fTime << " maxTime " << it.second.fMaxTime
+           << G4endl;
+  }
+}
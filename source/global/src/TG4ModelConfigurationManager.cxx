@@ -16,6 +16,7 @@
 #include "TG4G3ControlVector.h"
 #include "TG4GeometryServices.h"
 #include "TG4Limits.h"
+#include "TG4MTProfiler.h"
 #include "TG4Medium.h"
 #include "TG4MediumMap.h"
 #include "TG4ModelConfiguration.h"
@@ -85,7 +86,8 @@ void TG4ModelConfigurationManager::SetRegionsNames()
   /// defined with special cuts, which are defined per materiials.
 
 #ifdef G4MULTITHREADED
-  G4AutoLock lm(&setRegionsNamesMutex);
+  G4AutoLock lm(&setRegionsNamesMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "ModelConfigurationManager::SetRegionsNames");
 #endif
   TG4MediumMap* mediumMap = TG4GeometryServices::Instance()->GetMediumMap();
 
@@ -167,7 +169,8 @@ void TG4ModelConfigurationManager::CreateRegions()
   SetRegionsNames();
 
 #ifdef G4MULTITHREADED
-  G4AutoLock lm(&createRegionsMutex);
+  G4AutoLock lm(&createRegionsMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "ModelConfigurationManager::CreateRegions");
   if (!fCreateRegionsDone) {
 #endif
     // Loop over logical volumes
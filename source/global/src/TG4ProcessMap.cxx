@@ -15,6 +15,7 @@
 #include "TG4ProcessMap.h"
 #include "TG4G3PhysicsManager.h"
 #include "TG4Globals.h"
+#include "TG4MemorySize.h"
 
 #include <G4VProcess.hh>
 
@@ -161,3 +162,10 @@ G4String TG4ProcessMap::GetControlName(const G4VProcess* process) const
   return TG4G3ControlVector::GetControlName(GetControl(process));
 }
 
+//_____________________________________________________________________________
+std::size_t TG4ProcessMap::GetMemorySize() const
+{
+  /// Return the estimated memory (in bytes) of the map container
+
+  return TG4MemorySize::Of(fMap);
+}
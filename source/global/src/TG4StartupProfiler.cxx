@@ -0,0 +1,255 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4StartupProfiler.cxx
+/// \brief Implementation of the TG4StartupProfiler class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4StartupProfiler.h"
+#include "TG4Globals.h"
+
+#include <G4AutoLock.hh>
+#include <G4Threading.hh>
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace
+{
+// Mutex to lock updating the profiling data
+G4Mutex startupProfilerMutex = G4MUTEX_INITIALIZER;
+} // namespace
+
+// static data members
+TG4StartupProfiler* TG4StartupProfiler::fgInstance = 0;
+
+//_____________________________________________________________________________
+TG4StartupProfiler::TG4StartupProfiler()
+  : fIsPrint(false),
+    fFileName(),
+    fStacks(),
+    fRecords()
+{
+  /// Default constructor
+
+  if (fgInstance) {
+    TG4Globals::Exception("TG4StartupProfiler", "TG4StartupProfiler",
+      "Cannot create two instances of singleton.");
+  }
+
+  fgInstance = this;
+}
+
+//_____________________________________________________________________________
+TG4StartupProfiler::~TG4StartupProfiler()
+{
+  /// Destructor
+
+  fgInstance = 0;
+}
+
+//
+// private static methods
+//
+
+//_____________________________________________________________________________
+G4double TG4StartupProfiler::Now()
+{
+  /// Return the current time (s) of the monotonic clock
+
+  return std::chrono::duration<G4double>(
+    std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+//_____________________________________________________________________________
+G4long TG4StartupProfiler::CurrentRss()
+{
+  /// Return the current resident set size of the process (kB);
+  /// the peak resident set size is used where the current one
+  /// is not available (/proc is not mounted)
+
+  std::ifstream statm("/proc/self/statm");
+  G4long size = 0;
+  G4long resident = 0;
+  if (statm >> size >> resident) {
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+  }
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+//_____________________________________________________________________________
+G4String TG4StartupProfiler::ThreadName(G4int threadId)
+{
+  /// Return the thread name for printing
+
+  if (threadId < 0) return "master";
+
+  G4String name = "worker";
+  TG4Globals::AppendNumberToString(name, threadId);
+  return name;
+}
+
+//
+// public static methods
+//
+
+//_____________________________________________________________________________
+void TG4StartupProfiler::StartPhase(const G4String& name)
+{
+  /// Start the phase with the given name in this thread
+
+  if (!fgInstance) return;
+
+  Frame frame{name, Now(), CurrentRss()};
+
+  G4AutoLock lm(&startupProfilerMutex);
+  fgInstance->fStacks[G4Threading::G4GetThreadId()].push_back(frame);
+}
+
+//_____________________________________________________________________________
+void TG4StartupProfiler::StopPhase(const G4String& name)
+{
+  /// Stop the phase with the given name in this thread and record its time
+  /// and RSS change. Nothing is done if the given phase is not the last
+  /// started one (eg. when it was not started in this thread).
+
+  if (!fgInstance) return;
+
+  G4double time = Now();
+  G4long rss = CurrentRss();
+  G4int threadId = G4Threading::G4GetThreadId();
+
+  G4AutoLock lm(&startupProfilerMutex);
+  std::vector<Frame>& stack = fgInstance->fStacks[threadId];
+  if (stack.empty() || stack.back().fName != name) return;
+
+  // Compose the phase path
+  G4String path;
+  for (const auto& frame : stack) {
+    if (path.size()) path += "/";
+    path += frame.fName;
+  }
+
+  // Find or add the record
+  std::vector<Record>& records = fgInstance->fRecords[threadId];
+  Record* record = 0;
+  for (auto& it : records) {
+    if (it.fPath == path) {
+      record = &it;
+      break;
+    }
+  }
+  if (!record) {
+    records.push_back(Record());
+    record = &records.back();
+    record->fPath = path;
+    record->fDepth = G4int(stack.size()) - 1;
+  }
+
+  ++record->fCount;
+  record->fTime += time - stack.back().fStartTime;
+  record->fRssDelta += rss - stack.back().fStartRss;
+
+  stack.pop_back();
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4StartupProfiler::Print() const
+{
+  /// Print the accumulated phase data as a hierarchical report
+
+  G4AutoLock lm(&startupProfilerMutex);
+
+  G4cout << "### Startup profile (time [s], RSS change [kB])" << G4endl;
+
+  for (const auto& it : fRecords) {
+    G4cout << ThreadName(it.first) << G4endl;
+    for (const auto& record : it.second) {
+      G4String name = record.fPath;
+      std::size_t pos = name.rfind('/');
+      if (pos != std::string::npos) name = name.substr(pos + 1);
+      G4String indented(2 * (record.fDepth + 1), ' ');
+      indented += name;
+      G4cout << std::left << std::setw(40) << indented << std::right
+             << " count " << std::setw(4) << record.fCount << " time "
+             << std::fixed << std::setprecision(3) << std::setw(10)
+             << record.fTime << " rss " << std::showpos << std::setw(10)
+             << record.fRssDelta << std::noshowpos << G4endl;
+    }
+  }
+  G4cout.unsetf(std::ios::fixed);
+  G4cout << std::setprecision(6);
+}
+
+//_____________________________________________________________________________
+void TG4StartupProfiler::WriteJson(const G4String& fileName) const
+{
+  /// Write the accumulated phase data in the JSON file with the given name;
+  /// each thread is written with the flat list of its phases, where
+  /// the hierarchy is given by the phase path.
+
+  std::ofstream out(fileName);
+  if (!out) {
+    TG4Globals::Warning("TG4StartupProfiler", "WriteJson",
+      "Cannot open file " + TString(fileName.data()));
+    return;
+  }
+
+  G4AutoLock lm(&startupProfilerMutex);
+
+  out << "{\n  \"threads\": [";
+  G4bool firstThread = true;
+  for (const auto& it : fRecords) {
+    out << (firstThread ? "\n" : ",\n") << "    {\n      \"thread\": \""
+        << ThreadName(it.first) << "\",\n      \"phases\": [";
+    firstThread = false;
+    G4bool firstRecord = true;
+    for (const auto& record : it.second) {
+      out << (firstRecord ? "\n" : ",\n") << "        { \"path\": \""
+          << record.fPath << "\", \"depth\": " << record.fDepth
+          << ", \"count\": " << record.fCount << ", \"time\": " << record.fTime
+          << ", \"rssDeltaKB\": " << record.fRssDelta << " }";
+      firstRecord = false;
+    }
+    out << "\n      ]\n    }";
+  }
+  out << "\n  ]\n}\n";
+}
+
+//_____________________________________________________________________________
+void TG4StartupProfiler::Report() const
+{
+  /// Print the profile and write it in the JSON file if activated
+
+  if (fIsPrint) Print();
+
+  if (fFileName.size()) {
+    WriteJson(fFileName);
+    if (fIsPrint) {
+      G4cout << "### Startup profile written in " << fFileName << G4endl;
+    }
+  }
+}
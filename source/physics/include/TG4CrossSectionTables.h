@@ -0,0 +1,144 @@
+#ifndef TG4_CROSS_SECTION_TABLES_H
+#define TG4_CROSS_SECTION_TABLES_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4CrossSectionTables.h
+/// \brief Definition of the TG4CrossSectionTables class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4CrossSectionTablesMessenger.h"
+#include "TG4Verbose.h"
+
+#include <globals.hh>
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+class G4Material;
+class G4ParticleDefinition;
+class G4VProcess;
+
+/// \ingroup physics
+/// \brief The per-thread tables of the cross sections per volume
+///        used to implement TVirtualMC::Xsec()
+///
+/// The table for a (reaction, particle, material) is built at its first
+/// query: the cross sections per volume are calculated at the bin edges
+/// in log10(kinetic energy) with G4EmCalculator (electromagnetic
+/// processes) or G4HadronicProcessStore (hadronic processes) and the
+/// queries are then answered with a linear interpolation in log10(E).
+///
+/// The reaction is matched with the particle processes via the process
+/// name or, via TG4ProcessMap, the G3 control name (eg. "PHOT", "HADR")
+/// or the TMCProcess name; the cross sections of all matching processes
+/// are summed.
+///
+/// The tables can be exported in a text file and imported in another job,
+/// where they replace building the tables for the same (reaction, particle,
+/// material) (see TG4CrossSectionTablesMessenger).
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4CrossSectionTables : public TG4Verbose
+{
+ public:
+  TG4CrossSectionTables();
+  virtual ~TG4CrossSectionTables();
+
+  // static access method
+  static TG4CrossSectionTables* Instance();
+
+  // methods
+  G4double GetCrossSection(const G4String& reaction, G4double kinEnergy,
+    const G4ParticleDefinition* particle, const G4Material* material);
+  G4bool Export(const G4String& fileName) const;
+  G4bool Import(const G4String& fileName);
+  void Clear();
+
+  // set methods
+  void SetNofBinsPerDecade(G4int nofBinsPerDecade);
+  void SetMinKinEnergy(G4double minKinEnergy);
+  void SetMaxKinEnergy(G4double maxKinEnergy);
+
+ private:
+  /// The table key (reaction, particle, material)
+  using Key = std::tuple<G4String, const G4ParticleDefinition*,
+    const G4Material*>;
+
+  /// The cross section table
+  struct Table
+  {
+    G4double fLogEmin = 0.;        ///< log10 of the minimum energy (MeV)
+    G4double fDLogE = 0.;          ///< the bin width in log10(E/MeV)
+    std::vector<G4double> fValues; ///< the values at the bins edges (1/mm)
+  };
+
+  /// Not implemented
+  TG4CrossSectionTables(const TG4CrossSectionTables& right);
+  /// Not implemented
+  TG4CrossSectionTables& operator=(const TG4CrossSectionTables& right);
+
+  // methods
+  std::vector<const G4VProcess*> GetProcesses(
+    const G4String& reaction, const G4ParticleDefinition* particle) const;
+  G4double ComputeCrossSection(const G4VProcess* process, G4double kinEnergy,
+    const G4ParticleDefinition* particle, const G4Material* material) const;
+  const Table& BuildTable(const Key& key);
+
+  // static data members
+  /// this instance
+  static G4ThreadLocal TG4CrossSectionTables* fgInstance;
+  /// default number of bins per decade
+  static const G4int fgkDefaultNofBinsPerDecade;
+  /// default minimum kinetic energy
+  static const G4double fgkDefaultMinKinEnergy;
+  /// default maximum kinetic energy
+  static const G4double fgkDefaultMaxKinEnergy;
+
+  // data members
+  TG4CrossSectionTablesMessenger fMessenger; ///< messenger
+  G4int fNofBinsPerDecade;  ///< the number of bins per decade
+  G4double fMinKinEnergy;   ///< the minimum kinetic energy
+  G4double fMaxKinEnergy;   ///< the maximum kinetic energy
+  std::map<Key, Table> fTables; ///< the tables
+  const Table* fLastTable;  ///< the table of the last query
+  Key fLastKey;             ///< the key of the last query
+};
+
+// inline functions
+
+inline TG4CrossSectionTables* TG4CrossSectionTables::Instance()
+{
+  /// Return this instance
+  return fgInstance;
+}
+
+inline void TG4CrossSectionTables::SetNofBinsPerDecade(G4int nofBinsPerDecade)
+{
+  /// Set the number of bins per decade for the new tables
+  fNofBinsPerDecade = nofBinsPerDecade;
+}
+
+inline void TG4CrossSectionTables::SetMinKinEnergy(G4double minKinEnergy)
+{
+  /// Set the minimum kinetic energy for the new tables
+  fMinKinEnergy = minKinEnergy;
+}
+
+inline void TG4CrossSectionTables::SetMaxKinEnergy(G4double maxKinEnergy)
+{
+  /// Set the maximum kinetic energy for the new tables
+  fMaxKinEnergy = maxKinEnergy;
+}
+
+#endif // TG4_CROSS_SECTION_TABLES_H
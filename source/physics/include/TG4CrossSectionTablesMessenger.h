@@ -0,0 +1,89 @@
+#ifndef TG4_CROSS_SECTION_TABLES_MESSENGER_H
+#define TG4_CROSS_SECTION_TABLES_MESSENGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4CrossSectionTablesMessenger.h
+/// \brief Definition of the TG4CrossSectionTablesMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class TG4CrossSectionTables;
+
+class G4UIdirectory;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithoutParameter;
+
+/// \ingroup physics
+/// \brief Messenger class that defines commands for the cross section
+///        tables
+///
+/// Implements commands:
+/// - /mcXsecTables/setNofBinsPerDecade value
+/// - /mcXsecTables/setMinKinE value unit
+/// - /mcXsecTables/setMaxKinE value unit
+/// - /mcXsecTables/export fileName
+/// - /mcXsecTables/import fileName
+/// - /mcXsecTables/clear
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4CrossSectionTablesMessenger : public G4UImessenger
+{
+ public:
+  TG4CrossSectionTablesMessenger(TG4CrossSectionTables* crossSectionTables);
+  virtual ~TG4CrossSectionTablesMessenger();
+
+  // methods
+  virtual void SetNewValue(G4UIcommand* command, G4String string);
+
+ private:
+  /// Not implemented
+  TG4CrossSectionTablesMessenger();
+  /// Not implemented
+  TG4CrossSectionTablesMessenger(const TG4CrossSectionTablesMessenger& right);
+  /// Not implemented
+  TG4CrossSectionTablesMessenger& operator=(
+    const TG4CrossSectionTablesMessenger& right);
+
+  //
+  // data members
+
+  /// associated class
+  TG4CrossSectionTables* fCrossSectionTables;
+
+  /// command directory
+  G4UIdirectory* fDirectory;
+
+  /// setNofBinsPerDecade command
+  G4UIcmdWithAnInteger* fNofBinsPerDecadeCmd;
+
+  /// setMinKinE command
+  G4UIcmdWithADoubleAndUnit* fMinKinECmd;
+
+  /// setMaxKinE command
+  G4UIcmdWithADoubleAndUnit* fMaxKinECmd;
+
+  /// export command
+  G4UIcmdWithAString* fExportCmd;
+
+  /// import command
+  G4UIcmdWithAString* fImportCmd;
+
+  /// clear command
+  G4UIcmdWithoutParameter* fClearCmd;
+};
+
+#endif // TG4_CROSS_SECTION_TABLES_MESSENGER_H
@@ -20,13 +20,18 @@
 #include "G4VExtDecayer.hh"
 #include "globals.hh"
 
+#include <unordered_map>
+
 class TVirtualMCDecayer;
 class TG4ParticlesManager;
+class TG4SpecialStackingAction;
 
 class G4Track;
 class G4DecayProducts;
+class G4ParticleDefinition;
 
 class TClonesArray;
+class TParticle;
 
 /// \ingroup physics
 /// \brief Implements the G4VExtDecayer abstract class
@@ -36,6 +41,19 @@ class TClonesArray;
 /// and has not pre-assigned decay products,
 /// the external decayer is called.
 ///
+/// The decay products are imported via the TClonesArray, allocated once
+/// per decayer (and so per thread), as TVirtualMCDecayer does not provide
+/// other output; the G4 particle definitions are cached per PDG encoding.
+/// The neutrinos are not imported when the skip neutrino option is set
+/// for this decayer or in TG4SpecialStackingAction, which would kill them;
+/// the latter applies only when the tracks are saved in pre-track, as with
+/// saving in step the secondaries are saved in the VMC stack before
+/// stacking.
+///
+/// The number of decays and products and the time spent in the external
+/// decayer and in the products import are accumulated per run and printed
+/// at the end of run with the verbose level > 0.
+///
 /// \author I. Hrivnacova; IPN Orsay
 
 class TG4ExtDecayer : public G4VExtDecayer, public TG4Verbose
@@ -44,8 +62,15 @@ class TG4ExtDecayer : public G4VExtDecayer, public TG4Verbose
   TG4ExtDecayer(TVirtualMCDecayer* externalDecayer);
   virtual ~TG4ExtDecayer();
 
+  // static access method
+  static TG4ExtDecayer* Instance();
+
   virtual G4DecayProducts* ImportDecayProducts(const G4Track& track);
 
+  // methods
+  void PrintStatistics() const;
+  void ResetStatistics();
+
   // set methods
   void SetSkipNeutrino(G4bool skipNeutrino);
 
@@ -55,14 +80,44 @@ class TG4ExtDecayer : public G4VExtDecayer, public TG4Verbose
   /// Not implemented
   TG4ExtDecayer& operator=(const TG4ExtDecayer& right);
 
+  // methods
+  G4ParticleDefinition* GetParticleDefinition(const TParticle* particle);
+  G4bool IsSkipNeutrino();
+
+  // static data members
+  static G4ThreadLocal TG4ExtDecayer* fgInstance; ///< this instance
+
+  // data members
   TG4ParticlesManager* fParticlesManager; ///< particles manager
   TVirtualMCDecayer* fExternalDecayer;    ///< the external decayer
   TClonesArray* fDecayProductsArray;      ///< array of decay products
   G4bool fSkipNeutrino; ///< option to skip importing neutrinos
+
+  /// The cache of G4 particle definitions per PDG encoding
+  std::unordered_map<G4int, G4ParticleDefinition*> fParticleDefinitions;
+
+  /// The special stacking action (if it is used)
+  TG4SpecialStackingAction* fSpecialStackingAction;
+
+  /// Info whether the stacking action was already checked
+  G4bool fIsStackingActionChecked;
+
+  // statistics
+  G4long fNofDecays;          ///< number of external decays
+  G4long fNofProducts;        ///< number of imported products
+  G4long fNofSkippedProducts; ///< number of skipped final products
+  G4double fDecayTime;        ///< time in the external decayer (s)
+  G4double fImportTime;       ///< time of the products import (s)
 };
 
 // inline functions
 
+inline TG4ExtDecayer* TG4ExtDecayer::Instance()
+{
+  /// Return this instance
+  return fgInstance;
+}
+
 inline void TG4ExtDecayer::SetSkipNeutrino(G4bool skipNeutrino)
 {
   /// Set option to skip importing neutrinos
@@ -0,0 +1,123 @@
+#ifndef TG4_OPTICAL_YIELD_CONTROL_H
+#define TG4_OPTICAL_YIELD_CONTROL_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4OpticalYieldControl.h
+/// \brief Definition of the TG4OpticalYieldControl class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4OpticalYieldControlMessenger.h"
+#include "TG4Verbose.h"
+
+#include <globals.hh>
+
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+class G4Cerenkov;
+class G4LogicalVolume;
+class G4Scintillation;
+class G4Step;
+class G4VPhysicalVolume;
+
+/// \ingroup physics
+/// \brief The photon-yield-only mode of the Cerenkov and scintillation
+///        processes in the selected media
+///
+/// In the media selected with /mcPhysics/opticalYield/addMedium the
+/// Cerenkov and scintillation processes compute the number of produced
+/// optical photons, but the photons are not created as secondary tracks.
+/// The numbers of photons produced in the current step are available
+/// via TG4StepManager::OpticalPhotonYield() in the user stepping or
+/// sensitive detector code; the emission point and time are given by
+/// the step points and the spectrum by the medium optical properties.
+///
+/// The photons stacking of the Geant4 processes (defined per process)
+/// is switched when a track starts and when it enters a volume with
+/// another medium.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4OpticalYieldControl : public TG4Verbose
+{
+ public:
+  TG4OpticalYieldControl();
+  ~TG4OpticalYieldControl();
+
+  // static access method
+  static TG4OpticalYieldControl* Instance();
+
+  // methods
+  void LateInitialize();
+  void UpdateStacking(const G4VPhysicalVolume* volume);
+  void GetNofPhotons(const G4Step* step, G4int& nofCerenkovPhotons,
+    G4int& nofScintillationPhotons) const;
+
+  // set methods
+  void AddMedium(const G4String& mediumName);
+  void SetMediumNames(const std::set<G4String>& mediumNames);
+
+  // get methods
+  G4bool IsActive() const;
+  const std::set<G4String>& GetMediumNames() const;
+
+ private:
+  /// Not implemented
+  TG4OpticalYieldControl(const TG4OpticalYieldControl& right);
+  /// Not implemented
+  TG4OpticalYieldControl& operator=(const TG4OpticalYieldControl& right);
+
+  // methods
+  G4bool IsYieldOnly(const G4LogicalVolume* volume);
+
+  // static data members
+  /// this instance
+  static G4ThreadLocal TG4OpticalYieldControl* fgInstance;
+
+  // data members
+  /// Messenger
+  TG4OpticalYieldControlMessenger fMessenger;
+  /// The names of the media with the photon-yield-only mode
+  std::set<G4String> fMediumNames;
+  /// The Cerenkov processes in this thread
+  std::vector<G4Cerenkov*> fCerenkovProcesses;
+  /// The scintillation processes in this thread
+  std::vector<G4Scintillation*> fScintillationProcesses;
+  /// The cached info whether the volume medium is in yield-only mode
+  std::unordered_map<const G4LogicalVolume*, G4bool> fVolumes;
+  /// The current stacking of photons in the processes
+  G4bool fIsStacking;
+};
+
+// inline functions
+
+inline TG4OpticalYieldControl* TG4OpticalYieldControl::Instance()
+{
+  /// Return this instance
+  return fgInstance;
+}
+
+inline G4bool TG4OpticalYieldControl::IsActive() const
+{
+  /// Return true if the photon-yield-only mode is selected for any medium
+  return !fMediumNames.empty();
+}
+
+inline const std::set<G4String>& TG4OpticalYieldControl::GetMediumNames()
+  const
+{
+  /// Return the names of the media with the photon-yield-only mode
+  return fMediumNames;
+}
+
+#endif // TG4_OPTICAL_YIELD_CONTROL_H
@@ -0,0 +1,67 @@
+#ifndef TG4_OPTICAL_YIELD_CONTROL_MESSENGER_H
+#define TG4_OPTICAL_YIELD_CONTROL_MESSENGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4OpticalYieldControlMessenger.h
+/// \brief Definition of the TG4OpticalYieldControlMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class TG4OpticalYieldControl;
+
+class G4UIdirectory;
+class G4UIcmdWithAString;
+
+/// \ingroup physics
+/// \brief Messenger class that defines commands for the photon-yield-only
+///        mode of the Cerenkov and scintillation processes
+///
+/// Implements commands:
+/// - /mcPhysics/opticalYield/addMedium mediumName
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4OpticalYieldControlMessenger : public G4UImessenger
+{
+ public:
+  TG4OpticalYieldControlMessenger(TG4OpticalYieldControl* yieldControl);
+  virtual ~TG4OpticalYieldControlMessenger();
+
+  // methods
+  virtual void SetNewValue(G4UIcommand* command, G4String string);
+
+ private:
+  /// Not implemented
+  TG4OpticalYieldControlMessenger();
+  /// Not implemented
+  TG4OpticalYieldControlMessenger(
+    const TG4OpticalYieldControlMessenger& right);
+  /// Not implemented
+  TG4OpticalYieldControlMessenger& operator=(
+    const TG4OpticalYieldControlMessenger& right);
+
+  //
+  // data members
+
+  /// associated class
+  TG4OpticalYieldControl* fYieldControl;
+
+  /// command directory
+  G4UIdirectory* fDirectory;
+
+  /// addMedium command
+  G4UIcmdWithAString* fAddMediumCmd;
+};
+
+#endif // TG4_OPTICAL_YIELD_CONTROL_MESSENGER_H
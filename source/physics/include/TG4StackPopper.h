@@ -35,6 +35,14 @@ enum TG4StackPopperProcessType
 /// \brief The process which pops particles defined by user from
 ///        the VMC stack and passes them to tracking
 ///
+/// All tracks pending in the VMC stack are popped and added as secondaries
+/// in one step; the number of tracks popped per step can be limited with
+/// SetMaxNofPopsPerStep(), the remaining tracks are then popped in the
+/// next steps of the current track (all tracks are popped in the exclusive
+/// step performed when the current track is not alive anymore).
+/// The number of invocations and popped tracks are accumulated per run
+/// and printed at the end of run with the process verbose level > 0.
+///
 /// \author I. Hrivnacova; IPN Orsay
 
 class TG4StackPopper : public G4VProcess
@@ -88,6 +96,9 @@ class TG4StackPopper : public G4VProcess
   void Reset();
   void SetMCStack(TVirtualMCStack* mcStack);
   void SetDoExclusiveStep(G4TrackStatus trackStatus);
+  void SetMaxNofPopsPerStep(G4int maxNofPops);
+  void PrintStatistics() const;
+  void ResetStatistics();
 
   G4bool HasPoppedTracks() const;
 
@@ -114,6 +125,18 @@ class TG4StackPopper : public G4VProcess
 
   /// The track status to be restored after performing exclusive step
   G4TrackStatus fTrackStatus;
+
+  /// The maximum number of tracks popped in one step (0 = no limit)
+  G4int fMaxNofPopsPerStep;
+
+  /// The number of invocations of PostStepDoIt() with popped tracks
+  G4long fNofInvocations;
+
+  /// The number of popped tracks
+  G4long fNofPoppedTracks;
+
+  /// The maximum number of tracks popped in one invocation
+  G4int fMaxNofPoppedTracks;
 };
 
 // inline methods
@@ -137,4 +160,10 @@ inline void TG4StackPopper::SetMCStack(TVirtualMCStack* mcStack)
   fMCStack = mcStack;
 }
 
+inline void TG4StackPopper::SetMaxNofPopsPerStep(G4int maxNofPops)
+{
+  /// Set the maximum number of tracks popped in one step (0 = no limit)
+  fMaxNofPopsPerStep = maxNofPops;
+}
+
 #endif // TG4_STACK_POPPER_H
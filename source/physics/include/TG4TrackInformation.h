@@ -42,6 +42,10 @@ class TG4TrackInformation : public G4VUserTrackInformation
   /// Override \em delete operator for G4Allocator
   inline void operator delete(void* trackInformation);
 
+  // static methods
+  static G4int GetNofInstances();
+  static std::size_t GetAllocatedSize();
+
   // methods
   virtual void Print() const;
 
@@ -66,6 +70,11 @@ class TG4TrackInformation : public G4VUserTrackInformation
   G4bool IsInterrupt() const;
 
  private:
+  // static data members
+
+  /// the number of existing objects in this thread
+  static G4ThreadLocal G4int fgCounter;
+
   // data members
 
   G4int fTrackParticleID;  ///< the index of track particle in VMC stack
@@ -0,0 +1,315 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4CrossSectionTables.cxx
+/// \brief Implementation of the TG4CrossSectionTables class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4CrossSectionTables.h"
+#include "TG4Globals.h"
+#include "TG4ProcessMap.h"
+
+#include <G4EmCalculator.hh>
+#include <G4HadronicProcessStore.hh>
+#include <G4Material.hh>
+#include <G4ParticleDefinition.hh>
+#include <G4ParticleTable.hh>
+#include <G4ProcessManager.hh>
+#include <G4ProcessVector.hh>
+#include <G4SystemOfUnits.hh>
+#include <G4VProcess.hh>
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// static data members
+G4ThreadLocal TG4CrossSectionTables* TG4CrossSectionTables::fgInstance = 0;
+const G4int TG4CrossSectionTables::fgkDefaultNofBinsPerDecade = 20;
+const G4double TG4CrossSectionTables::fgkDefaultMinKinEnergy = 1. * keV;
+const G4double TG4CrossSectionTables::fgkDefaultMaxKinEnergy = 100. * TeV;
+
+//_____________________________________________________________________________
+TG4CrossSectionTables::TG4CrossSectionTables()
+  : TG4Verbose("crossSectionTables"),
+    fMessenger(this),
+    fNofBinsPerDecade(fgkDefaultNofBinsPerDecade),
+    fMinKinEnergy(fgkDefaultMinKinEnergy),
+    fMaxKinEnergy(fgkDefaultMaxKinEnergy),
+    fTables(),
+    fLastTable(0),
+    fLastKey()
+{
+  /// Default constructor
+
+  if (fgInstance) {
+    TG4Globals::Exception("TG4CrossSectionTables", "TG4CrossSectionTables",
+      "Cannot create two instances of singleton.");
+  }
+
+  fgInstance = this;
+}
+
+//_____________________________________________________________________________
+TG4CrossSectionTables::~TG4CrossSectionTables()
+{
+  /// Destructor
+
+  fgInstance = 0;
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+std::vector<const G4VProcess*> TG4CrossSectionTables::GetProcesses(
+  const G4String& reaction, const G4ParticleDefinition* particle) const
+{
+  /// Return the particle processes matching the given reaction name
+  /// (the process name, G3 control name or TMCProcess name)
+
+  std::vector<const G4VProcess*> processes;
+
+  G4ProcessManager* processManager = particle->GetProcessManager();
+  if (!processManager) return processes;
+
+  G4ProcessVector* processVector = processManager->GetProcessList();
+  auto processMap = TG4ProcessMap::Instance();
+
+  // the process name has priority
+  for (std::size_t i = 0; i < processVector->length(); ++i) {
+    if ((*processVector)[i]->GetProcessName() == reaction) {
+      processes.push_back((*processVector)[i]);
+      return processes;
+    }
+  }
+
+  if (!processMap) return processes;
+
+  for (std::size_t i = 0; i < processVector->length(); ++i) {
+    const G4VProcess* process = (*processVector)[i];
+    if (processMap->GetControlName(process) == reaction ||
+        processMap->GetMCProcessName(process) == reaction) {
+      processes.push_back(process);
+    }
+  }
+
+  return processes;
+}
+
+//_____________________________________________________________________________
+G4double TG4CrossSectionTables::ComputeCrossSection(const G4VProcess* process,
+  G4double kinEnergy, const G4ParticleDefinition* particle,
+  const G4Material* material) const
+{
+  /// Return the cross section per volume (in G4 units) of the given process
+
+  if (process->GetProcessType() == fHadronic) {
+    return G4HadronicProcessStore::Instance()->GetCrossSectionPerVolume(
+      particle, kinEnergy, process, material);
+  }
+
+  if (process->GetProcessType() == fElectromagnetic) {
+    G4EmCalculator emCalculator;
+    return emCalculator.GetCrossSectionPerVolume(
+      kinEnergy, particle, process->GetProcessName(), material);
+  }
+
+  return 0.;
+}
+
+//_____________________________________________________________________________
+const TG4CrossSectionTables::Table& TG4CrossSectionTables::BuildTable(
+  const Key& key)
+{
+  /// Build the table for the given key
+
+  const G4String& reaction = std::get<0>(key);
+  const G4ParticleDefinition* particle = std::get<1>(key);
+  const G4Material* material = std::get<2>(key);
+
+  Table& table = fTables[key];
+  std::vector<const G4VProcess*> processes = GetProcesses(reaction, particle);
+
+  if (processes.empty()) {
+    // keep the empty table to avoid searching again
+    TG4Globals::Warning("TG4CrossSectionTables", "BuildTable",
+      "No process matching reaction " + TString(reaction.data()) +
+        " for " + TString(particle->GetParticleName().data()) +
+        ", the cross section is set to 0.");
+    return table;
+  }
+
+  G4double logEmin = std::log10(fMinKinEnergy / MeV);
+  G4double logEmax = std::log10(fMaxKinEnergy / MeV);
+  G4int nofBins = G4int(std::ceil((logEmax - logEmin) * fNofBinsPerDecade));
+  if (nofBins < 1) nofBins = 1;
+
+  table.fLogEmin = logEmin;
+  table.fDLogE = (logEmax - logEmin) / nofBins;
+  table.fValues.resize(nofBins + 1);
+  for (G4int i = 0; i <= nofBins; ++i) {
+    G4double kinEnergy = std::pow(10., logEmin + i * table.fDLogE) * MeV;
+    G4double value = 0.;
+    for (auto process : processes) {
+      value += ComputeCrossSection(process, kinEnergy, particle, material);
+    }
+    table.fValues[i] = value;
+  }
+
+  if (VerboseLevel() > 0) {
+    G4cout << "Built cross section table for " << reaction << " "
+           << particle->GetParticleName() << " in " << material->GetName()
+           << " with " << nofBins << " bins" << G4endl;
+  }
+
+  return table;
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+G4double TG4CrossSectionTables::GetCrossSection(const G4String& reaction,
+  G4double kinEnergy, const G4ParticleDefinition* particle,
+  const G4Material* material)
+{
+  /// Return the cross section per volume (in G4 units) for the given
+  /// reaction, particle kinetic energy and material; the energy is
+  /// limited to the tables range
+
+  if (!particle || !material) return 0.;
+
+  Key key(reaction, particle, material);
+  if (!fLastTable || key != fLastKey) {
+    auto it = fTables.find(key);
+    fLastTable = (it != fTables.end()) ? &it->second : &BuildTable(key);
+    fLastKey = key;
+  }
+
+  const std::vector<G4double>& values = fLastTable->fValues;
+  if (values.empty()) return 0.;
+
+  G4double x = (std::log10(kinEnergy / MeV) - fLastTable->fLogEmin) /
+               fLastTable->fDLogE;
+  if (x <= 0.) return values.front();
+
+  std::size_t bin = std::size_t(x);
+  if (bin >= values.size() - 1) return values.back();
+
+  G4double fraction = x - bin;
+  return values[bin] + fraction * (values[bin + 1] - values[bin]);
+}
+
+//_____________________________________________________________________________
+G4bool TG4CrossSectionTables::Export(const G4String& fileName) const
+{
+  /// Write all tables in the file with the given name; each table starts
+  /// with the line:
+  /// table nofValues log10(Emin/MeV) dLog10E reaction particle material
+  /// followed by the values (in 1/mm)
+
+  std::ofstream file(fileName);
+  if (!file) {
+    TG4Globals::Warning("TG4CrossSectionTables", "Export",
+      "Cannot open file " + TString(fileName.data()));
+    return false;
+  }
+
+  file << "# TG4CrossSectionTables" << std::endl;
+  file << std::setprecision(10);
+  for (const auto& it : fTables) {
+    const Table& table = it.second;
+    if (table.fValues.empty()) continue;
+
+    file << "table " << table.fValues.size() << " " << table.fLogEmin << " "
+         << table.fDLogE << " " << std::get<0>(it.first) << " "
+         << std::get<1>(it.first)->GetParticleName() << " "
+         << std::get<2>(it.first)->GetName() << std::endl;
+    for (auto value : table.fValues) {
+      file << value << std::endl;
+    }
+  }
+
+  if (VerboseLevel() > 0) {
+    G4cout << "Exported " << fTables.size() << " cross section tables in "
+           << fileName << G4endl;
+  }
+
+  return true;
+}
+
+//_____________________________________________________________________________
+G4bool TG4CrossSectionTables::Import(const G4String& fileName)
+{
+  /// Read the tables from the file with the given name written with
+  /// Export(); the tables for unknown particles or materials are skipped
+
+  std::ifstream file(fileName);
+  if (!file) {
+    TG4Globals::Warning("TG4CrossSectionTables", "Import",
+      "Cannot open file " + TString(fileName.data()));
+    return false;
+  }
+
+  G4int nofTables = 0;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.compare(0, 6, "table ") != 0) continue;
+
+    std::istringstream input(line.substr(6));
+    std::size_t nofValues;
+    G4String reaction, particleName, materialName;
+    Table table;
+    input >> nofValues >> table.fLogEmin >> table.fDLogE >> reaction >>
+      particleName >> std::ws;
+    std::getline(input, materialName);
+
+    table.fValues.resize(nofValues);
+    for (auto& value : table.fValues) {
+      file >> value;
+    }
+
+    auto particle = G4ParticleTable::GetParticleTable()->FindParticle(
+      particleName);
+    auto material = G4Material::GetMaterial(materialName, false);
+    if (!file || !particle || !material) {
+      if (VerboseLevel() > 0) {
+        G4cout << "Skipped cross section table for " << reaction << " "
+               << particleName << " in " << materialName << G4endl;
+      }
+      file.clear();
+      continue;
+    }
+
+    fTables[Key(reaction, particle, material)] = table;
+    ++nofTables;
+  }
+  fLastTable = 0;
+
+  if (VerboseLevel() > 0) {
+    G4cout << "Imported " << nofTables << " cross section tables from "
+           << fileName << G4endl;
+  }
+
+  return true;
+}
+
+//_____________________________________________________________________________
+void TG4CrossSectionTables::Clear()
+{
+  /// Clear all tables
+
+  fTables.clear();
+  fLastTable = 0;
+}
@@ -0,0 +1,132 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4CrossSectionTablesMessenger.cxx
+/// \brief Implementation of the TG4CrossSectionTablesMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4CrossSectionTablesMessenger.h"
+#include "TG4CrossSectionTables.h"
+
+#include <G4UIcmdWithADoubleAndUnit.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIdirectory.hh>
+
+//_____________________________________________________________________________
+TG4CrossSectionTablesMessenger::TG4CrossSectionTablesMessenger(
+  TG4CrossSectionTables* crossSectionTables)
+  : G4UImessenger(),
+    fCrossSectionTables(crossSectionTables),
+    fDirectory(0),
+    fNofBinsPerDecadeCmd(0),
+    fMinKinECmd(0),
+    fMaxKinECmd(0),
+    fExportCmd(0),
+    fImportCmd(0),
+    fClearCmd(0)
+{
+  /// Standard constructor
+
+  fDirectory = new G4UIdirectory("/mcXsecTables/");
+  fDirectory->SetGuidance(
+    "Commands for the cross section tables used in TVirtualMC::Xsec().");
+
+  fNofBinsPerDecadeCmd =
+    new G4UIcmdWithAnInteger("/mcXsecTables/setNofBinsPerDecade", this);
+  fNofBinsPerDecadeCmd->SetGuidance(
+    "Set the number of bins per decade of energy for the new tables");
+  fNofBinsPerDecadeCmd->SetParameterName("NofBinsPerDecade", false);
+  fNofBinsPerDecadeCmd->SetRange("NofBinsPerDecade > 0");
+  fNofBinsPerDecadeCmd->AvailableForStates(
+    G4State_PreInit, G4State_Init, G4State_Idle);
+
+  fMinKinECmd =
+    new G4UIcmdWithADoubleAndUnit("/mcXsecTables/setMinKinE", this);
+  fMinKinECmd->SetGuidance(
+    "Set the minimum kinetic energy of the new tables");
+  fMinKinECmd->SetParameterName("MinKinE", false);
+  fMinKinECmd->SetUnitCategory("Energy");
+  fMinKinECmd->SetRange("MinKinE > 0.");
+  fMinKinECmd->AvailableForStates(G4State_PreInit, G4State_Init, G4State_Idle);
+
+  fMaxKinECmd =
+    new G4UIcmdWithADoubleAndUnit("/mcXsecTables/setMaxKinE", this);
+  fMaxKinECmd->SetGuidance(
+    "Set the maximum kinetic energy of the new tables");
+  fMaxKinECmd->SetParameterName("MaxKinE", false);
+  fMaxKinECmd->SetUnitCategory("Energy");
+  fMaxKinECmd->SetRange("MaxKinE > 0.");
+  fMaxKinECmd->AvailableForStates(G4State_PreInit, G4State_Init, G4State_Idle);
+
+  fExportCmd = new G4UIcmdWithAString("/mcXsecTables/export", this);
+  fExportCmd->SetGuidance("Export the cross section tables in a file");
+  fExportCmd->SetParameterName("FileName", false);
+  fExportCmd->AvailableForStates(G4State_Idle);
+  // export tables only from master
+  fExportCmd->SetToBeBroadcasted(false);
+
+  fImportCmd = new G4UIcmdWithAString("/mcXsecTables/import", this);
+  fImportCmd->SetGuidance("Import the cross section tables from a file");
+  fImportCmd->SetParameterName("FileName", false);
+  fImportCmd->AvailableForStates(G4State_Idle);
+
+  fClearCmd = new G4UIcmdWithoutParameter("/mcXsecTables/clear", this);
+  fClearCmd->SetGuidance("Clear all cross section tables");
+  fClearCmd->AvailableForStates(G4State_PreInit, G4State_Init, G4State_Idle);
+}
+
+//_____________________________________________________________________________
+TG4CrossSectionTablesMessenger::~TG4CrossSectionTablesMessenger()
+{
+  /// Destructor
+
+  delete fDirectory;
+  delete fNofBinsPerDecadeCmd;
+  delete fMinKinECmd;
+  delete fMaxKinECmd;
+  delete fExportCmd;
+  delete fImportCmd;
+  delete fClearCmd;
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4CrossSectionTablesMessenger::SetNewValue(
+  G4UIcommand* command, G4String newValue)
+{
+  /// Apply command to the associated object.
+
+  if (command == fNofBinsPerDecadeCmd) {
+    fCrossSectionTables->SetNofBinsPerDecade(
+      fNofBinsPerDecadeCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fMinKinECmd) {
+    fCrossSectionTables->SetMinKinEnergy(
+      fMinKinECmd->GetNewDoubleValue(newValue));
+  }
+  else if (command == fMaxKinECmd) {
+    fCrossSectionTables->SetMaxKinEnergy(
+      fMaxKinECmd->GetNewDoubleValue(newValue));
+  }
+  else if (command == fExportCmd) {
+    fCrossSectionTables->Export(newValue);
+  }
+  else if (command == fImportCmd) {
+    fCrossSectionTables->Import(newValue);
+  }
+  else if (command == fClearCmd) {
+    fCrossSectionTables->Clear();
+  }
+}
@@ -15,10 +15,13 @@
 #include "TG4ExtDecayer.h"
 #include "TG4G3Units.h"
 #include "TG4ParticlesManager.h"
+#include "TG4SpecialStackingAction.h"
+#include "TG4TrackManager.h"
 
 #include <G4DecayProducts.hh>
 #include <G4DecayTable.hh>
 #include <G4DynamicParticle.hh>
+#include <G4EventManager.hh>
 #include <G4ParticleTable.hh>
 #include <G4Track.hh>
 
@@ -27,8 +30,23 @@
 #include <TParticle.h>
 #include <TVirtualMCDecayer.h>
 
+#include <chrono>
 #include <math.h>
 
+namespace
+{
+// Return the current time (s) of the monotonic clock
+G4double Now()
+{
+  return std::chrono::duration<G4double>(
+    std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+} // namespace
+
+// static data members
+G4ThreadLocal TG4ExtDecayer* TG4ExtDecayer::fgInstance = 0;
+
 //_____________________________________________________________________________
 TG4ExtDecayer::TG4ExtDecayer(TVirtualMCDecayer* externalDecayer)
   : G4VExtDecayer("TG4ExtDecayer"),
@@ -36,11 +54,20 @@ TG4ExtDecayer::TG4ExtDecayer(TVirtualMCDecayer* externalDecayer)
     fParticlesManager(TG4ParticlesManager::Instance()),
     fExternalDecayer(externalDecayer),
     fDecayProductsArray(0),
-    fSkipNeutrino(false)
+    fSkipNeutrino(false),
+    fParticleDefinitions(),
+    fSpecialStackingAction(0),
+    fIsStackingActionChecked(false),
+    fNofDecays(0),
+    fNofProducts(0),
+    fNofSkippedProducts(0),
+    fDecayTime(0.),
+    fImportTime(0.)
 {
   /// Standard constructor
 
   fDecayProductsArray = new TClonesArray("TParticle", 1000);
+  fgInstance = this;
 }
 
 //_____________________________________________________________________________
@@ -49,6 +76,61 @@ TG4ExtDecayer::~TG4ExtDecayer()
   /// Destructor
 
   delete fDecayProductsArray;
+  if (fgInstance == this) fgInstance = 0;
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+G4ParticleDefinition* TG4ExtDecayer::GetParticleDefinition(
+  const TParticle* particle)
+{
+  /// Return the G4 particle definition for the given TParticle;
+  /// the definitions found via the PDG encoding are cached
+
+  G4int pdg = particle->GetPdgCode();
+  if (pdg != 0) {
+    auto it = fParticleDefinitions.find(pdg);
+    if (it != fParticleDefinitions.end()) return it->second;
+  }
+
+  G4ParticleDefinition* particleDefinition =
+    fParticlesManager->GetParticleDefinition(particle);
+
+  // cache only the definitions obtained via the PDG encoding,
+  // the other ones are found via the particle name
+  if (particleDefinition && pdg != 0 &&
+      particleDefinition->GetPDGEncoding() == pdg) {
+    fParticleDefinitions[pdg] = particleDefinition;
+  }
+
+  return particleDefinition;
+}
+
+//_____________________________________________________________________________
+G4bool TG4ExtDecayer::IsSkipNeutrino()
+{
+  /// Return true if the neutrinos should not be imported, either by
+  /// this decayer option or as they would be killed in the stacking action
+  /// before being saved in the VMC stack (with the tracks saved in
+  /// pre-track); when the tracks are saved in step, the secondaries are
+  /// saved before stacking and the neutrinos have to be created
+
+  if (fSkipNeutrino) return true;
+
+  if (TG4TrackManager::Instance()->GetTrackSaveControl() != kSaveInPreTrack) {
+    return false;
+  }
+
+  if (!fIsStackingActionChecked) {
+    fSpecialStackingAction = dynamic_cast<TG4SpecialStackingAction*>(
+      G4EventManager::GetEventManager()->GetUserStackingAction());
+    fIsStackingActionChecked = true;
+  }
+
+  return fSpecialStackingAction && fSpecialStackingAction->GetSkipNeutrino();
 }
 
 //
@@ -70,7 +152,6 @@ G4DecayProducts* TG4ExtDecayer::ImportDecayProducts(const G4Track& track)
   // get particle momentum
   G4ThreeVector momentum = track.GetMomentum();
   G4double etot = track.GetDynamicParticle()->GetTotalEnergy();
-  ;
   TLorentzVector p;
   p[0] = momentum.x() * TG4G3Units::InverseEnergy();
   p[1] = momentum.y() * TG4G3Units::InverseEnergy();
@@ -86,8 +167,10 @@ G4DecayProducts* TG4ExtDecayer::ImportDecayProducts(const G4Track& track)
 
   // let TVirtualMCDecayer decay the particle
   // and import the decay products
+  G4double startTime = Now();
   fExternalDecayer->Decay(pdgEncoding, &p);
   G4int nofParticles = fExternalDecayer->ImportParticles(fDecayProductsArray);
+  G4double decayEndTime = Now();
 
   if (VerboseLevel() > 1) {
     G4cout << "nofParticles: " << nofParticles << G4endl;
@@ -98,6 +181,8 @@ G4DecayProducts* TG4ExtDecayer::ImportDecayProducts(const G4Track& track)
   G4DecayProducts* decayProducts =
     new G4DecayProducts(*(track.GetDynamicParticle()));
 
+  G4bool skipNeutrino = IsSkipNeutrino();
+  G4double energyUnit = TG4G3Units::Energy();
   G4int counter = 0;
   for (G4int i = 0; i < nofParticles; i++) {
 
@@ -105,40 +190,84 @@ G4DecayProducts* TG4ExtDecayer::ImportDecayProducts(const G4Track& track)
     TParticle* particle =
       fParticlesManager->GetParticle(fDecayProductsArray, i);
 
+    // pass to tracking final particles only
     G4int status = particle->GetStatusCode();
-    G4int pdg = particle->GetPdgCode();
-    if ((status > 0 && status < 11) &&
-        ((!fSkipNeutrino) ||
-          (abs(pdg) != 12 && abs(pdg) != 14 && abs(pdg) != 16))) {
-      // pass to tracking final particles only;
-      // skip neutrinos if skipping option is active
+    if (status <= 0 || status >= 11) continue;
 
-      if (VerboseLevel() > 1) {
-        G4cout << "  " << i << "th particle PDG: " << pdg << "   ";
-      }
+    // skip neutrinos if skipping option is active
+    G4int pdg = particle->GetPdgCode();
+    if (skipNeutrino && (abs(pdg) == 12 || abs(pdg) == 14 || abs(pdg) == 16)) {
+      ++fNofSkippedProducts;
+      continue;
+    }
 
-      // create G4DynamicParticle
-      G4DynamicParticle* dynamicParticle =
-        fParticlesManager->CreateDynamicParticle(particle);
+    if (VerboseLevel() > 1) {
+      G4cout << "  " << i << "th particle PDG: " << pdg << "   ";
+    }
 
-      if (dynamicParticle) {
+    // create G4DynamicParticle
+    G4ParticleDefinition* particleDefinition = GetParticleDefinition(particle);
+    if (!particleDefinition) continue;
 
-        if (VerboseLevel() > 1) {
-          G4cout << "  G4 particle name: "
-                 << dynamicParticle->GetDefinition()->GetParticleName()
-                 << G4endl;
-        }
+    G4DynamicParticle* dynamicParticle =
+      new G4DynamicParticle(particleDefinition,
+        G4ThreeVector(particle->Px() * energyUnit, particle->Py() * energyUnit,
+          particle->Pz() * energyUnit));
 
-        // add dynamicParticle to decayProducts
-        decayProducts->PushProducts(dynamicParticle);
+    // set polarization
+    G4ThreeVector polarization =
+      fParticlesManager->GetParticlePolarization(particle);
+    dynamicParticle->SetPolarization(
+      polarization.x(), polarization.y(), polarization.z());
 
-        counter++;
-      }
+    if (VerboseLevel() > 1) {
+      G4cout << "  G4 particle name: "
+             << dynamicParticle->GetDefinition()->GetParticleName() << G4endl;
     }
+
+    // add dynamicParticle to decayProducts
+    decayProducts->PushProducts(dynamicParticle);
+
+    counter++;
   }
   if (VerboseLevel() > 1) {
     G4cout << "nofParticles for tracking: " << counter << G4endl;
   }
 
+  ++fNofDecays;
+  fNofProducts += counter;
+  fDecayTime += decayEndTime - startTime;
+  fImportTime += Now() - decayEndTime;
+
   return decayProducts;
 }
+
+//_____________________________________________________________________________
+void TG4ExtDecayer::PrintStatistics() const
+{
+  /// Print the number of decays and products and the time spent
+  /// in the external decayer and in the products import
+
+  G4cout << "### External decayer statistics: " << fNofDecays << " decays, "
+         << fNofProducts << " imported products, " << fNofSkippedProducts
+         << " skipped products" << G4endl;
+
+  if (fNofDecays == 0) return;
+
+  G4cout << "    decayer time: " << fDecayTime << " s ("
+         << fDecayTime / fNofDecays * 1.e6 << " us/decay)" << G4endl
+         << "    import time:  " << fImportTime << " s ("
+         << fImportTime / fNofDecays * 1.e6 << " us/decay)" << G4endl;
+}
+
+//_____________________________________________________________________________
+void TG4ExtDecayer::ResetStatistics()
+{
+  /// Reset the accumulated statistics
+
+  fNofDecays = 0;
+  fNofProducts = 0;
+  fNofSkippedProducts = 0;
+  fDecayTime = 0.;
+  fImportTime = 0.;
+}
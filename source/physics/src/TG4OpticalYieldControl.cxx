@@ -0,0 +1,202 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4OpticalYieldControl.cxx
+/// \brief Implementation of the TG4OpticalYieldControl class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4OpticalYieldControl.h"
+#include "TG4GeometryServices.h"
+#include "TG4Globals.h"
+#include "TG4Medium.h"
+#include "TG4MediumMap.h"
+
+#include <G4Cerenkov.hh>
+#include <G4LogicalVolume.hh>
+#include <G4Material.hh>
+#include <G4MaterialPropertiesTable.hh>
+#include <G4ProcessManager.hh>
+#include <G4ProcessTable.hh>
+#include <G4ProcessVector.hh>
+#include <G4Scintillation.hh>
+#include <G4Step.hh>
+#include <G4Track.hh>
+#include <G4VPhysicalVolume.hh>
+
+// static data members
+G4ThreadLocal TG4OpticalYieldControl* TG4OpticalYieldControl::fgInstance = 0;
+
+//_____________________________________________________________________________
+TG4OpticalYieldControl::TG4OpticalYieldControl()
+  : TG4Verbose("opticalYieldControl"),
+    fMessenger(this),
+    fMediumNames(),
+    fCerenkovProcesses(),
+    fScintillationProcesses(),
+    fVolumes(),
+    fIsStacking(true)
+{
+  /// Default constructor
+
+  if (fgInstance) {
+    TG4Globals::Exception("TG4OpticalYieldControl", "TG4OpticalYieldControl",
+      "Cannot create two instances of singleton.");
+  }
+
+  fgInstance = this;
+}
+
+//_____________________________________________________________________________
+TG4OpticalYieldControl::~TG4OpticalYieldControl()
+{
+  /// Destructor
+
+  fgInstance = 0;
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+G4bool TG4OpticalYieldControl::IsYieldOnly(const G4LogicalVolume* volume)
+{
+  /// Return true if the volume medium is in the photon-yield-only mode
+
+  auto it = fVolumes.find(volume);
+  if (it != fVolumes.end()) return it->second;
+
+  TG4Medium* medium =
+    TG4GeometryServices::Instance()->GetMediumMap()->GetMedium(
+      const_cast<G4LogicalVolume*>(volume), false);
+  G4bool isYieldOnly =
+    medium && fMediumNames.find(medium->GetName()) != fMediumNames.end();
+  fVolumes[volume] = isYieldOnly;
+
+  return isYieldOnly;
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4OpticalYieldControl::LateInitialize()
+{
+  /// Collect the Cerenkov and scintillation processes of this thread.
+  /// The processes are collected also when no medium is selected yet,
+  /// as the media can be added later in the Idle state.
+
+  G4ProcessVector* processes =
+    G4ProcessTable::GetProcessTable()->FindProcesses("Cerenkov");
+  for (std::size_t i = 0; i < processes->length(); ++i) {
+    auto process = dynamic_cast<G4Cerenkov*>((*processes)[i]);
+    if (process) fCerenkovProcesses.push_back(process);
+  }
+  delete processes;
+
+  processes = G4ProcessTable::GetProcessTable()->FindProcesses("Scintillation");
+  for (std::size_t i = 0; i < processes->length(); ++i) {
+    auto process = dynamic_cast<G4Scintillation*>((*processes)[i]);
+    if (process) fScintillationProcesses.push_back(process);
+  }
+  delete processes;
+
+  if (!IsActive()) return;
+
+  if (fCerenkovProcesses.empty() && fScintillationProcesses.empty()) {
+    TG4Globals::Warning("TG4OpticalYieldControl", "LateInitialize",
+      "No Cerenkov or scintillation process is defined.");
+  }
+
+  if (VerboseLevel() > 0) {
+    G4cout << "### Photon-yield-only mode activated in " << fMediumNames.size()
+           << " media" << G4endl;
+  }
+}
+
+//_____________________________________________________________________________
+void TG4OpticalYieldControl::UpdateStacking(const G4VPhysicalVolume* volume)
+{
+  /// Switch the photons stacking in the Cerenkov and scintillation processes
+  /// according to the medium of the given volume
+
+  G4bool isStacking = !(volume && IsYieldOnly(volume->GetLogicalVolume()));
+  if (isStacking == fIsStacking) return;
+
+  for (auto process : fCerenkovProcesses) {
+    process->SetStackPhotons(isStacking);
+  }
+  for (auto process : fScintillationProcesses) {
+    process->SetStackPhotons(isStacking);
+  }
+  fIsStacking = isStacking;
+}
+
+//_____________________________________________________________________________
+void TG4OpticalYieldControl::GetNofPhotons(const G4Step* step,
+  G4int& nofCerenkovPhotons, G4int& nofScintillationPhotons) const
+{
+  /// Return the numbers of the Cerenkov and scintillation photons produced
+  /// in the given step; the numbers kept by the processes are used only
+  /// if the processes generated photons in this step
+
+  nofCerenkovPhotons = 0;
+  nofScintillationPhotons = 0;
+
+  const G4Track* track = step->GetTrack();
+  G4ProcessManager* processManager =
+    track->GetDefinition()->GetProcessManager();
+  const G4Material* material = step->GetPreStepPoint()->GetMaterial();
+  if (!processManager || !material) return;
+
+  G4MaterialPropertiesTable* properties =
+    material->GetMaterialPropertiesTable();
+  if (!properties) return;
+
+  auto cerenkov =
+    dynamic_cast<G4Cerenkov*>(processManager->GetProcess("Cerenkov"));
+  G4MaterialPropertyVector* rindex = properties->GetProperty(kRINDEX);
+  G4double charge = track->GetDefinition()->GetPDGCharge();
+  if (cerenkov && rindex && charge != 0.) {
+    G4double beta = (step->GetPreStepPoint()->GetBeta() +
+                      step->GetPostStepPoint()->GetBeta()) * 0.5;
+    if (cerenkov->GetAverageNumberOfPhotons(charge, beta, material, rindex) >
+        0.) {
+      nofCerenkovPhotons = cerenkov->GetNumPhotons();
+    }
+  }
+
+  auto scintillation =
+    dynamic_cast<G4Scintillation*>(processManager->GetProcess("Scintillation"));
+  if (scintillation && step->GetTotalEnergyDeposit() > 0.) {
+    nofScintillationPhotons = scintillation->GetNumPhotons();
+  }
+}
+
+//_____________________________________________________________________________
+void TG4OpticalYieldControl::AddMedium(const G4String& mediumName)
+{
+  /// Select the photon-yield-only mode for the medium with the given name
+
+  fMediumNames.insert(mediumName);
+  fVolumes.clear();
+}
+
+//_____________________________________________________________________________
+void TG4OpticalYieldControl::SetMediumNames(
+  const std::set<G4String>& mediumNames)
+{
+  /// Set the names of the media with the photon-yield-only mode
+  /// (used to pass the selection from master to workers)
+
+  fMediumNames = mediumNames;
+  fVolumes.clear();
+}
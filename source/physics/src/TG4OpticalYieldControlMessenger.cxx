@@ -0,0 +1,67 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4OpticalYieldControlMessenger.cxx
+/// \brief Implementation of the TG4OpticalYieldControlMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4OpticalYieldControlMessenger.h"
+#include "TG4OpticalYieldControl.h"
+
+#include <G4UIcmdWithAString.hh>
+#include <G4UIdirectory.hh>
+
+//______________________________________________________________________________
+TG4OpticalYieldControlMessenger::TG4OpticalYieldControlMessenger(
+  TG4OpticalYieldControl* yieldControl)
+  : G4UImessenger(),
+    fYieldControl(yieldControl),
+    fDirectory(0),
+    fAddMediumCmd(0)
+{
+  /// Standard constructor
+
+  fDirectory = new G4UIdirectory("/mcPhysics/opticalYield/");
+  fDirectory->SetGuidance("Photon-yield-only mode commands.");
+
+  fAddMediumCmd =
+    new G4UIcmdWithAString("/mcPhysics/opticalYield/addMedium", this);
+  fAddMediumCmd->SetGuidance(
+    "Select the photon-yield-only mode for the medium with the given name:");
+  fAddMediumCmd->SetGuidance(
+    "the Cerenkov and scintillation photons are counted, but not created.");
+  fAddMediumCmd->SetParameterName("MediumName", false);
+  fAddMediumCmd->AvailableForStates(
+    G4State_PreInit, G4State_Init, G4State_Idle);
+}
+
+//______________________________________________________________________________
+TG4OpticalYieldControlMessenger::~TG4OpticalYieldControlMessenger()
+{
+  /// Destructor
+
+  delete fDirectory;
+  delete fAddMediumCmd;
+}
+
+//
+// public methods
+//
+
+//______________________________________________________________________________
+void TG4OpticalYieldControlMessenger::SetNewValue(
+  G4UIcommand* command, G4String newValue)
+{
+  /// Apply command to the associated object.
+
+  if (command == fAddMediumCmd) {
+    fYieldControl->AddMedium(newValue);
+  }
+}
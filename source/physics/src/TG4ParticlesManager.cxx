@@ -14,6 +14,7 @@
 
 #include "TG4ParticlesManager.h"
 #include "TG4G3Units.h"
+#include "TG4MTProfiler.h"
 #include "TG4UserIon.h"
 #include "TG4UserParticle.h"
 
@@ -124,7 +125,8 @@ void TG4ParticlesManager::AddParticleToPdgDatabase(
 
   // Add particle to TDatabasePDG
 #ifdef G4MULTITHREADED
-  G4AutoLock lm(&addParticleMutex);
+  G4AutoLock lm(&addParticleMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "ParticlesManager::AddParticle");
 #endif
   TDatabasePDG::Instance()->AddParticle(name, g4Name,
     particleDefinition->GetPDGMass() * TG4G3Units::InverseEnergy(),
@@ -13,11 +13,14 @@
 /// \author I. Hrivnacova; IPN, Orsay
 
 #include "TG4PhysicsManager.h"
+#include "TG4CrossSectionTables.h"
 #include "TG4G3Control.h"
 #include "TG4G3Cut.h"
 #include "TG4G3PhysicsManager.h"
 #include "TG4G3Units.h"
+#include "TG4GeometryManager.h"
 #include "TG4GeometryServices.h"
+#include "TG4ImportanceBiasingManager.h"
 #include "TG4Limits.h"
 #include "TG4Medium.h"
 #include "TG4MediumMap.h"
@@ -409,12 +412,25 @@ void TG4PhysicsManager::Gstpar(Int_t itmed, const char* param, Float_t parval)
   ///  - ITMED     tracking medium number
   ///  - CHPAR     is a character string (variable name)
   ///  - PARVAL    must be given as a floating point.
+  ///
+  /// The geometry importance of the tracking medium can be set via the
+  /// Geant4 specific parameter "IMPORTANCE" (see
+  /// TG4ImportanceBiasingManager).
 
   if (VerboseLevel() > 1) {
     G4cout << "TG4PhysicsManager::Gstpar " << param << "  " << parval << G4endl;
   }
 
   G4String name = TG4GeometryServices::Instance()->CutName(param);
+
+  // the geometry importance is not a G3 parameter
+  if (name == "IMPORTANCE") {
+    TG4GeometryManager::Instance()
+      ->GetImportanceBiasingManager()
+      ->SetMediumImportance(itmed, parval);
+    return;
+  }
+
   TG4G3Cut cut;
   if (fG3PhysicsManager->CheckCutWithTheVector(name, parval, cut)) {
     GstparCut(itmed, cut, parval);
@@ -583,13 +599,31 @@ Bool_t TG4PhysicsManager::DefineIon(const char* name, Int_t Z, Int_t A, Int_t Q,
 
 //_____________________________________________________________________________
 Float_t TG4PhysicsManager::Xsec(
-  char* /*ch*/, Float_t /*p1*/, Int_t /*i1*/, Int_t /*i2*/)
+  char* reac, Float_t energy, Int_t part, Int_t mate)
 {
-  /// Not yet implemented -> give exception.
+  /// Return the cross section per volume (1/cm) of the given reaction
+  /// for the particle with the given PDG encoding and kinetic energy (GeV)
+  /// in the medium with the given ID.
+  /// The reaction can be given by the G4 process name, the G3 control name
+  /// (eg. "PHOT", "HADR") or the TMCProcess name; the values are
+  /// interpolated in the per-thread tables (see TG4CrossSectionTables).
+
+  TG4CrossSectionTables* tables = TG4CrossSectionTables::Instance();
+  if (!tables) {
+    TG4Globals::Warning("TG4PhysicsManager", "Xsec",
+      "Cross section tables are not available.");
+    return 0.;
+  }
+
+  TG4Medium* medium =
+    TG4GeometryServices::Instance()->GetMediumMap()->GetMedium(mate);
+  if (!medium) return 0.;
 
-  TG4Globals::Exception("TG4PhysicsManager", "Xsec", "Not yet implemented.");
+  G4double xsec = tables->GetCrossSection(reac,
+    energy * TG4G3Units::Energy(), GetParticleDefinition(part),
+    medium->GetMaterial());
 
-  return 0.;
+  return xsec * TG4G3Units::Length();
 }
 
 //_____________________________________________________________________________
@@ -31,7 +31,12 @@ TG4StackPopper::TG4StackPopper(const G4String& processName)
   : G4VProcess(processName, fUserDefined),
     fMCStack(0),
     fNofDoneTracks(0),
-    fDoExclusiveStep(false)
+    fDoExclusiveStep(false),
+    fTrackStatus(fAlive),
+    fMaxNofPopsPerStep(0),
+    fNofInvocations(0),
+    fNofPoppedTracks(0),
+    fMaxNofPoppedTracks(0)
 {
   /// Standard constructor
 
@@ -93,6 +98,21 @@ G4VParticleChange* TG4StackPopper::PostStepDoIt(
 
   Int_t currentTrackId = fMCStack->GetCurrentTrackNumber();
   Int_t nofTracksToPop = fMCStack->GetNtrack() - fNofDoneTracks;
+
+  // Limit the number of popped tracks, if requested; the remaining tracks
+  // will be popped in the next step (except for the exclusive step)
+  if (fMaxNofPopsPerStep > 0 && nofTracksToPop > fMaxNofPopsPerStep &&
+      !fDoExclusiveStep) {
+    nofTracksToPop = fMaxNofPopsPerStep;
+  }
+
+  ++fNofInvocations;
+  fNofPoppedTracks += nofTracksToPop;
+  if (nofTracksToPop > fMaxNofPoppedTracks) {
+    fMaxNofPoppedTracks = nofTracksToPop;
+  }
+
+  auto particlesManager = TG4ParticlesManager::Instance();
   aParticleChange.SetNumberOfSecondaries(
     aParticleChange.GetNumberOfSecondaries() + nofTracksToPop);
 
@@ -115,7 +135,7 @@ G4VParticleChange* TG4StackPopper::PostStepDoIt(
 
     // Create dynamic particle
     G4DynamicParticle* dynamicParticle =
-      TG4ParticlesManager::Instance()->CreateDynamicParticle(particle);
+      particlesManager->CreateDynamicParticle(particle);
     if (!dynamicParticle) {
       TG4Globals::Exception("TG4StackPopper", "PostStepDoIt",
         "Conversion from Root particle -> G4 particle failed.");
@@ -123,8 +143,7 @@ G4VParticleChange* TG4StackPopper::PostStepDoIt(
 
     // Define track
 
-    G4ThreeVector position =
-      TG4ParticlesManager::Instance()->GetParticlePosition(particle);
+    G4ThreeVector position = particlesManager->GetParticlePosition(particle);
     G4double time = particle->T() * TG4G3Units::Time();
 
     G4Track* secondaryTrack = new G4Track(dynamicParticle, time, position);
@@ -186,5 +205,29 @@ G4bool TG4StackPopper::HasPoppedTracks() const
 {
   /// Return true if there are user tracks in stack
 
-  return (gMC->GetStack()->GetNtrack() != fNofDoneTracks);
+  return (fMCStack->GetNtrack() != fNofDoneTracks);
+}
+
+//_____________________________________________________________________________
+void TG4StackPopper::PrintStatistics() const
+{
+  /// Print the number of invocations and popped tracks
+
+  G4cout << "### Stack popper statistics: " << fNofInvocations
+         << " invocations, " << fNofPoppedTracks << " popped tracks";
+  if (fNofInvocations > 0) {
+    G4cout << ", " << G4double(fNofPoppedTracks) / fNofInvocations
+           << " pops/invocation (max " << fMaxNofPoppedTracks << ")";
+  }
+  G4cout << G4endl;
+}
+
+//_____________________________________________________________________________
+void TG4StackPopper::ResetStatistics()
+{
+  /// Reset the accumulated statistics
+
+  fNofInvocations = 0;
+  fNofPoppedTracks = 0;
+  fMaxNofPoppedTracks = 0;
 }
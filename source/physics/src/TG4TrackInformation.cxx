@@ -17,6 +17,9 @@
 /// Geant4 allocator for TG4TrackInformation objects
 G4ThreadLocal G4Allocator<TG4TrackInformation>* gTrackInfoAllocator = 0;
 
+// static data members
+G4ThreadLocal G4int TG4TrackInformation::fgCounter = 0;
+
 //_____________________________________________________________________________
 TG4TrackInformation::TG4TrackInformation()
   : G4VUserTrackInformation(),
@@ -30,6 +33,8 @@ TG4TrackInformation::TG4TrackInformation()
     fInitialTrackStatus(nullptr)
 {
   /// Default constructor
+
+  ++fgCounter;
 }
 
 //_____________________________________________________________________________
@@ -45,6 +50,8 @@ TG4TrackInformation::TG4TrackInformation(G4int trackParticleID)
     fInitialTrackStatus(nullptr)
 {
   /// Standard constructor
+
+  ++fgCounter;
 }
 /*
 //_____________________________________________________________________________
@@ -61,6 +68,8 @@ TG4TrackInformation::TG4TrackInformation(G4int  trackParticleID,
 TG4TrackInformation::~TG4TrackInformation()
 {
   /// Destructor
+
+  --fgCounter;
 }
 
 //
@@ -0,0 +1,140 @@
+#ifndef TG4_EM_DEGRADATION_H
+#define TG4_EM_DEGRADATION_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4EmDegradation.h
+/// \brief Definition of the TG4EmDegradation class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4EmDegradationMessenger.h"
+#include "TG4Verbose.h"
+
+#include <globals.hh>
+
+#include <vector>
+
+class G4LogicalVolume;
+
+/// \ingroup physics_list
+/// \brief The automatic EM physics degradation outside sensitive volumes
+///
+/// When activated, the logical volumes are split at initialization in two
+/// regions:
+/// - "PrecisionRegion" with the sensitive volumes, which are the volumes
+///   with a tracking medium with isvol > 0, the volumes with a user
+///   sensitive detector, or, if the SD selection is defined, the selected
+///   volumes;
+/// - "BulkRegion" with all other volumes.
+///
+/// The bulk region gets the production cut set via setBulkRangeCut and
+/// the EM option set via setBulkEmOption, applied via
+/// G4EmParameters::AddPhysics(); the EM option can be also changed in the
+/// precision region via setPrecisionEmOption. The volumes already in a
+/// region (the world and the EM/fast simulation model regions) are kept.
+///
+/// The regions are not created when special cuts per material are set,
+/// as these are also applied via regions.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4EmDegradation : public TG4Verbose
+{
+ public:
+  TG4EmDegradation();
+  virtual ~TG4EmDegradation();
+
+  // static methods
+  static G4String AvailableEmOptions();
+
+  // methods
+  void CreateRegions();
+
+  // set methods
+  void SetIsActive(G4bool isActive);
+  void SetBulkEmOption(const G4String& emOption);
+  void SetPrecisionEmOption(const G4String& emOption);
+  void SetBulkRangeCut(G4double rangeCut);
+
+  // get methods
+  G4bool IsActive() const;
+
+ private:
+  /// Not implemented
+  TG4EmDegradation(const TG4EmDegradation& right);
+  /// Not implemented
+  TG4EmDegradation& operator=(const TG4EmDegradation& right);
+
+  // methods
+  G4bool IsPrecisionVolume(G4LogicalVolume* lv) const;
+  void PrintRegion(const G4String& regionName,
+    const std::vector<G4LogicalVolume*>& volumes) const;
+
+  // static data members
+  /// The precision region name
+  static const G4String fgkPrecisionRegionName;
+  /// The bulk region name
+  static const G4String fgkBulkRegionName;
+  /// The value for no EM option change
+  static const G4String fgkNoEmOption;
+  /// The default bulk EM option
+  static const G4String fgkDefaultBulkEmOption;
+  /// The default bulk range cut
+  static const G4double fgkDefaultBulkRangeCut;
+
+  // data members
+  /// Messenger
+  TG4EmDegradationMessenger fMessenger;
+  /// Option to activate the regions creation
+  G4bool fIsActive;
+  /// The EM option applied in the bulk region
+  G4String fBulkEmOption;
+  /// The EM option applied in the precision region
+  G4String fPrecisionEmOption;
+  /// The production range cut applied in the bulk region
+  G4double fBulkRangeCut;
+  /// Info if regions were already created
+  G4bool fCreateRegionsDone;
+};
+
+// inline functions
+
+inline void TG4EmDegradation::SetIsActive(G4bool isActive)
+{
+  /// Set the option to activate the regions creation
+  fIsActive = isActive;
+}
+
+inline void TG4EmDegradation::SetBulkEmOption(const G4String& emOption)
+{
+  /// Set the EM option applied in the bulk region
+  fBulkEmOption = emOption;
+}
+
+inline void TG4EmDegradation::SetPrecisionEmOption(const G4String& emOption)
+{
+  /// Set the EM option applied in the precision region
+  fPrecisionEmOption = emOption;
+}
+
+inline void TG4EmDegradation::SetBulkRangeCut(G4double rangeCut)
+{
+  /// Set the production range cut applied in the bulk region
+  fBulkRangeCut = rangeCut;
+}
+
+inline G4bool TG4EmDegradation::IsActive() const
+{
+  /// Return the option to activate the regions creation
+  return fIsActive;
+}
+
+#endif // TG4_EM_DEGRADATION_H
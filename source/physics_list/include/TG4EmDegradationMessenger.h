@@ -0,0 +1,80 @@
+#ifndef TG4_EM_DEGRADATION_MESSENGER_H
+#define TG4_EM_DEGRADATION_MESSENGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4EmDegradationMessenger.h
+/// \brief Definition of the TG4EmDegradationMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class TG4EmDegradation;
+
+class G4UIdirectory;
+class G4UIcmdWithABool;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAString;
+
+/// \ingroup physics_list
+/// \brief Messenger class that defines commands for the automatic EM physics
+///        degradation outside sensitive volumes
+///
+/// Implements commands:
+/// - /mcPhysics/emDegradation/activate [true|false]
+/// - /mcPhysics/emDegradation/setBulkEmOption emOption
+/// - /mcPhysics/emDegradation/setPrecisionEmOption emOption
+/// - /mcPhysics/emDegradation/setBulkRangeCut value unit
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4EmDegradationMessenger : public G4UImessenger
+{
+ public:
+  TG4EmDegradationMessenger(TG4EmDegradation* emDegradation);
+  virtual ~TG4EmDegradationMessenger();
+
+  // methods
+  virtual void SetNewValue(G4UIcommand* command, G4String string);
+
+ private:
+  /// Not implemented
+  TG4EmDegradationMessenger();
+  /// Not implemented
+  TG4EmDegradationMessenger(const TG4EmDegradationMessenger& right);
+  /// Not implemented
+  TG4EmDegradationMessenger& operator=(
+    const TG4EmDegradationMessenger& right);
+
+  //
+  // data members
+
+  /// associated class
+  TG4EmDegradation* fEmDegradation;
+
+  /// command directory
+  G4UIdirectory* fDirectory;
+
+  /// activate command
+  G4UIcmdWithABool* fActivateCmd;
+
+  /// setBulkEmOption command
+  G4UIcmdWithAString* fSetBulkEmOptionCmd;
+
+  /// setPrecisionEmOption command
+  G4UIcmdWithAString* fSetPrecisionEmOptionCmd;
+
+  /// setBulkRangeCut command
+  G4UIcmdWithADoubleAndUnit* fSetBulkRangeCutCmd;
+};
+
+#endif // TG4_EM_DEGRADATION_MESSENGER_H
@@ -24,6 +24,7 @@
 
 #include <map>
 
+class G4GenericBiasingPhysics;
 class G4MonopolePhysics;
 
 /// \ingroup physics_list
@@ -41,6 +42,9 @@ class G4MonopolePhysics;
 /// - /physics_engine/tailor/GammaNuclear on
 /// - /physics_engine/tailor/MuonNuclear on
 ///
+/// The biasing builder wraps only the inelastic processes of the particles
+/// selected via /mcPhysics/biasing/setParticles (see TG4BiasingManager).
+///
 /// \author I. Hrivnacova; IPN Orsay
 
 class TG4ExtraPhysicsList : public G4VModularPhysicsList, public TG4Verbose
@@ -79,6 +83,11 @@ class TG4ExtraPhysicsList : public G4VModularPhysicsList, public TG4Verbose
   // methods
   void Configure(const G4String& /*selection*/,
     const std::map<TString, Double_t>& parameters);
+  void ConfigureBiasing();
+
+  // data members
+  /// The generic biasing physics (if selected)
+  G4GenericBiasingPhysics* fBiasingPhysics;
 };
 
 #endif // TG4_EXTRA_PHYSICS_LIST_H
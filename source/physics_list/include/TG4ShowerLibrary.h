@@ -0,0 +1,130 @@
+#ifndef TG4_SHOWER_LIBRARY_H
+#define TG4_SHOWER_LIBRARY_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ShowerLibrary.h
+/// \brief Definition of the TG4ShowerLibrary class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <globals.hh>
+
+#include <vector>
+
+/// \ingroup physics_list
+/// \brief The library of frozen showers used by TG4ShowerLibraryModel
+///
+/// The showers are binned by the particle type (gamma, e-, e+),
+/// the particle kinetic energy (in logarithmic bins) and
+/// the polar angle of the particle direction (in uniform bins).
+/// Each shower is stored as a list of energy spots defined in the shower
+/// frame (the longitudinal and radial distance from the shower starting point
+/// and axis and the azimuthal angle around the axis) with the deposited energy
+/// expressed as a fraction of the shower particle kinetic energy.
+///
+/// The spots of all showers are kept in one contiguous array, which is
+/// also written in a compact binary file in one block, so that it can be
+/// read back in one go and shared read-only between threads.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4ShowerLibrary
+{
+ public:
+  /// The energy spot of a library shower
+  struct Spot
+  {
+    G4float fLongitudinal;   ///< distance along the shower axis
+    G4float fRadial;         ///< distance from the shower axis
+    G4float fPhi;            ///< azimuthal angle around the shower axis
+    G4float fEnergyFraction; ///< deposited energy / particle kinetic energy
+  };
+
+  TG4ShowerLibrary();
+  ~TG4ShowerLibrary();
+
+  // methods
+  G4bool Read(const G4String& fileName);
+  G4bool Write(const G4String& fileName) const;
+  void AddShower(
+    G4int binIndex, G4double energy, const std::vector<Spot>& spots);
+  void Clear();
+  void Print() const;
+
+  // set methods
+  void SetEnergyBinning(G4int nofBins, G4double minEnergy, G4double maxEnergy);
+  void SetNofAngleBins(G4int nofBins);
+
+  // get methods
+  G4bool IsApplicable(G4int pdgEncoding) const;
+  G4int GetBinIndex(G4int pdgEncoding, G4double energy, G4double theta) const;
+  G4int GetNofShowers(G4int binIndex) const;
+  G4int GetNofShowers() const;
+  const Spot* GetShower(
+    G4int binIndex, G4int showerIndex, G4int& nofSpots) const;
+
+ private:
+  /// The library shower
+  struct Shower
+  {
+    G4double fEnergy; ///< the shower particle kinetic energy
+    G4int fFirstSpot; ///< the index of the first spot in fSpots
+    G4int fNofSpots;  ///< the number of spots
+  };
+
+  /// Not implemented
+  TG4ShowerLibrary(const TG4ShowerLibrary& right);
+  /// Not implemented
+  TG4ShowerLibrary& operator=(const TG4ShowerLibrary& right);
+
+  // methods
+  G4int GetParticleIndex(G4int pdgEncoding) const;
+  void ResetBins();
+
+  // static data members
+  /// The file identification string
+  static const G4String fgkFileId;
+  /// The file format version
+  static const G4int fgkFileVersion;
+  /// The number of particle types
+  static const G4int fgkNofParticles = 3;
+  /// The PDG encodings of the particle types
+  static const G4int fgkParticlePdgs[fgkNofParticles];
+
+  // data members
+  G4int fNofEnergyBins; ///< number of energy bins
+  G4double fMinEnergy;  ///< lower edge of the energy binning
+  G4double fMaxEnergy;  ///< upper edge of the energy binning
+  G4int fNofAngleBins;  ///< number of polar angle bins
+
+  /// The shower indices per (particle, energy, angle) bin
+  std::vector<std::vector<G4int> > fBins;
+  /// The showers
+  std::vector<Shower> fShowers;
+  /// The spots of all showers
+  std::vector<Spot> fSpots;
+};
+
+// inline functions
+
+inline G4bool TG4ShowerLibrary::IsApplicable(G4int pdgEncoding) const
+{
+  /// Return true if the particle type is handled by the library
+  return GetParticleIndex(pdgEncoding) >= 0;
+}
+
+inline G4int TG4ShowerLibrary::GetNofShowers() const
+{
+  /// Return the total number of showers in the library
+  return G4int(fShowers.size());
+}
+
+#endif // TG4_SHOWER_LIBRARY_H
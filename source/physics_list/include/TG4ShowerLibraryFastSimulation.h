@@ -0,0 +1,46 @@
+#ifndef TG4_SHOWER_LIBRARY_FAST_SIMULATION_H
+#define TG4_SHOWER_LIBRARY_FAST_SIMULATION_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ShowerLibraryFastSimulation.h
+/// \brief Definition of the TG4ShowerLibraryFastSimulation class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4VUserFastSimulation.h"
+
+class TG4ShowerLibraryMessenger;
+class TG4ShowerLibraryModel;
+
+/// \ingroup physics_list
+/// \brief Special class for definition of the shower library fast
+///        simulation model.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4ShowerLibraryFastSimulation : public TG4VUserFastSimulation
+{
+ public:
+  TG4ShowerLibraryFastSimulation();
+  virtual ~TG4ShowerLibraryFastSimulation();
+
+  // methods
+  virtual void Construct();
+
+ private:
+  // data members
+  TG4ShowerLibraryMessenger* fMessenger; ///< Messenger
+
+  /// Shower library model
+  TG4ShowerLibraryModel* fShowerLibraryModel;
+};
+
+#endif // TG4_SHOWER_LIBRARY_FAST_SIMULATION_H
@@ -0,0 +1,96 @@
+#ifndef TG4_SHOWER_LIBRARY_MESSENGER_H
+#define TG4_SHOWER_LIBRARY_MESSENGER_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ShowerLibraryMessenger.h
+/// \brief Definition of the TG4ShowerLibraryMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include <G4UImessenger.hh>
+#include <globals.hh>
+
+class TG4ShowerLibraryModel;
+
+class G4UIdirectory;
+class G4UIcommand;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithoutParameter;
+
+/// \ingroup physics_list
+/// \brief Messenger class that defines commands for the shower library
+///        fast simulation model
+///
+/// Implements commands:
+/// - /mcPhysics/showerLibrary/setMode record|replay
+/// - /mcPhysics/showerLibrary/setFileName fileName
+/// - /mcPhysics/showerLibrary/setEnergyBinning nofBins minE maxE unit
+/// - /mcPhysics/showerLibrary/setNofAngleBins nofBins
+/// - /mcPhysics/showerLibrary/setSpotSize length radius unit
+/// - /mcPhysics/showerLibrary/save
+/// - /mcPhysics/showerLibrary/print
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4ShowerLibraryMessenger : public G4UImessenger
+{
+ public:
+  TG4ShowerLibraryMessenger(TG4ShowerLibraryModel* showerLibraryModel);
+  virtual ~TG4ShowerLibraryMessenger();
+
+  // methods
+  virtual void SetNewValue(G4UIcommand* command, G4String string);
+
+ private:
+  /// Not implemented
+  TG4ShowerLibraryMessenger();
+  /// Not implemented
+  TG4ShowerLibraryMessenger(const TG4ShowerLibraryMessenger& right);
+  /// Not implemented
+  TG4ShowerLibraryMessenger& operator=(const TG4ShowerLibraryMessenger& right);
+
+  // methods
+  void CreateSetEnergyBinningCmd();
+  void CreateSetSpotSizeCmd();
+
+  //
+  // data members
+
+  /// associated class
+  TG4ShowerLibraryModel* fShowerLibraryModel;
+
+  /// command directory
+  G4UIdirectory* fDirectory;
+
+  /// setMode command
+  G4UIcmdWithAString* fSetModeCmd;
+
+  /// setFileName command
+  G4UIcmdWithAString* fSetFileNameCmd;
+
+  /// setEnergyBinning command
+  G4UIcommand* fSetEnergyBinningCmd;
+
+  /// setNofAngleBins command
+  G4UIcmdWithAnInteger* fSetNofAngleBinsCmd;
+
+  /// setSpotSize command
+  G4UIcommand* fSetSpotSizeCmd;
+
+  /// save command
+  G4UIcmdWithoutParameter* fSaveCmd;
+
+  /// print command
+  G4UIcmdWithoutParameter* fPrintCmd;
+};
+
+#endif // TG4_SHOWER_LIBRARY_MESSENGER_H
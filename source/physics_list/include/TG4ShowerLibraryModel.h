@@ -0,0 +1,192 @@
+#ifndef TG4_SHOWER_LIBRARY_MODEL_H
+#define TG4_SHOWER_LIBRARY_MODEL_H
+
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ShowerLibraryModel.h
+/// \brief Definition of the TG4ShowerLibraryModel class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4ShowerLibrary.h"
+
+#include <G4ThreeVector.hh>
+#include <G4VFastSimulationModel.hh>
+#include <globals.hh>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+class G4Step;
+class G4Track;
+class GFlashHitMaker;
+
+/// \ingroup physics_list
+/// \brief The frozen showers (shower library) fast simulation model
+///
+/// The model works in two modes:
+/// - kRecord: the showers of the particles entering the regions where the
+///   model is applied are fully simulated and their energy deposits
+///   (including the deposits of all their descendants) are binned in
+///   the shower frame and added to the library at the end of event;
+///   the library can be then saved in a file with the
+///   /mcPhysics/showerLibrary/save command;
+/// - kReplay: the library is read from the file and the particles entering
+///   the regions are killed and replaced with a shower randomly sampled
+///   from the library bin, scaled to the particle energy and rotated in the
+///   particle direction. The spots are passed to the sensitive detectors
+///   via GFlashHitMaker, this requires activating the Gflash sensitive
+///   detectors with /mcDet/setGflash true.
+///
+/// The model is shared between threads; the per-thread recording data and
+/// hit maker are kept in thread-local static data members.
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+class TG4ShowerLibraryModel : public G4VFastSimulationModel
+{
+ public:
+  /// The model mode
+  enum Mode
+  {
+    kRecord, ///< record showers in the library
+    kReplay  ///< replay showers from the library
+  };
+
+ public:
+  TG4ShowerLibraryModel(const G4String& name = "ShowerLibraryModel");
+  virtual ~TG4ShowerLibraryModel();
+
+  // static access method
+  static TG4ShowerLibraryModel* Instance();
+
+  // methods
+  virtual G4bool IsApplicable(const G4ParticleDefinition& particle);
+  virtual G4bool ModelTrigger(const G4FastTrack& fastTrack);
+  virtual void DoIt(const G4FastTrack& fastTrack, G4FastStep& fastStep);
+
+  void Initialize();
+  void RecordStep(const G4Step* step);
+  void EndOfEvent();
+  void Save() const;
+  void Print() const;
+
+  // set methods
+  void SetMode(Mode mode);
+  void SetFileName(const G4String& fileName);
+  void SetSpotSize(G4double length, G4double radius);
+  void SetEnergyBinning(G4int nofBins, G4double minEnergy, G4double maxEnergy);
+  void SetNofAngleBins(G4int nofBins);
+
+  // get methods
+  Mode GetMode() const;
+  G4bool IsRecording() const;
+  const G4String& GetFileName() const;
+
+ private:
+  /// The shower being recorded
+  struct RecordedShower
+  {
+    G4int fBinIndex;                 ///< the library bin index
+    G4double fEnergy;                ///< the particle kinetic energy
+    G4ThreeVector fOrigin;           ///< the shower starting point
+    G4ThreeVector fAxis;             ///< the shower axis
+    G4ThreeVector fU;                ///< the reference direction for phi
+    G4ThreeVector fV;                ///< the second transverse direction
+    std::map<G4int, G4double> fEdep; ///< the energy deposits per spot cell
+  };
+
+  /// The per-thread recording data
+  struct Recorder
+  {
+    /// the showers recorded in the current event
+    std::vector<RecordedShower> fShowers;
+    /// the map from the track ID to the shower index
+    std::unordered_map<G4int, G4int> fTrackToShower;
+  };
+
+  /// Not implemented
+  TG4ShowerLibraryModel(const TG4ShowerLibraryModel& right);
+  /// Not implemented
+  TG4ShowerLibraryModel& operator=(const TG4ShowerLibraryModel& right);
+
+  // methods
+  G4int GetBinIndex(const G4Track* track) const;
+  void StartShower(const G4Track* track);
+
+  // static data members
+  static TG4ShowerLibraryModel* fgInstance;        ///< this instance
+  static G4ThreadLocal Recorder* fgRecorder;       ///< the recording data
+  static G4ThreadLocal GFlashHitMaker* fgHitMaker; ///< the hit maker
+
+  /// The number of spot cells in the azimuthal angle
+  static const G4int fgkNofPhiCells;
+  /// The number of spot cells in the radial direction
+  static const G4int fgkNofRadialCells;
+  /// The number of spot cells in the longitudinal direction
+  static const G4int fgkNofLongitudinalCells;
+
+  // data members
+  Mode fMode;                ///< the model mode
+  G4String fFileName;        ///< the library file name
+  G4double fSpotLength;      ///< the spot cell longitudinal size
+  G4double fSpotRadius;      ///< the spot cell radial size
+  G4bool fIsInitialized;     ///< the initialization flag
+  TG4ShowerLibrary fLibrary; ///< the shower library
+};
+
+// inline functions
+
+inline TG4ShowerLibraryModel* TG4ShowerLibraryModel::Instance()
+{
+  /// Return this instance
+  return fgInstance;
+}
+
+inline void TG4ShowerLibraryModel::SetMode(Mode mode)
+{
+  /// Set the model mode
+  fMode = mode;
+}
+
+inline void TG4ShowerLibraryModel::SetFileName(const G4String& fileName)
+{
+  /// Set the library file name
+  fFileName = fileName;
+}
+
+inline void TG4ShowerLibraryModel::SetSpotSize(
+  G4double length, G4double radius)
+{
+  /// Set the spot cell size used when recording showers
+  fSpotLength = length;
+  fSpotRadius = radius;
+}
+
+inline TG4ShowerLibraryModel::Mode TG4ShowerLibraryModel::GetMode() const
+{
+  /// Return the model mode
+  return fMode;
+}
+
+inline G4bool TG4ShowerLibraryModel::IsRecording() const
+{
+  /// Return true if the model is in the recording mode
+  return fMode == kRecord;
+}
+
+inline const G4String& TG4ShowerLibraryModel::GetFileName() const
+{
+  /// Return the library file name
+  return fFileName;
+}
+
+#endif // TG4_SHOWER_LIBRARY_MODEL_H
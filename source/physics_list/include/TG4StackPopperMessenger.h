@@ -21,6 +21,7 @@
 class TG4StackPopperPhysics;
 
 class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
 
 /// \ingroup physics_list
 /// \brief Messenger class that defines commands for the stack popper
@@ -28,6 +29,7 @@ class G4UIcmdWithAString;
 ///
 /// Implements commands:
 /// - /mcPhysics/setStackPopperSelection [particleName1 particleName2 ...]
+/// - /mcPhysics/setStackPopperMaxNofPops value
 ///
 /// \author I. Hrivnacova; IPN Orsay
 
@@ -56,6 +58,9 @@ class TG4StackPopperMessenger : public G4UImessenger
 
   /// setStackPopperSelection command
   G4UIcmdWithAString* fSetSelectionCmd;
+
+  /// setStackPopperMaxNofPops command
+  G4UIcmdWithAnInteger* fSetMaxNofPopsCmd;
 };
 
 #endif // TG4_STACK_POPPER_MESSENGER_H
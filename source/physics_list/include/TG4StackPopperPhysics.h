@@ -37,6 +37,7 @@ class TG4StackPopperPhysics : public TG4VPhysicsConstructor
 
   // set methods
   void SetSelection(const G4String& selection);
+  void SetMaxNofPopsPerStep(G4int maxNofPops);
 
  protected:
   // methods
@@ -54,6 +55,7 @@ class TG4StackPopperPhysics : public TG4VPhysicsConstructor
   TG4StackPopperMessenger fMessenger;  ///< messenger
   TG4StackPopper* fStackPopperProcess; ///< stack popper process
   G4String fSelection;                 ///< particles selection
+  G4int fMaxNofPopsPerStep; ///< maximum number of tracks popped per step
 };
 
 // inline functions
@@ -64,4 +66,10 @@ inline void TG4StackPopperPhysics::SetSelection(const G4String& selection)
   fSelection = selection;
 }
 
+inline void TG4StackPopperPhysics::SetMaxNofPopsPerStep(G4int maxNofPops)
+{
+  /// Set the maximum number of tracks popped per step (0 = no limit)
+  fMaxNofPopsPerStep = maxNofPops;
+}
+
 #endif // TG4_STACK_POPPER_PHYSICS_H
@@ -0,0 +1,217 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4EmDegradation.cxx
+/// \brief Implementation of the TG4EmDegradation class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4EmDegradation.h"
+#include "TG4GeometryServices.h"
+#include "TG4Globals.h"
+#include "TG4MTProfiler.h"
+#include "TG4Medium.h"
+#include "TG4MediumMap.h"
+#include "TG4SDConstruction.h"
+#include "TG4SDManager.h"
+#include "TG4SDServices.h"
+#include "TG4VRegionsManager.h"
+
+#include <G4EmParameters.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4ProductionCuts.hh>
+#include <G4Region.hh>
+#include <G4SystemOfUnits.hh>
+#include <G4UnitsTable.hh>
+
+#ifdef G4MULTITHREADED
+namespace
+{
+// Mutex to lock creating regions
+G4Mutex createRegionsMutex = G4MUTEX_INITIALIZER;
+} // namespace
+#endif
+
+// static data members
+const G4String TG4EmDegradation::fgkPrecisionRegionName = "PrecisionRegion";
+const G4String TG4EmDegradation::fgkBulkRegionName = "BulkRegion";
+const G4String TG4EmDegradation::fgkNoEmOption = "none";
+const G4String TG4EmDegradation::fgkDefaultBulkEmOption = "G4EmStandard_opt1";
+const G4double TG4EmDegradation::fgkDefaultBulkRangeCut = 1. * cm;
+
+//_____________________________________________________________________________
+TG4EmDegradation::TG4EmDegradation()
+  : TG4Verbose("emDegradation"),
+    fMessenger(this),
+    fIsActive(false),
+    fBulkEmOption(fgkDefaultBulkEmOption),
+    fPrecisionEmOption(fgkNoEmOption),
+    fBulkRangeCut(fgkDefaultBulkRangeCut),
+    fCreateRegionsDone(false)
+{
+  /// Default constructor
+}
+
+//_____________________________________________________________________________
+TG4EmDegradation::~TG4EmDegradation()
+{
+  /// Destructor
+}
+
+//
+// static methods
+//
+
+//_____________________________________________________________________________
+G4String TG4EmDegradation::AvailableEmOptions()
+{
+  /// Return the EM options which can be applied per region
+
+  return G4String("G4EmStandard G4EmStandard_opt1 G4EmStandard_opt2 ") +
+         G4String("G4EmStandard_opt3 G4EmStandard_opt4 G4EmStandardGS ") +
+         G4String("G4EmStandardSS G4EmLivermore G4EmPenelope ") +
+         fgkNoEmOption;
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+G4bool TG4EmDegradation::IsPrecisionVolume(G4LogicalVolume* lv) const
+{
+  /// Return true if the given logical volume is sensitive
+
+  // tracking medium sensitive volume flag
+  TG4Medium* medium =
+    TG4GeometryServices::Instance()->GetMediumMap()->GetMedium(lv, false);
+  if (medium && medium->GetIsvol() > 0) return true;
+
+  // user sensitive detector
+  if (TG4SDServices::Instance()->GetUserSD(lv->GetName(), false)) return true;
+
+  // SD selection
+  if (TG4SDManager::Instance()->GetSDConstruction()->HasSelection() &&
+      lv->GetSensitiveDetector()) {
+    return true;
+  }
+
+  return false;
+}
+
+//_____________________________________________________________________________
+void TG4EmDegradation::PrintRegion(const G4String& regionName,
+  const std::vector<G4LogicalVolume*>& volumes) const
+{
+  /// Print the region composition
+
+  G4cout << "Region " << regionName << ": " << volumes.size() << " volumes";
+  if (VerboseLevel() > 1) {
+    G4cout << ":";
+    for (auto lv : volumes) {
+      G4cout << " " << lv->GetName();
+    }
+  }
+  G4cout << G4endl;
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4EmDegradation::CreateRegions()
+{
+  /// Create the precision and bulk regions and apply the region specific
+  /// production cut and EM options
+
+  if (!fIsActive) return;
+
+  // Return if regions were already created
+  if (fCreateRegionsDone) return;
+
+  if (VerboseLevel() > 1) {
+    G4cout << "TG4EmDegradation::CreateRegions" << G4endl;
+  }
+
+  // Do not create regions if special cuts per material are defined
+  if (TG4VRegionsManager::Instance()) {
+    TG4Globals::Warning("TG4EmDegradation", "CreateRegions",
+      "Regions with special cuts are defined." + TG4Globals::Endl() +
+        "The precision and bulk regions will not be created.");
+    fCreateRegionsDone = true;
+    return;
+  }
+
+#ifdef G4MULTITHREADED
+  G4AutoLock lm(&createRegionsMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "EmDegradation::CreateRegions");
+  if (!fCreateRegionsDone) {
+#endif
+    // Sort logical volumes
+    std::vector<G4LogicalVolume*> precisionVolumes;
+    std::vector<G4LogicalVolume*> bulkVolumes;
+    std::vector<G4LogicalVolume*> keptVolumes;
+    G4LogicalVolumeStore* lvStore = G4LogicalVolumeStore::GetInstance();
+    for (auto lv : *lvStore) {
+      // Keep the volumes which already define a region
+      if (lv->IsRootRegion()) {
+        keptVolumes.push_back(lv);
+        continue;
+      }
+
+      if (IsPrecisionVolume(lv)) {
+        precisionVolumes.push_back(lv);
+      }
+      else {
+        bulkVolumes.push_back(lv);
+      }
+    }
+
+    // Create regions
+    auto precisionRegion = new G4Region(fgkPrecisionRegionName);
+    for (auto lv : precisionVolumes) {
+      precisionRegion->AddRootLogicalVolume(lv);
+    }
+
+    auto bulkRegion = new G4Region(fgkBulkRegionName);
+    for (auto lv : bulkVolumes) {
+      bulkRegion->AddRootLogicalVolume(lv);
+    }
+    auto bulkCuts = new G4ProductionCuts();
+    bulkCuts->SetProductionCut(fBulkRangeCut);
+    bulkRegion->SetProductionCuts(bulkCuts);
+
+    // Apply EM options
+    G4EmParameters* emParameters = G4EmParameters::Instance();
+    if (fBulkEmOption != fgkNoEmOption) {
+      emParameters->AddPhysics(fgkBulkRegionName, fBulkEmOption);
+    }
+    if (fPrecisionEmOption != fgkNoEmOption) {
+      emParameters->AddPhysics(fgkPrecisionRegionName, fPrecisionEmOption);
+    }
+
+    if (VerboseLevel() > 0) {
+      PrintRegion(fgkPrecisionRegionName, precisionVolumes);
+      PrintRegion(fgkBulkRegionName, bulkVolumes);
+      G4cout << "Bulk region range cut: "
+             << G4BestUnit(fBulkRangeCut, "Length")
+             << ", EM option: " << fBulkEmOption << G4endl;
+      G4cout << "Precision region EM option: " << fPrecisionEmOption << G4endl;
+      G4cout << "Volumes kept in their regions: " << keptVolumes.size()
+             << G4endl;
+    }
+
+    fCreateRegionsDone = true;
+#ifdef G4MULTITHREADED
+    lm.unlock();
+  }
+#endif
+}
@@ -0,0 +1,124 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4EmDegradationMessenger.cxx
+/// \brief Implementation of the TG4EmDegradationMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4EmDegradationMessenger.h"
+#include "TG4EmDegradation.h"
+
+#include <G4UIcmdWithABool.hh>
+#include <G4UIcmdWithADoubleAndUnit.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIdirectory.hh>
+
+//______________________________________________________________________________
+TG4EmDegradationMessenger::TG4EmDegradationMessenger(
+  TG4EmDegradation* emDegradation)
+  : G4UImessenger(),
+    fEmDegradation(emDegradation),
+    fDirectory(0),
+    fActivateCmd(0),
+    fSetBulkEmOptionCmd(0),
+    fSetPrecisionEmOptionCmd(0),
+    fSetBulkRangeCutCmd(0)
+{
+  /// Standard constructor
+
+  fDirectory = new G4UIdirectory("/mcPhysics/emDegradation/");
+  fDirectory->SetGuidance(
+    "Automatic EM physics degradation outside sensitive volumes.");
+
+  fActivateCmd =
+    new G4UIcmdWithABool("/mcPhysics/emDegradation/activate", this);
+  fActivateCmd->SetGuidance(
+    "Activate building the precision and bulk regions at initialization:");
+  fActivateCmd->SetGuidance(
+    "the volumes which are sensitive (via the SD selection or user SDs)");
+  fActivateCmd->SetGuidance(
+    "or have a medium with isvol > 0 are put in the precision region,");
+  fActivateCmd->SetGuidance("the other volumes in the bulk region.");
+  fActivateCmd->SetParameterName("Activate", true);
+  fActivateCmd->SetDefaultValue(true);
+  fActivateCmd->AvailableForStates(G4State_PreInit);
+  fActivateCmd->SetToBeBroadcasted(false);
+
+  G4String candidates = TG4EmDegradation::AvailableEmOptions();
+
+  fSetBulkEmOptionCmd =
+    new G4UIcmdWithAString("/mcPhysics/emDegradation/setBulkEmOption", this);
+  fSetBulkEmOptionCmd->SetGuidance(
+    "Set the EM physics option applied in the bulk region");
+  fSetBulkEmOptionCmd->SetGuidance("(none = keep the physics list option).");
+  fSetBulkEmOptionCmd->SetParameterName("EmOption", false);
+  fSetBulkEmOptionCmd->SetCandidates(candidates);
+  fSetBulkEmOptionCmd->AvailableForStates(G4State_PreInit);
+  fSetBulkEmOptionCmd->SetToBeBroadcasted(false);
+
+  fSetPrecisionEmOptionCmd = new G4UIcmdWithAString(
+    "/mcPhysics/emDegradation/setPrecisionEmOption", this);
+  fSetPrecisionEmOptionCmd->SetGuidance(
+    "Set the EM physics option applied in the precision region");
+  fSetPrecisionEmOptionCmd->SetGuidance(
+    "(none = keep the physics list option).");
+  fSetPrecisionEmOptionCmd->SetParameterName("EmOption", false);
+  fSetPrecisionEmOptionCmd->SetCandidates(candidates);
+  fSetPrecisionEmOptionCmd->AvailableForStates(G4State_PreInit);
+  fSetPrecisionEmOptionCmd->SetToBeBroadcasted(false);
+
+  fSetBulkRangeCutCmd = new G4UIcmdWithADoubleAndUnit(
+    "/mcPhysics/emDegradation/setBulkRangeCut", this);
+  fSetBulkRangeCutCmd->SetGuidance(
+    "Set the production range cut applied in the bulk region.");
+  fSetBulkRangeCutCmd->SetParameterName("RangeCut", false);
+  fSetBulkRangeCutCmd->SetDefaultUnit("mm");
+  fSetBulkRangeCutCmd->SetUnitCategory("Length");
+  fSetBulkRangeCutCmd->SetRange("RangeCut > 0");
+  fSetBulkRangeCutCmd->AvailableForStates(G4State_PreInit);
+  fSetBulkRangeCutCmd->SetToBeBroadcasted(false);
+}
+
+//______________________________________________________________________________
+TG4EmDegradationMessenger::~TG4EmDegradationMessenger()
+{
+  /// Destructor
+
+  delete fDirectory;
+  delete fActivateCmd;
+  delete fSetBulkEmOptionCmd;
+  delete fSetPrecisionEmOptionCmd;
+  delete fSetBulkRangeCutCmd;
+}
+
+//
+// public methods
+//
+
+//______________________________________________________________________________
+void TG4EmDegradationMessenger::SetNewValue(
+  G4UIcommand* command, G4String newValue)
+{
+  /// Apply command to the associated object.
+
+  if (command == fActivateCmd) {
+    fEmDegradation->SetIsActive(fActivateCmd->GetNewBoolValue(newValue));
+  }
+  else if (command == fSetBulkEmOptionCmd) {
+    fEmDegradation->SetBulkEmOption(newValue);
+  }
+  else if (command == fSetPrecisionEmOptionCmd) {
+    fEmDegradation->SetPrecisionEmOption(newValue);
+  }
+  else if (command == fSetBulkRangeCutCmd) {
+    fEmDegradation->SetBulkRangeCut(
+      fSetBulkRangeCutCmd->GetNewDoubleValue(newValue));
+  }
+}
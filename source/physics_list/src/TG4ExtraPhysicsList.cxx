@@ -13,8 +13,11 @@
 /// \author I. Hrivnacova; IPN, Orsay
 
 #include "TG4ExtraPhysicsList.h"
+#include "TG4BiasingManager.h"
 #include "TG4G3Units.h"
+#include "TG4GeometryManager.h"
 #include "TG4Globals.h"
+#include "TG4ImportanceBiasingManager.h"
 
 #include <G4EmExtraPhysics.hh>
 #include <G4GenericBiasingPhysics.hh>
@@ -27,6 +30,7 @@
 #include <G4ProcessManager.hh>
 #include <G4ProcessTable.hh>
 #include <G4SystemOfUnits.hh>
+#include <G4Threading.hh>
 
 // According to G4VModularPhysicsList.cc
 #include <G4StateManager.hh>
@@ -103,7 +107,9 @@ G4bool TG4ExtraPhysicsList::IsAvailableSelection(const G4String& selection)
 //_____________________________________________________________________________
 TG4ExtraPhysicsList::TG4ExtraPhysicsList(
   const G4String& selection, const std::map<TString, Double_t>& parameters)
-  : G4VModularPhysicsList(), TG4Verbose("extraPhysicsList")
+  : G4VModularPhysicsList(),
+    TG4Verbose("extraPhysicsList"),
+    fBiasingPhysics(0)
 {
   /// Default constructor
 
@@ -132,14 +138,10 @@ void TG4ExtraPhysicsList::Configure(
   /// and registeres them in the modular physics list.
 
   // Generic biasing physics
+  // (the biased particles are set in ConfigureBiasing())
   if (G4StrUtil::contains(selection, "biasing")) {
-    G4GenericBiasingPhysics* biasingPhysics = new G4GenericBiasingPhysics;
-    // we may need to make this configurable later
-    biasingPhysics->Bias("proton");
-    biasingPhysics->Bias("neutron");
-    biasingPhysics->Bias("pi+");
-    biasingPhysics->Bias("pi-");
-    RegisterPhysics(biasingPhysics);
+    fBiasingPhysics = new G4GenericBiasingPhysics;
+    RegisterPhysics(fBiasingPhysics);
   }
 
   // Extra electromagnetic physics
@@ -183,6 +185,49 @@ void TG4ExtraPhysicsList::Configure(
   }
 }
 
+//_____________________________________________________________________________
+void TG4ExtraPhysicsList::ConfigureBiasing()
+{
+  /// Set the particles selected in the biasing manager to the generic
+  /// biasing physics; only their inelastic processes are wrapped, as the
+  /// biasing operation replaces only the inelastic final state.
+  /// The particles selected for the importance biasing are wrapped
+  /// with the non-physics biasing process.
+  /// The physics constructor is shared by all threads and so it is
+  /// configured only on master.
+
+  auto geometryManager = TG4GeometryManager::Instance();
+  if (!geometryManager) return;
+
+  // the physics biasing is applied only if a biasing model is selected
+  auto biasingManager = geometryManager->GetBiasingManager();
+  if (biasingManager->GetVector().size()) {
+    for (const auto& particleName : biasingManager->GetParticles()) {
+      std::vector<G4String> processNames;
+      processNames.push_back(particleName + "Inelastic");
+      fBiasingPhysics->PhysicsBias(particleName, processNames);
+
+      if (VerboseLevel() > 1) {
+        G4cout << "Biasing physics: " << particleName << "Inelastic"
+               << G4endl;
+      }
+    }
+  }
+
+  // the importance biasing requires the non-physics biasing process
+  auto importanceManager = geometryManager->GetImportanceBiasingManager();
+  if (importanceManager->IsActive()) {
+    for (const auto& particleName : importanceManager->GetParticles()) {
+      fBiasingPhysics->NonPhysicsBias(particleName);
+
+      if (VerboseLevel() > 1) {
+        G4cout << "Biasing physics: non-physics biasing for " << particleName
+               << G4endl;
+      }
+    }
+  }
+}
+
 //
 // public methods
 //
@@ -192,6 +237,11 @@ void TG4ExtraPhysicsList::ConstructProcess()
 {
   /// Call base class method + add verbose info
 
+  // set the biased particles before the biasing processes are created
+  if (fBiasingPhysics && G4Threading::IsMasterThread()) {
+    ConfigureBiasing();
+  }
+
   // create processes for registered physics
   // G4VModularPhysicsList::ConstructProcess();
   G4PhysConstVector::iterator itr;
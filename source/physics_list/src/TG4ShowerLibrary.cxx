@@ -0,0 +1,372 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ShowerLibrary.cxx
+/// \brief Implementation of the TG4ShowerLibrary class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4ShowerLibrary.h"
+#include "TG4Globals.h"
+
+#include <G4SystemOfUnits.hh>
+
+#include <cmath>
+#include <fstream>
+
+namespace
+{
+
+template <typename T>
+void WriteValue(std::ofstream& out, const T& value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void ReadValue(std::ifstream& in, T& value)
+{
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+// Throw an exception if reading the file failed or the read data
+// are not valid
+void CheckRead(const std::ifstream& in, G4bool isValid,
+  const G4String& fileName, const TString& what)
+{
+  if (in && isValid) return;
+
+  TG4Globals::Exception("TG4ShowerLibrary", "Read",
+    "Reading file " + TString(fileName.data()) + " failed: wrong " + what +
+      ".");
+}
+
+// Return the number of bytes remaining to be read in the file
+G4long GetRemainingSize(std::ifstream& in, G4long fileSize)
+{
+  return fileSize - G4long(in.tellg());
+}
+
+} // namespace
+
+const G4String TG4ShowerLibrary::fgkFileId = "TG4ShowerLibrary";
+const G4int TG4ShowerLibrary::fgkFileVersion = 1;
+const G4int TG4ShowerLibrary::fgkParticlePdgs[fgkNofParticles] = { 22, 11,
+  -11 };
+
+//_____________________________________________________________________________
+TG4ShowerLibrary::TG4ShowerLibrary()
+  : fNofEnergyBins(10),
+    fMinEnergy(1. * GeV),
+    fMaxEnergy(1. * TeV),
+    fNofAngleBins(18),
+    fBins(),
+    fShowers(),
+    fSpots()
+{
+  /// Default constructor
+
+  ResetBins();
+}
+
+//_____________________________________________________________________________
+TG4ShowerLibrary::~TG4ShowerLibrary()
+{
+  /// Destructor
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+G4int TG4ShowerLibrary::GetParticleIndex(G4int pdgEncoding) const
+{
+  /// Return the index of the particle type or -1 if the particle is not
+  /// handled by the library
+
+  for (G4int i = 0; i < fgkNofParticles; ++i) {
+    if (fgkParticlePdgs[i] == pdgEncoding) return i;
+  }
+  return -1;
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibrary::ResetBins()
+{
+  /// Clear the library and reset the bins vector for the current binning
+
+  fShowers.clear();
+  fSpots.clear();
+  fBins.clear();
+  fBins.resize(fgkNofParticles * fNofEnergyBins * fNofAngleBins);
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+G4bool TG4ShowerLibrary::Read(const G4String& fileName)
+{
+  /// Read the library from the binary file;
+  /// the binning defined in the file overrides the current binning.
+  /// Return false if the file cannot be open; an exception is thrown
+  /// if the file has a wrong format or its content is not consistent.
+
+  std::ifstream in(fileName, std::ios::in | std::ios::binary);
+  if (!in) {
+    TG4Globals::Warning("TG4ShowerLibrary", "Read",
+      "Cannot open file " + TString(fileName.data()));
+    return false;
+  }
+  in.seekg(0, std::ios::end);
+  G4long fileSize = in.tellg();
+  in.seekg(0, std::ios::beg);
+
+  // file header
+  std::vector<char> fileId(fgkFileId.size());
+  in.read(fileId.data(), fileId.size());
+  G4int version = 0;
+  ReadValue(in, version);
+  CheckRead(in,
+    std::string(fileId.data(), fileId.size()) == fgkFileId &&
+      version == fgkFileVersion,
+    fileName, "file identification or version");
+
+  // binning
+  ReadValue(in, fNofEnergyBins);
+  ReadValue(in, fMinEnergy);
+  ReadValue(in, fMaxEnergy);
+  ReadValue(in, fNofAngleBins);
+  // each bin has at least its size written in the file
+  G4double nofBins = G4double(fgkNofParticles) * fNofEnergyBins * fNofAngleBins;
+  CheckRead(in,
+    fNofEnergyBins > 0 && fNofAngleBins > 0 && fMinEnergy > 0. &&
+      fMaxEnergy > fMinEnergy &&
+      nofBins * sizeof(G4int) <= GetRemainingSize(in, fileSize),
+    fileName, "binning");
+  ResetBins();
+
+  // showers
+  G4int nofShowers = 0;
+  G4int nofSpots = 0;
+  ReadValue(in, nofShowers);
+  ReadValue(in, nofSpots);
+  CheckRead(in,
+    nofShowers >= 0 && nofSpots >= 0 &&
+      nofShowers * G4long(sizeof(Shower)) + nofSpots * G4long(sizeof(Spot)) <=
+        GetRemainingSize(in, fileSize),
+    fileName, "number of showers or spots");
+  fShowers.resize(nofShowers);
+  fSpots.resize(nofSpots);
+
+  for (auto& bin : fBins) {
+    G4int nofBinShowers = 0;
+    ReadValue(in, nofBinShowers);
+    CheckRead(in, nofBinShowers >= 0 && nofBinShowers <= nofShowers,
+      fileName, "number of showers in a bin");
+    bin.resize(nofBinShowers);
+    in.read(
+      reinterpret_cast<char*>(bin.data()), nofBinShowers * sizeof(G4int));
+    for (auto showerIndex : bin) {
+      CheckRead(in, showerIndex >= 0 && showerIndex < nofShowers, fileName,
+        "shower index");
+    }
+  }
+
+  in.read(
+    reinterpret_cast<char*>(fShowers.data()), nofShowers * sizeof(Shower));
+  for (const auto& shower : fShowers) {
+    CheckRead(in,
+      shower.fFirstSpot >= 0 && shower.fNofSpots >= 0 &&
+        G4long(shower.fFirstSpot) + shower.fNofSpots <= nofSpots,
+      fileName, "shower spots");
+  }
+
+  in.read(reinterpret_cast<char*>(fSpots.data()), nofSpots * sizeof(Spot));
+  CheckRead(in, true, fileName, "spots");
+
+  return true;
+}
+
+//_____________________________________________________________________________
+G4bool TG4ShowerLibrary::Write(const G4String& fileName) const
+{
+  /// Write the library in the binary file.
+  /// Return false if the file cannot be open.
+
+  std::ofstream out(fileName, std::ios::out | std::ios::binary);
+  if (!out) {
+    TG4Globals::Warning("TG4ShowerLibrary", "Write",
+      "Cannot open file " + TString(fileName.data()));
+    return false;
+  }
+
+  // file header
+  out.write(fgkFileId.data(), fgkFileId.size());
+  WriteValue(out, fgkFileVersion);
+
+  // binning
+  WriteValue(out, fNofEnergyBins);
+  WriteValue(out, fMinEnergy);
+  WriteValue(out, fMaxEnergy);
+  WriteValue(out, fNofAngleBins);
+
+  // showers
+  WriteValue(out, G4int(fShowers.size()));
+  WriteValue(out, G4int(fSpots.size()));
+  for (const auto& bin : fBins) {
+    WriteValue(out, G4int(bin.size()));
+    out.write(
+      reinterpret_cast<const char*>(bin.data()), bin.size() * sizeof(G4int));
+  }
+  out.write(reinterpret_cast<const char*>(fShowers.data()),
+    fShowers.size() * sizeof(Shower));
+  out.write(
+    reinterpret_cast<const char*>(fSpots.data()), fSpots.size() * sizeof(Spot));
+
+  return out.good();
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibrary::AddShower(
+  G4int binIndex, G4double energy, const std::vector<Spot>& spots)
+{
+  /// Add the shower with the given spots in the bin with the given index
+
+  if (binIndex < 0 || binIndex >= G4int(fBins.size())) return;
+
+  Shower shower;
+  shower.fEnergy = energy;
+  shower.fFirstSpot = G4int(fSpots.size());
+  shower.fNofSpots = G4int(spots.size());
+
+  fBins[binIndex].push_back(G4int(fShowers.size()));
+  fShowers.push_back(shower);
+  fSpots.insert(fSpots.end(), spots.begin(), spots.end());
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibrary::Clear()
+{
+  /// Remove all showers from the library
+
+  ResetBins();
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibrary::Print() const
+{
+  /// Print the library binning and its content
+
+  G4cout << "Shower library: " << fShowers.size() << " showers, "
+         << fSpots.size() << " spots" << G4endl;
+  G4cout << "  energy bins: " << fNofEnergyBins << " in ["
+         << fMinEnergy / GeV << ", " << fMaxEnergy / GeV << "] GeV"
+         << "  angle bins: " << fNofAngleBins << G4endl;
+
+  for (G4int ip = 0; ip < fgkNofParticles; ++ip) {
+    G4int nofShowers = 0;
+    G4int nofEmptyBins = 0;
+    for (G4int ib = 0; ib < fNofEnergyBins * fNofAngleBins; ++ib) {
+      G4int binSize = fBins[ip * fNofEnergyBins * fNofAngleBins + ib].size();
+      nofShowers += binSize;
+      if (!binSize) ++nofEmptyBins;
+    }
+    G4cout << "  PDG " << fgkParticlePdgs[ip] << ": " << nofShowers
+           << " showers, " << nofEmptyBins << " empty bins" << G4endl;
+  }
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibrary::SetEnergyBinning(
+  G4int nofBins, G4double minEnergy, G4double maxEnergy)
+{
+  /// Set the logarithmic energy binning.
+  /// The library content is cleared.
+
+  if (nofBins <= 0 || minEnergy <= 0. || maxEnergy <= minEnergy) {
+    TG4Globals::Warning("TG4ShowerLibrary", "SetEnergyBinning",
+      "Wrong energy binning, setting is ignored.");
+    return;
+  }
+
+  fNofEnergyBins = nofBins;
+  fMinEnergy = minEnergy;
+  fMaxEnergy = maxEnergy;
+  ResetBins();
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibrary::SetNofAngleBins(G4int nofBins)
+{
+  /// Set the number of uniform polar angle bins.
+  /// The library content is cleared.
+
+  if (nofBins <= 0) {
+    TG4Globals::Warning("TG4ShowerLibrary", "SetNofAngleBins",
+      "Wrong number of angle bins, setting is ignored.");
+    return;
+  }
+
+  fNofAngleBins = nofBins;
+  ResetBins();
+}
+
+//_____________________________________________________________________________
+G4int TG4ShowerLibrary::GetBinIndex(
+  G4int pdgEncoding, G4double energy, G4double theta) const
+{
+  /// Return the bin index for the given particle type, kinetic energy
+  /// and polar angle or -1 if outside the library binning
+
+  G4int particleIndex = GetParticleIndex(pdgEncoding);
+  if (particleIndex < 0) return -1;
+
+  if (energy < fMinEnergy || energy >= fMaxEnergy) return -1;
+
+  G4int energyIndex = G4int(fNofEnergyBins * std::log(energy / fMinEnergy) /
+                            std::log(fMaxEnergy / fMinEnergy));
+  G4int angleIndex = G4int(fNofAngleBins * theta / CLHEP::pi);
+  if (energyIndex >= fNofEnergyBins) energyIndex = fNofEnergyBins - 1;
+  if (angleIndex >= fNofAngleBins) angleIndex = fNofAngleBins - 1;
+
+  return (particleIndex * fNofEnergyBins + energyIndex) * fNofAngleBins +
+         angleIndex;
+}
+
+//_____________________________________________________________________________
+G4int TG4ShowerLibrary::GetNofShowers(G4int binIndex) const
+{
+  /// Return the number of showers in the bin with the given index
+
+  if (binIndex < 0 || binIndex >= G4int(fBins.size())) return 0;
+
+  return G4int(fBins[binIndex].size());
+}
+
+//_____________________________________________________________________________
+const TG4ShowerLibrary::Spot* TG4ShowerLibrary::GetShower(
+  G4int binIndex, G4int showerIndex, G4int& nofSpots) const
+{
+  /// Return the pointer to the first spot of the shower with the given
+  /// index in the given bin and fill the number of spots.
+  /// Return 0 if the shower does not exist.
+
+  nofSpots = 0;
+  if (showerIndex < 0 || showerIndex >= GetNofShowers(binIndex)) return 0;
+
+  const Shower& shower = fShowers[fBins[binIndex][showerIndex]];
+  nofSpots = shower.fNofSpots;
+
+  if (!nofSpots) return 0;
+
+  return &fSpots[shower.fFirstSpot];
+}
@@ -0,0 +1,54 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ShowerLibraryFastSimulation.cxx
+/// \brief Implementation of the TG4ShowerLibraryFastSimulation class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4ShowerLibraryFastSimulation.h"
+#include "TG4ShowerLibraryMessenger.h"
+#include "TG4ShowerLibraryModel.h"
+
+//_____________________________________________________________________________
+TG4ShowerLibraryFastSimulation::TG4ShowerLibraryFastSimulation()
+  : TG4VUserFastSimulation(), fMessenger(0), fShowerLibraryModel(0)
+{
+  /// Standard constructor
+
+  // create the model in contsructor
+  // to make available its messenger commands
+  fShowerLibraryModel = new TG4ShowerLibraryModel("ShowerLibraryModel");
+  // region will be set via the model configuration
+
+  fMessenger = new TG4ShowerLibraryMessenger(fShowerLibraryModel);
+}
+
+//_____________________________________________________________________________
+TG4ShowerLibraryFastSimulation::~TG4ShowerLibraryFastSimulation()
+{
+  /// Destructor
+
+  delete fMessenger;
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+void TG4ShowerLibraryFastSimulation::Construct()
+{
+  /// Initialize the shower library model and register it to VMC framework
+
+  fShowerLibraryModel->Initialize();
+
+  // Register model in VMC frameworks
+  Register(fShowerLibraryModel);
+}
@@ -0,0 +1,209 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ShowerLibraryMessenger.cxx
+/// \brief Implementation of the TG4ShowerLibraryMessenger class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4ShowerLibraryMessenger.h"
+#include "TG4ShowerLibraryModel.h"
+
+#include <G4AnalysisUtilities.hh>
+#include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
+#include <G4UIcmdWithoutParameter.hh>
+#include <G4UIdirectory.hh>
+#include <G4UnitsTable.hh>
+
+//______________________________________________________________________________
+TG4ShowerLibraryMessenger::TG4ShowerLibraryMessenger(
+  TG4ShowerLibraryModel* showerLibraryModel)
+  : G4UImessenger(),
+    fShowerLibraryModel(showerLibraryModel),
+    fDirectory(0),
+    fSetModeCmd(0),
+    fSetFileNameCmd(0),
+    fSetEnergyBinningCmd(0),
+    fSetNofAngleBinsCmd(0),
+    fSetSpotSizeCmd(0),
+    fSaveCmd(0),
+    fPrintCmd(0)
+{
+  /// Standard constructor
+
+  fDirectory = new G4UIdirectory("/mcPhysics/showerLibrary/");
+  fDirectory->SetGuidance("Shower library fast simulation model commands.");
+
+  fSetModeCmd =
+    new G4UIcmdWithAString("/mcPhysics/showerLibrary/setMode", this);
+  fSetModeCmd->SetGuidance("Set the shower library model mode:");
+  fSetModeCmd->SetGuidance("record: record the fully simulated showers;");
+  fSetModeCmd->SetGuidance("replay: replace showers with the library ones.");
+  fSetModeCmd->SetParameterName("Mode", false);
+  fSetModeCmd->SetCandidates("record replay");
+  fSetModeCmd->AvailableForStates(G4State_PreInit);
+
+  fSetFileNameCmd =
+    new G4UIcmdWithAString("/mcPhysics/showerLibrary/setFileName", this);
+  fSetFileNameCmd->SetGuidance("Set the shower library file name.");
+  fSetFileNameCmd->SetParameterName("FileName", false);
+  fSetFileNameCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+  CreateSetEnergyBinningCmd();
+
+  fSetNofAngleBinsCmd =
+    new G4UIcmdWithAnInteger("/mcPhysics/showerLibrary/setNofAngleBins", this);
+  fSetNofAngleBinsCmd->SetGuidance(
+    "Set the number of polar angle bins of the shower library.");
+  fSetNofAngleBinsCmd->SetParameterName("NofAngleBins", false);
+  fSetNofAngleBinsCmd->SetRange("NofAngleBins > 0");
+  fSetNofAngleBinsCmd->AvailableForStates(G4State_PreInit);
+
+  CreateSetSpotSizeCmd();
+
+  fSaveCmd = new G4UIcmdWithoutParameter("/mcPhysics/showerLibrary/save", this);
+  fSaveCmd->SetGuidance("Save the recorded showers in the library file.");
+  fSaveCmd->AvailableForStates(G4State_Idle);
+  fSaveCmd->SetToBeBroadcasted(false);
+
+  fPrintCmd =
+    new G4UIcmdWithoutParameter("/mcPhysics/showerLibrary/print", this);
+  fPrintCmd->SetGuidance("Print the shower library content.");
+  fPrintCmd->AvailableForStates(G4State_Idle);
+  fPrintCmd->SetToBeBroadcasted(false);
+}
+
+//______________________________________________________________________________
+TG4ShowerLibraryMessenger::~TG4ShowerLibraryMessenger()
+{
+  /// Destructor
+
+  delete fDirectory;
+  delete fSetModeCmd;
+  delete fSetFileNameCmd;
+  delete fSetEnergyBinningCmd;
+  delete fSetNofAngleBinsCmd;
+  delete fSetSpotSizeCmd;
+  delete fSaveCmd;
+  delete fPrintCmd;
+}
+
+//
+// private methods
+//
+
+//______________________________________________________________________________
+void TG4ShowerLibraryMessenger::CreateSetEnergyBinningCmd()
+{
+  /// Create setEnergyBinning command
+
+  auto nofBins = new G4UIparameter("nofBins", 'i', false);
+  nofBins->SetGuidance("Number of energy bins.");
+
+  auto minEnergy = new G4UIparameter("minEnergy", 'd', false);
+  minEnergy->SetGuidance("Minimum energy.");
+
+  auto maxEnergy = new G4UIparameter("maxEnergy", 'd', false);
+  maxEnergy->SetGuidance("Maximum energy.");
+
+  auto energyUnit = new G4UIparameter("energyUnit", 's', false);
+  energyUnit->SetGuidance("Energy unit.");
+
+  fSetEnergyBinningCmd =
+    new G4UIcommand("/mcPhysics/showerLibrary/setEnergyBinning", this);
+  fSetEnergyBinningCmd->SetGuidance(
+    "Set the logarithmic energy binning of the shower library.");
+  fSetEnergyBinningCmd->SetParameter(nofBins);
+  fSetEnergyBinningCmd->SetParameter(minEnergy);
+  fSetEnergyBinningCmd->SetParameter(maxEnergy);
+  fSetEnergyBinningCmd->SetParameter(energyUnit);
+  fSetEnergyBinningCmd->AvailableForStates(G4State_PreInit);
+}
+
+//______________________________________________________________________________
+void TG4ShowerLibraryMessenger::CreateSetSpotSizeCmd()
+{
+  /// Create setSpotSize command
+
+  auto length = new G4UIparameter("length", 'd', false);
+  length->SetGuidance("Spot cell longitudinal size.");
+
+  auto radius = new G4UIparameter("radius", 'd', false);
+  radius->SetGuidance("Spot cell radial size.");
+
+  auto lengthUnit = new G4UIparameter("lengthUnit", 's', false);
+  lengthUnit->SetGuidance("Length unit.");
+
+  fSetSpotSizeCmd =
+    new G4UIcommand("/mcPhysics/showerLibrary/setSpotSize", this);
+  fSetSpotSizeCmd->SetGuidance(
+    "Set the spot cell size used when recording showers.");
+  fSetSpotSizeCmd->SetParameter(length);
+  fSetSpotSizeCmd->SetParameter(radius);
+  fSetSpotSizeCmd->SetParameter(lengthUnit);
+  fSetSpotSizeCmd->AvailableForStates(G4State_PreInit);
+}
+
+//
+// public methods
+//
+
+//______________________________________________________________________________
+void TG4ShowerLibraryMessenger::SetNewValue(
+  G4UIcommand* command, G4String newValue)
+{
+  /// Apply command to the associated object.
+
+  if (command == fSetModeCmd) {
+    if (newValue == "record") {
+      fShowerLibraryModel->SetMode(TG4ShowerLibraryModel::kRecord);
+    }
+    else {
+      fShowerLibraryModel->SetMode(TG4ShowerLibraryModel::kReplay);
+    }
+  }
+  else if (command == fSetFileNameCmd) {
+    fShowerLibraryModel->SetFileName(newValue);
+  }
+  else if (command == fSetEnergyBinningCmd) {
+    // tokenize parameters in a vector
+    std::vector<G4String> parameters;
+    G4Analysis::Tokenize(newValue, parameters);
+
+    G4int counter = 0;
+    G4int nofBins = G4UIcommand::ConvertToInt(parameters[counter++]);
+    G4double minEnergy = G4UIcommand::ConvertToDouble(parameters[counter++]);
+    G4double maxEnergy = G4UIcommand::ConvertToDouble(parameters[counter++]);
+    G4double unit = G4UnitDefinition::GetValueOf(parameters[counter++]);
+    fShowerLibraryModel->SetEnergyBinning(
+      nofBins, minEnergy * unit, maxEnergy * unit);
+  }
+  else if (command == fSetNofAngleBinsCmd) {
+    fShowerLibraryModel->SetNofAngleBins(
+      fSetNofAngleBinsCmd->GetNewIntValue(newValue));
+  }
+  else if (command == fSetSpotSizeCmd) {
+    // tokenize parameters in a vector
+    std::vector<G4String> parameters;
+    G4Analysis::Tokenize(newValue, parameters);
+
+    G4int counter = 0;
+    G4double length = G4UIcommand::ConvertToDouble(parameters[counter++]);
+    G4double radius = G4UIcommand::ConvertToDouble(parameters[counter++]);
+    G4double unit = G4UnitDefinition::GetValueOf(parameters[counter++]);
+    fShowerLibraryModel->SetSpotSize(length * unit, radius * unit);
+  }
+  else if (command == fSaveCmd) {
+    fShowerLibraryModel->Save();
+  }
+  else if (command == fPrintCmd) {
+    fShowerLibraryModel->Print();
+  }
+}
@@ -0,0 +1,335 @@
+//------------------------------------------------
+// The Geant4 Virtual Monte Carlo package
+// Copyright (C) 2007 - 2024 Ivana Hrivnacova
+// All rights reserved.
+//
+// For the licensing terms see geant4_vmc/LICENSE.
+// Contact: root-vmc@cern.ch
+//-------------------------------------------------
+
+/// \file TG4ShowerLibraryModel.cxx
+/// \brief Implementation of the TG4ShowerLibraryModel class
+///
+/// \author I. Hrivnacova; IJCLab Orsay
+
+#include "TG4ShowerLibraryModel.h"
+#include "TG4Globals.h"
+#include "TG4MTProfiler.h"
+
+#include <G4AutoLock.hh>
+#include <G4FastStep.hh>
+#include <G4FastTrack.hh>
+#include <G4PhysicalConstants.hh>
+#include <G4Step.hh>
+#include <G4SystemOfUnits.hh>
+#include <G4Track.hh>
+#include <GFlashEnergySpot.hh>
+#include <GFlashHitMaker.hh>
+#include <Randomize.hh>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// Mutex to lock reading and filling the shared library
+G4Mutex showerLibraryMutex = G4MUTEX_INITIALIZER;
+} // namespace
+
+TG4ShowerLibraryModel* TG4ShowerLibraryModel::fgInstance = 0;
+G4ThreadLocal TG4ShowerLibraryModel::Recorder*
+  TG4ShowerLibraryModel::fgRecorder = 0;
+G4ThreadLocal GFlashHitMaker* TG4ShowerLibraryModel::fgHitMaker = 0;
+
+const G4int TG4ShowerLibraryModel::fgkNofPhiCells = 8;
+const G4int TG4ShowerLibraryModel::fgkNofRadialCells = 50;
+const G4int TG4ShowerLibraryModel::fgkNofLongitudinalCells = 200;
+
+//_____________________________________________________________________________
+TG4ShowerLibraryModel::TG4ShowerLibraryModel(const G4String& name)
+  : G4VFastSimulationModel(name),
+    fMode(kReplay),
+    fFileName("showerLibrary.dat"),
+    fSpotLength(5. * mm),
+    fSpotRadius(5. * mm),
+    fIsInitialized(false),
+    fLibrary()
+{
+  /// Standard constructor
+
+  fgInstance = this;
+}
+
+//_____________________________________________________________________________
+TG4ShowerLibraryModel::~TG4ShowerLibraryModel()
+{
+  /// Destructor
+
+  fgInstance = 0;
+}
+
+//
+// private methods
+//
+
+//_____________________________________________________________________________
+G4int TG4ShowerLibraryModel::GetBinIndex(const G4Track* track) const
+{
+  /// Return the library bin index for the given track
+
+  return fLibrary.GetBinIndex(track->GetDefinition()->GetPDGEncoding(),
+    track->GetKineticEnergy(), track->GetMomentumDirection().theta());
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibraryModel::StartShower(const G4Track* track)
+{
+  /// Start recording a new shower if the track does not yet belong
+  /// to a recorded shower and it is within the library binning
+
+  if (!fgRecorder) {
+    fgRecorder = new Recorder();
+  }
+
+  auto& trackToShower = fgRecorder->fTrackToShower;
+
+  // skip the tracks already recorded
+  if (trackToShower.find(track->GetTrackID()) != trackToShower.end()) return;
+
+  // add the descendants of a recorded shower
+  auto it = trackToShower.find(track->GetParentID());
+  if (it != trackToShower.end()) {
+    trackToShower[track->GetTrackID()] = it->second;
+    return;
+  }
+
+  G4int binIndex = GetBinIndex(track);
+  if (binIndex < 0) return;
+
+  RecordedShower shower;
+  shower.fBinIndex = binIndex;
+  shower.fEnergy = track->GetKineticEnergy();
+  shower.fOrigin = track->GetPosition();
+  shower.fAxis = track->GetMomentumDirection();
+  shower.fU = shower.fAxis.orthogonal().unit();
+  shower.fV = shower.fAxis.cross(shower.fU);
+
+  trackToShower[track->GetTrackID()] = G4int(fgRecorder->fShowers.size());
+  fgRecorder->fShowers.push_back(shower);
+}
+
+//
+// public methods
+//
+
+//_____________________________________________________________________________
+G4bool TG4ShowerLibraryModel::IsApplicable(const G4ParticleDefinition& particle)
+{
+  /// The model is applicable to the particles handled by the library
+
+  return fLibrary.IsApplicable(particle.GetPDGEncoding());
+}
+
+//_____________________________________________________________________________
+G4bool TG4ShowerLibraryModel::ModelTrigger(const G4FastTrack& fastTrack)
+{
+  /// In the recording mode, start recording the shower and let the track
+  /// be fully simulated; in the replay mode, trigger the model if there are
+  /// showers in the library bin for the track
+
+  const G4Track* track = fastTrack.GetPrimaryTrack();
+
+  if (fMode == kRecord) {
+    StartShower(track);
+    return false;
+  }
+
+  return fLibrary.GetNofShowers(GetBinIndex(track)) > 0;
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibraryModel::DoIt(
+  const G4FastTrack& fastTrack, G4FastStep& fastStep)
+{
+  /// Replace the track with a shower sampled from the library
+
+  const G4Track* track = fastTrack.GetPrimaryTrack();
+  G4double energy = track->GetKineticEnergy();
+
+  // sample the shower
+  G4int binIndex = GetBinIndex(track);
+  G4int nofShowers = fLibrary.GetNofShowers(binIndex);
+  G4int showerIndex =
+    std::min(G4int(G4UniformRand() * nofShowers), nofShowers - 1);
+  G4int nofSpots = 0;
+  const TG4ShowerLibrary::Spot* spots =
+    fLibrary.GetShower(binIndex, showerIndex, nofSpots);
+
+  // the shower frame, randomly rotated around the axis
+  G4ThreeVector origin = track->GetPosition();
+  G4ThreeVector axis = track->GetMomentumDirection();
+  G4ThreeVector u = axis.orthogonal().unit();
+  G4ThreeVector v = axis.cross(u);
+  G4double phi0 = twopi * G4UniformRand();
+
+  // make spots
+  if (!fgHitMaker) {
+    fgHitMaker = new GFlashHitMaker();
+  }
+  for (G4int i = 0; i < nofSpots; ++i) {
+    G4double phi = spots[i].fPhi + phi0;
+    G4ThreeVector position = origin + spots[i].fLongitudinal * axis +
+                             spots[i].fRadial *
+                               (std::cos(phi) * u + std::sin(phi) * v);
+    GFlashEnergySpot energySpot(position, spots[i].fEnergyFraction * energy);
+    fgHitMaker->make(&energySpot, &fastTrack);
+  }
+
+  // kill the track
+  fastStep.KillPrimaryTrack();
+  fastStep.ProposePrimaryTrackPathLength(0.0);
+  fastStep.ProposeTotalEnergyDeposited(energy);
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibraryModel::Initialize()
+{
+  /// Read the library from the file in the replay mode.
+  /// This function is called from each thread, the library is read only once.
+
+  G4AutoLock lm(&showerLibraryMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "ShowerLibraryModel::Initialize");
+
+  if (fIsInitialized) return;
+  fIsInitialized = true;
+
+  if (fMode == kRecord) {
+    G4cout << "### Shower library model: recording showers" << G4endl;
+    return;
+  }
+
+  if (fLibrary.Read(fFileName)) {
+    G4cout << "### Shower library model: read library from " << fFileName
+           << G4endl;
+    fLibrary.Print();
+  }
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibraryModel::RecordStep(const G4Step* step)
+{
+  /// Add the step energy deposit to the recorded shower which the track
+  /// belongs to
+
+  if (!fgRecorder || !fgRecorder->fShowers.size()) return;
+
+  const G4Track* track = step->GetTrack();
+  auto& trackToShower = fgRecorder->fTrackToShower;
+
+  // get the shower, add the descendants of a recorded shower
+  auto it = trackToShower.find(track->GetTrackID());
+  if (it == trackToShower.end()) {
+    auto itp = trackToShower.find(track->GetParentID());
+    if (itp == trackToShower.end()) return;
+    it = trackToShower.insert(
+      std::make_pair(track->GetTrackID(), itp->second)).first;
+  }
+
+  G4double edep = step->GetTotalEnergyDeposit();
+  if (edep <= 0.) return;
+
+  // the step position in the shower frame
+  RecordedShower& shower = fgRecorder->fShowers[it->second];
+  G4ThreeVector position = 0.5 * (step->GetPreStepPoint()->GetPosition() +
+                                   step->GetPostStepPoint()->GetPosition()) -
+                           shower.fOrigin;
+  G4double longitudinal = position.dot(shower.fAxis);
+  G4ThreeVector transverse = position - longitudinal * shower.fAxis;
+  G4double phi =
+    std::atan2(transverse.dot(shower.fV), transverse.dot(shower.fU));
+  if (phi < 0.) phi += twopi;
+
+  // the spot cell
+  G4int il = std::max(G4int(longitudinal / fSpotLength), 0);
+  il = std::min(il, fgkNofLongitudinalCells - 1);
+  G4int ir =
+    std::min(G4int(transverse.mag() / fSpotRadius), fgkNofRadialCells - 1);
+  G4int iphi =
+    std::min(G4int(phi / twopi * fgkNofPhiCells), fgkNofPhiCells - 1);
+
+  shower.fEdep[(il * fgkNofRadialCells + ir) * fgkNofPhiCells + iphi] += edep;
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibraryModel::EndOfEvent()
+{
+  /// Add the showers recorded in this event to the library
+
+  if (!fgRecorder) return;
+
+  G4AutoLock lm(&showerLibraryMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "ShowerLibraryModel::EndOfEvent");
+
+  for (const auto& shower : fgRecorder->fShowers) {
+    std::vector<TG4ShowerLibrary::Spot> spots;
+    spots.reserve(shower.fEdep.size());
+    for (const auto& cell : shower.fEdep) {
+      G4int iphi = cell.first % fgkNofPhiCells;
+      G4int ir = (cell.first / fgkNofPhiCells) % fgkNofRadialCells;
+      G4int il = cell.first / fgkNofPhiCells / fgkNofRadialCells;
+
+      TG4ShowerLibrary::Spot spot;
+      spot.fLongitudinal = (il + 0.5) * fSpotLength;
+      spot.fRadial = (ir + 0.5) * fSpotRadius;
+      spot.fPhi = (iphi + 0.5) * twopi / fgkNofPhiCells;
+      spot.fEnergyFraction = cell.second / shower.fEnergy;
+      spots.push_back(spot);
+    }
+    fLibrary.AddShower(shower.fBinIndex, shower.fEnergy, spots);
+  }
+
+  lm.unlock();
+
+  fgRecorder->fShowers.clear();
+  fgRecorder->fTrackToShower.clear();
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibraryModel::Save() const
+{
+  /// Write the library in the file
+
+  G4AutoLock lm(&showerLibraryMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "ShowerLibraryModel::Save");
+
+  if (fLibrary.Write(fFileName)) {
+    G4cout << "### Shower library model: saved library in " << fFileName
+           << G4endl;
+    fLibrary.Print();
+  }
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibraryModel::Print() const
+{
+  /// Print the library
+
+  fLibrary.Print();
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibraryModel::SetEnergyBinning(
+  G4int nofBins, G4double minEnergy, G4double maxEnergy)
+{
+  /// Set the library energy binning
+
+  fLibrary.SetEnergyBinning(nofBins, minEnergy, maxEnergy);
+}
+
+//_____________________________________________________________________________
+void TG4ShowerLibraryModel::SetNofAngleBins(G4int nofBins)
+{
+  /// Set the library number of polar angle bins
+
+  fLibrary.SetNofAngleBins(nofBins);
+}
@@ -21,6 +21,7 @@
 #include "TG4GeometryServices.h"
 #include "TG4GflashFastSimulation.h"
 #include "TG4ProcessMapPhysics.h"
+#include "TG4ShowerLibraryFastSimulation.h"
 #include "TG4SpecialCutsPhysics.h"
 #include "TG4StackPopperPhysics.h"
 #include "TG4StepLimiterPhysics.h"
@@ -54,6 +55,7 @@ G4String TG4SpecialPhysicsList::AvailableSelections()
   selections += "specialCuts ";
   selections += "stackPopper ";
   selections += "gflash ";
+  selections += "showerLibrary ";
 
   return selections;
 }
@@ -148,6 +150,7 @@ void TG4SpecialPhysicsList::Configure(const G4String& selection)
   G4int itoken = 0;
   TString token = TG4Globals::GetToken(itoken, selection);
   G4bool isGflash = false;
+  G4bool isShowerLibrary = false;
   while (token != "") {
 
     if (token == "specialCuts") {
@@ -167,6 +170,9 @@ void TG4SpecialPhysicsList::Configure(const G4String& selection)
     else if (token == "gflash") {
       isGflash = true;
     }
+    else if (token == "showerLibrary") {
+      isShowerLibrary = true;
+    }
     else {
       TG4Globals::Warning(
         "TG4SpecialPhysicsList", "Configure", "Unrecognized option " + token);
@@ -184,6 +190,10 @@ void TG4SpecialPhysicsList::Configure(const G4String& selection)
     fFastSimulationPhysics->SetUserFastSimulation(
       new TG4GflashFastSimulation());
   }
+  else if (isShowerLibrary) {
+    fFastSimulationPhysics->SetUserFastSimulation(
+      new TG4ShowerLibraryFastSimulation());
+  }
   RegisterPhysics(new TG4ProcessMapPhysics(tg4VerboseLevel));
 }
 
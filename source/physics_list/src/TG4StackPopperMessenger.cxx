@@ -16,6 +16,7 @@
 #include "TG4StackPopperPhysics.h"
 
 #include <G4UIcmdWithAString.hh>
+#include <G4UIcmdWithAnInteger.hh>
 #include <G4UIdirectory.hh>
 
 //______________________________________________________________________________
@@ -23,7 +24,8 @@ TG4StackPopperMessenger::TG4StackPopperMessenger(
   TG4StackPopperPhysics* stackPopperPhysics)
   : G4UImessenger(),
     fStackPopperPhysics(stackPopperPhysics),
-    fSetSelectionCmd(0)
+    fSetSelectionCmd(0),
+    fSetMaxNofPopsCmd(0)
 {
   /// Standard constructor
 
@@ -32,6 +34,15 @@ TG4StackPopperMessenger::TG4StackPopperMessenger(
   fSetSelectionCmd->SetGuidance("Selects particles for stack popper process");
   fSetSelectionCmd->SetParameterName("StackPopperSelection", false);
   fSetSelectionCmd->AvailableForStates(G4State_PreInit);
+
+  fSetMaxNofPopsCmd =
+    new G4UIcmdWithAnInteger("/mcPhysics/setStackPopperMaxNofPops", this);
+  fSetMaxNofPopsCmd->SetGuidance(
+    "Set the maximum number of tracks popped from the VMC stack per step");
+  fSetMaxNofPopsCmd->SetGuidance("(0 = no limit, default)");
+  fSetMaxNofPopsCmd->SetParameterName("StackPopperMaxNofPops", false);
+  fSetMaxNofPopsCmd->SetRange("StackPopperMaxNofPops >= 0");
+  fSetMaxNofPopsCmd->AvailableForStates(G4State_PreInit);
 }
 
 //______________________________________________________________________________
@@ -40,6 +51,7 @@ TG4StackPopperMessenger::~TG4StackPopperMessenger()
   /// Destructor
 
   delete fSetSelectionCmd;
+  delete fSetMaxNofPopsCmd;
 }
 
 //
@@ -56,4 +68,8 @@ void TG4StackPopperMessenger::SetNewValue(
     G4cout << "TG4StackPopperMessenger::SetNewValue " << newValue << G4endl;
     fStackPopperPhysics->SetSelection(newValue);
   }
+  else if (command == fSetMaxNofPopsCmd) {
+    fStackPopperPhysics->SetMaxNofPopsPerStep(
+      fSetMaxNofPopsCmd->GetNewIntValue(newValue));
+  }
 }
@@ -22,7 +22,8 @@ TG4StackPopperPhysics::TG4StackPopperPhysics(const G4String& name)
   : TG4VPhysicsConstructor(name),
     fMessenger(this),
     fStackPopperProcess(0),
-    fSelection()
+    fSelection(),
+    fMaxNofPopsPerStep(0)
 {
   /// Standard constructor
 }
@@ -33,7 +34,8 @@ TG4StackPopperPhysics::TG4StackPopperPhysics(
   : TG4VPhysicsConstructor(name, theVerboseLevel),
     fMessenger(this),
     fStackPopperProcess(0),
-    fSelection()
+    fSelection(),
+    fMaxNofPopsPerStep(0)
 {
   /// Standard constructor
 }
@@ -63,6 +65,8 @@ void TG4StackPopperPhysics::ConstructProcess()
   /// if no particles were selected
 
   fStackPopperProcess = new TG4StackPopper();
+  fStackPopperProcess->SetMaxNofPopsPerStep(fMaxNofPopsPerStep);
+  fStackPopperProcess->SetVerboseLevel(VerboseLevel());
 
   auto aParticleIterator = GetParticleIterator();
   aParticleIterator->reset();
@@ -101,6 +101,7 @@ class TG4RegionsManager : public TG4VRegionsManager
   G4String GetFileName() const;
   G4bool IsG4Table() const;
   G4bool IsLoad() const;
+  std::size_t GetMemorySize() const override;
 
  private:
   using TG4RegionData = std::array<G4double, fgkValuesSize>;
@@ -16,6 +16,7 @@
 /// \author I. Hrivnacova; IPN Orsay
 
 #include "TG4CrossSectionManager.h"
+#include "TG4CrossSectionTables.h"
 #include "TG4RunActionMessenger.h"
 #include "TG4Verbose.h"
 
@@ -63,10 +64,13 @@ class TG4RunAction : public G4UserRunAction, public TG4Verbose
   // static data members
   /// default name of the random engine status file to be read in
   static const G4String fgkDefaultRandomStatusFile;
+  /// number of steps processed in all threads in the current run
+  static G4long fgNofSteps;
 
   // data members
   TG4RunActionMessenger fMessenger;            ///< messenger
   TG4CrossSectionManager fCrossSectionManager; ///< cross section manager
+  TG4CrossSectionTables fCrossSectionTables;   ///< cross section tables
   G4Timer* fTimer;                             ///< G4Timer
   G4int fRunID;                                ///< run ID
   G4bool fSaveRandomStatus;   ///< control for saving random engine status
@@ -25,6 +25,7 @@ class TG4TrackingAction;
 class TG4SteppingAction;
 class TG4SpecialPhysicsList;
 class TG4VUserRegionConstruction;
+class TG4VUserEventCheckpoint;
 class TG4VUserPostDetConstruction;
 class TG4VUserFastSimulation;
 
@@ -97,6 +98,7 @@ class TG4RunConfiguration
   virtual TG4VUserRegionConstruction* CreateUserRegionConstruction();
   virtual TG4VUserPostDetConstruction* CreateUserPostDetConstruction();
   virtual TG4VUserFastSimulation* CreateUserFastSimulation();
+  virtual TG4VUserEventCheckpoint* CreateUserEventCheckpoint();
 
   // set methods
   void SetMTApplication(Bool_t mtApplication);
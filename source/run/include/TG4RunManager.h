@@ -22,6 +22,8 @@
 
 #include <Rtypes.h>
 
+class TG4MTProfiler;
+class TG4StartupProfiler;
 class TG4RunConfiguration;
 class TG4SpecialControlsV2;
 class TG4VRegionsManager;
@@ -106,6 +108,8 @@ class TG4RunManager : public TG4Verbose
   TG4RunMessenger fMessenger;             ///< messenger
   TG4RunConfiguration* fRunConfiguration; ///< TG4RunConfiguration
   TG4VRegionsManager* fRegionsManager;    ///< regions manager
+  TG4MTProfiler* fMTProfiler;             ///< MT profiler
+  TG4StartupProfiler* fStartupProfiler;   ///< startup profiler
   G4UIExecutive* fGeantUISession;         ///< G4 UI
   TApplication* fRootUISession;           ///< Root UI
   G4bool fRootUIOwner;                    ///< ownership of Root UI
@@ -35,6 +35,9 @@ class G4UIcmdWithABool;
 /// - /mcControl/rootCmd [cmdString]
 /// - /mcControl/useRootRandom [true|false]
 /// - /mcControl/g3Defaults
+/// - /mcControl/profileMT [true|false]
+/// - /mcControl/profileStartup [true|false]
+/// - /mcControl/profileStartupFile fileName
 ///
 /// \author I. Hrivnacova; IPN, Orsay
 
@@ -64,6 +67,9 @@ class TG4RunMessenger : public G4UImessenger
   TG4UICmdWithAComplexString* fRootCommandCmd; ///< command: rootCmd
   G4UIcmdWithABool* fUseRootRandomCmd;         ///< command: useRootRandom
   G4UIcmdWithoutParameter* fG3DefaultsCmd;     ///< command: g3Defaults
+  G4UIcmdWithABool* fProfileMTCmd;             ///< command: profileMT
+  G4UIcmdWithABool* fProfileStartupCmd;        ///< command: profileStartup
+  G4UIcmdWithAString* fProfileStartupFileCmd;  ///< command: profileStartupFile
 };
 
 #endif // TG4_RUN_MESSENGER_H
@@ -71,6 +71,7 @@ class TG4VRegionsManager : public TG4Verbose
   G4bool IsCheck() const;
   G4bool IsPrint() const;
   G4bool IsSave() const;
+  virtual std::size_t GetMemorySize() const;
 
  protected:
   // constants
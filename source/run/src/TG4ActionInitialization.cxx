@@ -14,11 +14,13 @@
 
 #include "TG4ActionInitialization.h"
 #include "TG4EventAction.h"
+#include "TG4EventCheckpoint.h"
 #include "TG4Globals.h"
 #include "TG4RunAction.h"
 #include "TG4RunConfiguration.h"
 #include "TG4SpecialControlsV2.h"
 #include "TG4SpecialStackingAction.h"
+#include "TG4StartupPhase.h"
 #include "TG4SteppingAction.h"
 #include "TG4TrackManager.h"
 #include "TG4TrackingAction.h"
@@ -100,6 +102,7 @@ void TG4ActionInitialization::Build() const
   // create MC and MCApplication worker instances
 #ifdef G4MULTITHREADED
   if (G4Threading::IsWorkerThread()) {
+    TG4StartupPhase phase("buildWorker");
     if (!TGeant4::MasterApplicationInstance()->CloneForWorker()) {
       // Give an exception if user application does not implement
       // CloneForWorker as is run in MT
@@ -126,6 +129,8 @@ void TG4ActionInitialization::Build() const
         TG4EventAction* masterEventAction =
           static_cast<TG4EventAction*>(fEventAction);
         tg4EventAction->SetPrintMemory(masterEventAction->GetPrintMemory());
+        tg4EventAction->SetPrintMemoryAccounting(
+          masterEventAction->GetPrintMemoryAccounting());
         tg4EventAction->SetSaveRandomStatus(
           masterEventAction->GetSaveRandomStatus());
         tg4EventAction->VerboseLevel(masterEventAction->VerboseLevel());
@@ -149,6 +154,8 @@ void TG4ActionInitialization::Build() const
       steppingAction->SetLoopVerboseLevel(
         fSteppingAction->GetLoopVerboseLevel());
       steppingAction->SetMaxNofSteps(fSteppingAction->GetMaxNofSteps());
+      steppingAction->GetOpticalYieldControl().SetMediumNames(
+        fSteppingAction->GetOpticalYieldControl().GetMediumNames());
     }
 
     if (stackingAction) {
@@ -171,6 +178,13 @@ void TG4ActionInitialization::Build() const
   if (!steppingAction) steppingAction = fSteppingAction;
   if (!stackingAction) stackingAction = fStackingAction;
 
+  // User event checkpoint
+  auto eventCheckpoint = TG4EventCheckpoint::Instance();
+  if (eventCheckpoint) {
+    eventCheckpoint->SetUserCheckpoint(
+      fRunConfiguration->CreateUserEventCheckpoint());
+  }
+
   // Create actions (without messengers) which were not yet created
   // and set them to G4RunManager
 
@@ -14,6 +14,7 @@
 
 #include "TG4PrimaryGeneratorAction.h"
 #include "TG4EventAction.h"
+#include "TG4EventCheckpoint.h"
 #include "TG4G3Units.h"
 #include "TG4Globals.h"
 #include "TG4ParticlesManager.h"
@@ -40,9 +41,21 @@
 // generated from short units names
 #include <G4SystemOfUnits.hh>
 
+#include <chrono>
+#include <map>
+#include <tuple>
+#include <vector>
+
 namespace
 {
 
+G4double Now()
+{
+  return std::chrono::duration<G4double>(
+    std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
 TG4EventAction* GetEventAction()
 {
   return static_cast<TG4EventAction*>(const_cast<G4UserEventAction*>(
@@ -230,6 +243,9 @@ void TG4PrimaryGeneratorAction::TransformTracks(G4Event* event)
 {
   /// Create a new G4PrimaryVertex objects for each TParticle
   /// in the VMC stack.
+  /// The tracks are popped from the stack in one batch and grouped per their
+  /// position and time, so that all tracks starting at the same point share
+  /// one G4PrimaryVertex.
 
   // The TMCManagerStack has additional info on the current track status,
   // e.g. kinematics and geometry state.
@@ -242,58 +258,88 @@ void TG4PrimaryGeneratorAction::TransformTracks(G4Event* event)
     G4cout << "TG4PrimaryGeneratorAction::TransformTracks: "
            << fMCManagerStack->GetNtrack() << " particles" << G4endl;
 
-  G4PrimaryVertex* previousVertex = 0;
+  G4double startTime = Now();
 
-  const TParticle* particle = 0;
+  /// The transferred track
+  struct Track
+  {
+    const TParticle* fParticle;
+    const TMCParticleStatus* fStatus;
+    G4ParticleDefinition* fDefinition;
+  };
 
+  // The tracks per vertex in the order of the vertices first appearance
+  std::vector<std::vector<Track>> vertexTracks;
+  std::map<std::tuple<Double_t, Double_t, Double_t, Double_t>, std::size_t>
+    vertexIndices;
+
+  const TParticle* particle = 0;
   Int_t trackId = -1;
+  G4int nofTracks = 0;
 
   while ((particle = fMCManagerStack->PopNextTrack(trackId))) {
+    const TMCParticleStatus* particleStatus =
+      fMCManagerStack->GetParticleStatus(trackId);
 
-    if (particle) {
-      const TMCParticleStatus* particleStatus =
-        fMCManagerStack->GetParticleStatus(trackId);
+    // Get particle definition from TG4ParticlesManager
+    G4ParticleDefinition* particleDefinition =
+      fParticlesManager->GetParticleDefinition(particle, false);
+
+    if (!CheckParticleDefinition(particleDefinition, particle)) {
+      continue;
+    }
+
+    const TLorentzVector& position = particleStatus->fPosition;
+    auto result = vertexIndices.emplace(
+      std::make_tuple(position.X(), position.Y(), position.Z(), position.T()),
+      vertexTracks.size());
+    if (result.second) vertexTracks.emplace_back();
+    vertexTracks[result.first->second].push_back(
+      { particle, particleStatus, particleDefinition });
+    ++nofTracks;
+  }
+
+  const G4double lengthUnit = TG4G3Units::Length();
+  const G4double timeUnit = TG4G3Units::Time();
+  const G4double energyUnit = TG4G3Units::Energy();
+
+  for (const auto& tracks : vertexTracks) {
+    G4PrimaryVertex* vertex = 0;
+    for (const auto& track : tracks) {
+      const TMCParticleStatus* particleStatus = track.fStatus;
 
       // Pass current status of the particle to the trackManager containing
       // information about potential made steps and track length != 0 in case
-      // the track was transported before
+      // the track was transported before;
+      // the statuses are added in the order of the G4 primary tracks
       fTrackManager->AddParticleStatus(particleStatus);
 
-      // Get particle definition from TG4ParticlesManager
-      G4ParticleDefinition* particleDefinition =
-        fParticlesManager->GetParticleDefinition(particle, false);
-
-      if (!CheckParticleDefinition(particleDefinition, particle)) {
-        continue;
-      }
-
       // Current particle's position and time
       const TLorentzVector& particlePosition = particleStatus->fPosition;
-      G4ThreeVector position(particlePosition.X() * TG4G3Units::Length(),
-        particlePosition.Y() * TG4G3Units::Length(),
-        particlePosition.Z() * TG4G3Units::Length());
-      G4double time = particlePosition.T() * TG4G3Units::Time();
+      G4ThreeVector position(particlePosition.X() * lengthUnit,
+        particlePosition.Y() * lengthUnit, particlePosition.Z() * lengthUnit);
+      G4double time = particlePosition.T() * timeUnit;
 
       // Current particle's momentum and energy
       const TLorentzVector& particleMomentum = particleStatus->fMomentum;
-      G4ThreeVector momentum(particleMomentum.Px() * TG4G3Units::Energy(),
-        particleMomentum.Py() * TG4G3Units::Energy(),
-        particleMomentum.Pz() * TG4G3Units::Energy());
-      G4double energy = particleMomentum.Energy() * TG4G3Units::Energy();
+      G4ThreeVector momentum(particleMomentum.Px() * energyUnit,
+        particleMomentum.Py() * energyUnit, particleMomentum.Pz() * energyUnit);
+      G4double energy = particleMomentum.Energy() * energyUnit;
 
       // Particle's charge,  weight and polarization
-      G4double charge = GetProperCharge(particleDefinition, particle);
+      G4double charge = GetProperCharge(track.fDefinition, track.fParticle);
       G4double weight = particleStatus->fWeight;
       const TVector3& polarization = particleStatus->fPolarization;
       G4ThreeVector g4Polarization(
         polarization.X(), polarization.Y(), polarization.Z());
 
       // Create new G4PrimaryParticle and add to G4PrimaryVertex.
-      previousVertex =
-        AddParticleToVertex(event, previousVertex, particleDefinition, position,
-          time, momentum, energy, g4Polarization, charge, weight);
+      vertex = AddParticleToVertex(event, vertex, track.fDefinition, position,
+        time, momentum, energy, g4Polarization, charge, weight);
     }
   }
+
+  fTrackManager->AddTransfer(nofTracks, vertexTracks.size(), Now() - startTime);
 }
 
 //
@@ -336,8 +382,13 @@ void TG4PrimaryGeneratorAction::GeneratePrimaries(G4Event* event)
   fTrackManager->ResetPrimaryParticleIds();
   fTrackManager->ResetParticlesStatus();
 
+  auto eventCheckpoint = TG4EventCheckpoint::Instance();
+  if (eventCheckpoint && eventCheckpoint->IsResume()) {
+    // Restore the pending tracks of the checkpointed event
+    eventCheckpoint->Resume(event);
+  }
   // Don't generate primaries if this is a complex interruptible event
-  if (!fMCManagerStack) {
+  else if (!fMCManagerStack) {
     // Generate primaries and fill the VMC stack
     mcApplication->GeneratePrimaries();
     TransformPrimaries(event);
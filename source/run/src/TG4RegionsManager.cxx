@@ -20,6 +20,7 @@
 #include "TG4Globals.h"
 #include "TG4Limits.h"
 #include "TG4Medium.h"
+#include "TG4MemorySize.h"
 #include "TG4PhysicsManager.h"
 #include "TG4RegionsMessenger.h"
 
@@ -768,3 +769,12 @@ void TG4RegionsManager::SetLoad(G4bool isLoad)
 
   fIsLoad = isLoad;
 }
+
+//_____________________________________________________________________________
+std::size_t TG4RegionsManager::GetMemorySize() const
+{
+  /// Return the estimated memory (in bytes) of the regions
+  /// and of the computed or loaded regions data
+
+  return TG4VRegionsManager::GetMemorySize() + TG4MemorySize::Of(fRegionData);
+}
@@ -16,9 +16,19 @@
 // in order to avoid the odd dependency for the
 // times system function this include must be the first
 
+#include "TG4ExtDecayer.h"
+#include "TG4FieldTuner.h"
+#include "TG4GeometryManager.h"
 #include "TG4Globals.h"
+#include "TG4MTProfiler.h"
+#include "TG4OpticalDetectionMap.h"
+#include "TG4ProfilingNavigator.h"
+#include "TG4StackPopper.h"
+#include "TG4StartupProfiler.h"
 #include "TG4VRegionsManager.h"
 #include "TG4RunAction.h"
+#include "TG4SteppingAction.h"
+#include "TG4TrackManager.h"
 #include "TGeant4.h"
 
 #include <G4AutoLock.hh>
@@ -55,6 +65,7 @@ G4Transportation* FindTransportation(
 } // namespace
 
 const G4String TG4RunAction::fgkDefaultRandomStatusFile = "currentRun.rndm";
+G4long TG4RunAction::fgNofSteps = 0;
 
 //_____________________________________________________________________________
 TG4RunAction::TG4RunAction()
@@ -62,6 +73,7 @@ TG4RunAction::TG4RunAction()
     TG4Verbose("runAction"),
     fMessenger(this),
     fCrossSectionManager(),
+    fCrossSectionTables(),
     fTimer(0),
     fRunID(-1),
     fSaveRandomStatus(false),
@@ -163,6 +175,11 @@ void TG4RunAction::BeginOfRunAction(const G4Run* run)
 
   fRunID++;
 
+  // stop the run initialization phase started in TG4RunManager
+  if (IsMaster()) {
+    TG4StartupProfiler::StopPhase("runInitialization");
+  }
+
   if (VerboseLevel() > 0) {
     G4cout << "### Run " << run->GetRunID() << " start." << G4endl;
   }
@@ -212,6 +229,15 @@ void TG4RunAction::BeginOfRunAction(const G4Run* run)
     PrintLooperParameters();
   }
 
+  // reset the steps counters
+  if (IsMaster()) {
+    fgNofSteps = 0;
+  }
+  auto steppingAction = TG4SteppingAction::Instance();
+  if (steppingAction != nullptr) {
+    steppingAction->ResetNofSteps();
+  }
+
   fTimer->Start();
 }
 
@@ -220,16 +246,34 @@ void TG4RunAction::EndOfRunAction(const G4Run* run)
 {
   /// Called by G4 kernel at the end of run.
 
+  auto steppingAction = TG4SteppingAction::Instance();
+
 #ifdef G4MULTITHREADED
   if (! IsMaster()) {
     // Merge user application data collected on workers to master
-    G4AutoLock lm(&mergeMutex);
+    G4AutoLock lm(&mergeMutex, std::defer_lock);
+    TG4MTProfiler::Lock(lm, "RunAction::Merge");
+    auto startTime = TG4MTProfiler::StartTimer();
     TGeant4::MasterApplicationInstance()->Merge(
       TVirtualMCApplication::Instance());
+    TG4MTProfiler::AddPhaseTime("merge", startTime);
+    // Add the steps processed on this worker
+    fgNofSteps += steppingAction->GetNofSteps();
     lm.unlock();
   }
 #endif
 
+  if (IsMaster() && steppingAction != nullptr) {
+    // Sequential mode: the steps were processed on master
+    fgNofSteps += steppingAction->GetNofSteps();
+  }
+
+  // Merge the field tuner samples collected in this thread
+  auto fieldTuner = TG4GeometryManager::Instance()->GetFieldTuner();
+  if (fieldTuner != nullptr) {
+    fieldTuner->MergeSamples();
+  }
+
   if (fCrossSectionManager.IsMakeHistograms()) {
     fCrossSectionManager.MakeHistograms();
   }
@@ -240,5 +284,62 @@ void TG4RunAction::EndOfRunAction(const G4Run* run)
     G4cout << "Time of this run:   " << *fTimer << G4endl;
     G4cout << "Number of events processed: " << run->GetNumberOfEvent()
            << G4endl;
+    if (IsMaster()) {
+      G4cout << "Number of steps processed: " << fgNofSteps << G4endl;
+    }
+  }
+
+  // Print the external decayer statistics in this thread
+  auto extDecayer = TG4ExtDecayer::Instance();
+  if (extDecayer != nullptr && extDecayer->VerboseLevel() > 0) {
+    extDecayer->PrintStatistics();
+    extDecayer->ResetStatistics();
+  }
+
+  // Print the stack popper statistics in this thread
+  auto stackPopper = TG4StackPopper::Instance();
+  if (stackPopper != nullptr && stackPopper->GetVerboseLevel() > 0) {
+    stackPopper->PrintStatistics();
+    stackPopper->ResetStatistics();
+  }
+
+  // Print the statistics of the tracks transferred from other engines
+  auto trackManager = TG4TrackManager::Instance();
+  if (trackManager != nullptr && trackManager->VerboseLevel() > 0) {
+    trackManager->PrintTransferStatistics();
+    trackManager->ResetTransferStatistics();
+  }
+
+  // Merge the optical detection map calibration and write it on master;
+  // print the map production statistics in this thread
+  auto opticalDetectionMap =
+    TG4GeometryManager::Instance()->GetOpticalDetectionMap();
+  if (opticalDetectionMap->IsCalibration()) {
+    opticalDetectionMap->Merge();
+    if (IsMaster()) opticalDetectionMap->Write();
+  }
+  if (opticalDetectionMap->IsProduction() &&
+      opticalDetectionMap->VerboseLevel() > 0) {
+    opticalDetectionMap->PrintStatistics();
+    opticalDetectionMap->ResetStatistics();
+  }
+
+  // Print the navigation profile in this thread
+  auto profilingNavigator = TG4ProfilingNavigator::Instance();
+  if (profilingNavigator != nullptr) {
+    profilingNavigator->PrintStatistics();
+    profilingNavigator->ResetStatistics();
+  }
+
+  // Print the MT profile
+  auto profiler = TG4MTProfiler::Instance();
+  if (IsMaster() && profiler != nullptr && profiler->IsActive()) {
+    profiler->Print();
+  }
+
+  // Print the startup profile
+  auto startupProfiler = TG4StartupProfiler::Instance();
+  if (IsMaster() && startupProfiler != nullptr) {
+    startupProfiler->Report();
   }
 }
@@ -26,6 +26,7 @@
 #include "TG4SpecialStackingAction.h"
 #include "TG4SteppingAction.h"
 #include "TG4TrackingAction.h"
+#include "TG4VUserEventCheckpoint.h"
 #include "TG4VUserRegionConstruction.h"
 
 #include <G4UImessenger.hh>
@@ -295,6 +296,14 @@ TG4VUserFastSimulation* TG4RunConfiguration::CreateUserFastSimulation()
   return 0;
 }
 
+//_____________________________________________________________________________
+TG4VUserEventCheckpoint* TG4RunConfiguration::CreateUserEventCheckpoint()
+{
+  /// No user event checkpoint is defined by default
+
+  return 0;
+}
+
 //_____________________________________________________________________________
 void TG4RunConfiguration::SetMTApplication(Bool_t mtApplication)
 {
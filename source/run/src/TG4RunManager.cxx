@@ -20,6 +20,9 @@
 #include "TG4GeometryManager.h"
 #include "TG4GeometryServices.h"
 #include "TG4Globals.h"
+#include "TG4MTProfiler.h"
+#include "TG4StartupPhase.h"
+#include "TG4StartupProfiler.h"
 #include "TG4PhysicsManager.h"
 #include "TG4PostDetConstruction.h"
 #include "TG4RegionsManager.h"
@@ -88,6 +91,8 @@ TG4RunManager::TG4RunManager(
     fMessenger(this),
     fRunConfiguration(runConfiguration),
     fRegionsManager(0),
+    fMTProfiler(0),
+    fStartupProfiler(0),
     fGeantUISession(0),
     fRootUISession(0),
     fRootUIOwner(false),
@@ -129,7 +134,12 @@ TG4RunManager::TG4RunManager(
   if (isMaster) {
     fgMasterInstance = this;
 
+    // create MT and startup profilers
+    fMTProfiler = new TG4MTProfiler();
+    fStartupProfiler = new TG4StartupProfiler();
+
     // create and configure G4 run manager
+    TG4StartupPhase phase("configureRunManager");
     ConfigureRunManager();
   }
   else {
@@ -137,9 +147,15 @@ TG4RunManager::TG4RunManager(
     fRunManager = G4RunManager::GetRunManager();
 
     // Clone G4Root navigator if needed
+    auto startTime = TG4MTProfiler::StartTimer();
+    TG4StartupProfiler::StartPhase("cloneRootNavigator");
     CloneRootNavigatorForWorker();
+    TG4StartupProfiler::StopPhase("cloneRootNavigator");
+    TG4MTProfiler::AddPhaseTime("cloneRootNavigator", startTime);
 
     fRegionsManager = fgMasterInstance->fRegionsManager;
+    fMTProfiler = fgMasterInstance->fMTProfiler;
+    fStartupProfiler = fgMasterInstance->fStartupProfiler;
     fRootUISession = fgMasterInstance->fRootUISession;
     fGeantUISession = fgMasterInstance->fGeantUISession;
   }
@@ -159,6 +175,8 @@ TG4RunManager::~TG4RunManager()
   if (isMaster) {
     delete fRunConfiguration;
     delete fRegionsManager;
+    delete fMTProfiler;
+    delete fStartupProfiler;
     delete fGeantUISession;
     delete fRunManager;
     if (fRootUIOwner) delete fRootUISession;
@@ -420,10 +438,18 @@ void TG4RunManager::Initialize()
 #endif
 
   // initialize Geant4
+  auto startTime = TG4MTProfiler::StartTimer();
+  TG4StartupProfiler::StartPhase("initialize");
+  TG4StartupProfiler::StartPhase("runManagerInitialize");
   fRunManager->Initialize();
+  TG4StartupProfiler::StopPhase("runManagerInitialize");
 
   // finish geometry
+  TG4StartupProfiler::StartPhase("finishGeometry");
   TG4GeometryManager::Instance()->FinishGeometry();
+  TG4StartupProfiler::StopPhase("finishGeometry");
+  TG4StartupProfiler::StopPhase("initialize");
+  TG4MTProfiler::AddPhaseTime("initialize", startTime);
 
   // initialize SD manager
   // TG4SDManager::Instance()->Initialize();
@@ -442,15 +468,21 @@ void TG4RunManager::LateInitialize()
     G4cout << "TG4RunManager::LateInitialize " << this << G4endl;
 
   G4bool isMaster = !G4Threading::IsWorkerThread();
+  auto startTime = TG4MTProfiler::StartTimer();
+  TG4StartupPhase phase(isMaster ? "lateInitialize" : "lateInitializeOnWorker");
 
   // define particles
+  TG4StartupProfiler::StartPhase("defineParticles");
   TG4PhysicsManager::Instance()->DefineParticles();
+  TG4StartupProfiler::StopPhase("defineParticles");
 
   // set user limits
   if (isMaster) {
+    TG4StartupProfiler::StartPhase("setUserLimits");
     TG4GeometryManager::Instance()->SetUserLimits(
       *TG4G3PhysicsManager::Instance()->GetCutVector(),
       *TG4G3PhysicsManager::Instance()->GetControlVector());
+    TG4StartupProfiler::StopPhase("setUserLimits");
 
     // pass info if cut on e+e- pair is activated to stepping action
     // TO DO LATER - Stepping Action NOT AVAILABLE
@@ -459,14 +491,17 @@ void TG4RunManager::LateInitialize()
 
     // convert tracking cuts in range cuts per regions
     if (fRunConfiguration->IsSpecialCuts()) {
+      TG4StartupPhase regionsPhase("defineRegions");
       fRegionsManager->DefineRegions();
       fRegionsManager->UpdateProductionCutsTable();
     }
   }
 
   // activate/inactivate physics processes
+  TG4StartupProfiler::StartPhase("setProcessActivation");
   TG4PhysicsManager::Instance()->SetProcessActivation();
   TG4PhysicsManager::Instance()->RetrieveOpBoundaryProcess();
+  TG4StartupProfiler::StopPhase("setProcessActivation");
 
   // late initialize step manager
   TG4StepManager::Instance()->LateInitialize();
@@ -489,6 +524,9 @@ void TG4RunManager::LateInitialize()
   // set the random number seed
   if (fUseRootRandom) SetRandomSeed();
 
+  TG4MTProfiler::AddPhaseTime(
+    isMaster ? "lateInitialize" : "lateInitializeOnWorker", startTime);
+
   if (VerboseLevel() > 1)
     G4cout << "TG4RunManager::LateInitialize done " << this << G4endl;
 }
@@ -548,7 +586,10 @@ void TG4RunManager::ProcessEvent(G4int eventId, G4bool isInterruptible)
       return;
     }
     fRunManager->ConstructScoringWorlds();
+    // the phase is stopped in TG4RunAction::BeginOfRunAction
+    TG4StartupProfiler::StartPhase("runInitialization");
     fRunManager->RunInitialization();
+    TG4StartupProfiler::StopPhase("runInitialization");
     fHasEventByEventInitialization = true;
   }
   GetEventAction()->SetIsInterruptibleEvent(isInterruptible);
@@ -571,7 +612,11 @@ Bool_t TG4RunManager::ProcessRun(G4int nofEvents)
     FinishRun();
   }
   fInProcessRun = true;
+  // the run initialization (including building physics tables) phase
+  // is stopped in TG4RunAction::BeginOfRunAction
+  TG4StartupProfiler::StartPhase("runInitialization");
   fRunManager->BeamOn(nofEvents);
+  TG4StartupProfiler::StopPhase("runInitialization");
   fInProcessRun = false;
   fNEventsProcessed = nofEvents;
   return FinishRun();
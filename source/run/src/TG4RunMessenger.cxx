@@ -14,7 +14,9 @@
 
 #include "TG4RunMessenger.h"
 #include "TG4Globals.h"
+#include "TG4MTProfiler.h"
 #include "TG4RunManager.h"
+#include "TG4StartupProfiler.h"
 #include "TG4UICmdWithAComplexString.h"
 
 #include <G4UIcmdWithABool.hh>
@@ -31,7 +33,10 @@ TG4RunMessenger::TG4RunMessenger(TG4RunManager* runManager)
     fRootMacroCmd(0),
     fRootCommandCmd(0),
     fUseRootRandomCmd(0),
-    fG3DefaultsCmd(0)
+    fG3DefaultsCmd(0),
+    fProfileMTCmd(0),
+    fProfileStartupCmd(0),
+    fProfileStartupFileCmd(0)
 {
   /// Standard constructor
 
@@ -67,6 +72,35 @@ TG4RunMessenger::TG4RunMessenger(TG4RunManager* runManager)
   fG3DefaultsCmd->SetGuidance("Set G3 default parameters (cut values,");
   fG3DefaultsCmd->SetGuidance("tracking media max step values, ...)");
   fG3DefaultsCmd->AvailableForStates(G4State_PreInit);
+
+  fProfileMTCmd = new G4UIcmdWithABool("/mcControl/profileMT", this);
+  fProfileMTCmd->SetGuidance(
+    "(In)Activate collecting the per thread event time, the waiting time");
+  fProfileMTCmd->SetGuidance(
+    "in the Geant4 VMC mutexes and the threads initialization and merging");
+  fProfileMTCmd->SetGuidance("time; the profile is printed at the end of run.");
+  fProfileMTCmd->SetParameterName("ProfileMT", false);
+  fProfileMTCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  fProfileMTCmd->SetToBeBroadcasted(false);
+
+  fProfileStartupCmd = new G4UIcmdWithABool("/mcControl/profileStartup", this);
+  fProfileStartupCmd->SetGuidance(
+    "(In)Activate printing the time and the memory (RSS) change of the");
+  fProfileStartupCmd->SetGuidance(
+    "initialization phases on master and workers at the end of run.");
+  fProfileStartupCmd->SetParameterName("ProfileStartup", false);
+  fProfileStartupCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  fProfileStartupCmd->SetToBeBroadcasted(false);
+
+  fProfileStartupFileCmd =
+    new G4UIcmdWithAString("/mcControl/profileStartupFile", this);
+  fProfileStartupFileCmd->SetGuidance(
+    "Set the JSON file for the initialization phases profile;");
+  fProfileStartupFileCmd->SetGuidance(
+    "the file is written at the end of run.");
+  fProfileStartupFileCmd->SetParameterName("ProfileStartupFile", false);
+  fProfileStartupFileCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+  fProfileStartupFileCmd->SetToBeBroadcasted(false);
 }
 
 //_____________________________________________________________________________
@@ -80,6 +114,9 @@ TG4RunMessenger::~TG4RunMessenger()
   delete fRootCommandCmd;
   delete fUseRootRandomCmd;
   delete fG3DefaultsCmd;
+  delete fProfileMTCmd;
+  delete fProfileStartupCmd;
+  delete fProfileStartupFileCmd;
 }
 
 //
@@ -106,4 +143,15 @@ void TG4RunMessenger::SetNewValue(G4UIcommand* command, G4String newValue)
   else if (command == fG3DefaultsCmd) {
     fRunManager->UseG3Defaults();
   }
+  else if (command == fProfileMTCmd) {
+    TG4MTProfiler::Instance()->SetIsActive(
+      fProfileMTCmd->GetNewBoolValue(newValue));
+  }
+  else if (command == fProfileStartupCmd) {
+    TG4StartupProfiler::Instance()->SetIsPrint(
+      fProfileStartupCmd->GetNewBoolValue(newValue));
+  }
+  else if (command == fProfileStartupFileCmd) {
+    TG4StartupProfiler::Instance()->SetFileName(newValue);
+  }
 }
@@ -20,6 +20,7 @@
 #include "TG4Globals.h"
 #include "TG4Limits.h"
 #include "TG4Medium.h"
+#include "TG4MemorySize.h"
 #include "TG4RegionsMessenger.h"
 
 #include <G4LogicalVolumeStore.hh>
@@ -361,3 +362,22 @@ void TG4VRegionsManager::DumpRegionStore() const
   G4cout << "========= End Region Store Dump =================================="
          << G4endl;
 }
+
+//_____________________________________________________________________________
+std::size_t TG4VRegionsManager::GetMemorySize() const
+{
+  /// Return the estimated memory (in bytes) of the regions and their
+  /// production cuts in the region store
+
+  std::size_t size = 0;
+  for (auto region : *G4RegionStore::GetInstance()) {
+    size += sizeof(G4Region) + TG4MemorySize::Of(region->GetName()) +
+            (region->GetNumberOfMaterials() +
+              region->GetNumberOfRootVolumes()) * sizeof(void*);
+    if (region->GetProductionCuts() != nullptr) {
+      size += sizeof(G4ProductionCuts);
+    }
+  }
+
+  return size;
+}
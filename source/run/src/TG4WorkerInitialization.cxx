@@ -13,7 +13,9 @@
 /// \author I. Hrivnacova; IPN, Orsay
 
 #include "TG4WorkerInitialization.h"
+#include "TG4MTProfiler.h"
 #include "TG4RunManager.h"
+#include "TG4StartupProfiler.h"
 
 #include <RVersion.h>
 #include <TVirtualMCApplication.h>
@@ -60,7 +62,11 @@ void TG4WorkerInitialization::WorkerRunStart() const
 
   TG4RunManager::Instance()->LateInitialize();
 #ifdef G4MULTITHREADED
+  auto startTime = TG4MTProfiler::StartTimer();
+  TG4StartupProfiler::StartPhase("beginRunOnWorker");
   TVirtualMCApplication::Instance()->BeginRunOnWorker();
+  TG4StartupProfiler::StopPhase("beginRunOnWorker");
+  TG4MTProfiler::AddPhaseTime("beginRunOnWorker", startTime);
   // G4cout << "TG4WorkerInitialization::WorkerRunStart() end " << G4endl;
 #endif
 }
@@ -74,8 +80,11 @@ void TG4WorkerInitialization::WorkerRunEnd() const
   // G4cout << "TG4WorkerInitialization::WorkerRunEnd() " << G4endl;
 
 #ifdef G4MULTITHREADED
-  G4AutoLock lm(&finishRunMutex);
+  G4AutoLock lm(&finishRunMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "WorkerInitialization::FinishRun");
+  auto startTime = TG4MTProfiler::StartTimer();
   TVirtualMCApplication::Instance()->FinishRunOnWorker();
+  TG4MTProfiler::AddPhaseTime("finishRunOnWorker", startTime);
   lm.unlock();
 #endif
 
@@ -92,7 +101,8 @@ void TG4WorkerInitialization::WorkerStop() const
   // G4cout << "TG4WorkerInitialization::WorkerStop() " << G4endl;
 
 #ifdef G4MULTITHREADED
-  G4AutoLock lm(&stopWorkerMutex);
+  G4AutoLock lm(&stopWorkerMutex, std::defer_lock);
+  TG4MTProfiler::Lock(lm, "WorkerInitialization::Stop");
   delete TVirtualMCApplication::Instance();
   lm.unlock();
 #endif
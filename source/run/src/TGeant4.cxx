@@ -998,7 +998,8 @@ Bool_t TGeant4::SetDecayMode(Int_t pdg, Float_t bratio[6], Int_t mode[6][3])
 //_____________________________________________________________________________
 Double_t TGeant4::Xsec(char* reac, Double_t energy, Int_t part, Int_t mate)
 {
-  /// Not yet implemented -> give exception.
+  /// Return the cross section per volume (1/cm) for the given reaction,
+  /// particle kinetic energy (GeV), particle PDG and medium ID
 
   return fPhysicsManager->Xsec(reac, energy, part, mate);
 }